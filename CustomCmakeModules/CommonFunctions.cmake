@@ -5,6 +5,9 @@ function(add_static_library NAME VERSION)
   # Add library target
   add_library(${NAME} STATIC)
 
+  # Compile out log calls below the default level
+  target_log_active_level(${NAME} ${LOG_ACTIVE_LEVEL})
+
   # Get SOVERSION
   string(REGEX MATCH "^([0-9]+)" SOVERSION ${VERSION})
 
@@ -37,6 +40,9 @@ function(add_shared_library NAME VERSION)
   # Add library target
   add_library(${NAME} SHARED)
 
+  # Compile out log calls below the default level
+  target_log_active_level(${NAME} ${LOG_ACTIVE_LEVEL})
+
   # Get SOVERSION
   string(REGEX MATCH "^([0-9]+)" SOVERSION ${VERSION})
 
@@ -96,6 +102,49 @@ function(add_interface_library NAME VERSION)
     PATTERN ".*hpp")
 endfunction()
 
+# -----------------------------------------------------------------------------
+# Function to add a command line tool shipped with a library
+# -----------------------------------------------------------------------------
+function(add_tool_executable NAME)
+  # Add executable target from the remaining arguments (sources)
+  add_executable(${NAME} ${ARGN})
+
+  # Compile out log calls below the default level
+  target_log_active_level(${NAME} ${LOG_ACTIVE_LEVEL})
+
+  # Add Code Coverage when Building with Unit Test
+  add_code_coverage(${NAME} PRIVATE)
+
+  # Install binaries
+  install(TARGETS ${NAME} RUNTIME)
+endfunction()
+
+# -----------------------------------------------------------------------------
+# Function to set the lowest log level compiled in a target (TRACE, DEBUG, INFO,
+# WARN, ERROR, CRITICAL or OFF). Log macros below this level compile to nothing
+# -----------------------------------------------------------------------------
+function(target_log_active_level TARGET_NAME LEVEL)
+  set(LOG_LEVELS TRACE DEBUG INFO WARN ERROR CRITICAL OFF)
+  string(TOUPPER "${LEVEL}" LEVEL_NAME)
+  list(FIND LOG_LEVELS "${LEVEL_NAME}" LEVEL_INDEX)
+  if(LEVEL_INDEX EQUAL -1)
+    message(FATAL_ERROR "🔴 Unknown log level ${LEVEL} for ${TARGET_NAME}")
+  endif()
+
+  # Replace any level previously set for the target
+  set_target_properties(${TARGET_NAME} PROPERTIES LOG_ACTIVE_LEVEL
+                                                  ${LEVEL_INDEX})
+  get_target_property(LEVEL_DEFINED ${TARGET_NAME} LOG_ACTIVE_LEVEL_DEFINED)
+  if(NOT LEVEL_DEFINED)
+    target_compile_definitions(
+      ${TARGET_NAME}
+      PRIVATE STROALGO_LOG_ACTIVE_LEVEL=$<TARGET_PROPERTY:LOG_ACTIVE_LEVEL>
+              SPDLOG_ACTIVE_LEVEL=$<TARGET_PROPERTY:LOG_ACTIVE_LEVEL>)
+    set_target_properties(${TARGET_NAME} PROPERTIES LOG_ACTIVE_LEVEL_DEFINED
+                                                    TRUE)
+  endif()
+endfunction()
+
 # -----------------------------------------------------------------------------
 # Function to make Doxygen Documentation
 # -----------------------------------------------------------------------------
@@ -173,6 +222,42 @@ function(add_unit_test NAME)
   memorycheck(${NAME}_test)
 endfunction()
 
+# -----------------------------------------------------------------------------
+# Function to create benchmark executable Use extra argument (ARGN) to Add
+# dependendies only needed for the benchmark executable. The ${NAME}_bench_json
+# target runs it and writes ${NAME}_bench.json, to compare two builds with
+# Google Benchmark tools/compare.py
+# -----------------------------------------------------------------------------
+function(add_benchmark NAME)
+
+  message("🟢 Add Benchmark for ${NAME}")
+
+  # List all benchmark files
+  file(GLOB_RECURSE bench_SRC "${CMAKE_CURRENT_SOURCE_DIR}/benchmark/*.cpp"
+       "${CMAKE_CURRENT_SOURCE_DIR}/benchmark/*.cxx")
+
+  # Add benchmark executable target
+  add_executable(${NAME}_bench ${bench_SRC})
+  target_link_libraries(${NAME}_bench PRIVATE benchmark::benchmark
+                                              benchmark::benchmark_main ${ARGN}
+                                              ${NAME})
+
+  # Measure the levels compiled in a default build
+  target_log_active_level(${NAME}_bench ${LOG_ACTIVE_LEVEL})
+
+  # Run the benchmark and keep its results as JSON
+  add_custom_target(
+    ${NAME}_bench_json
+    COMMAND
+      $<TARGET_FILE:${NAME}_bench>
+      --benchmark_out=${CMAKE_CURRENT_BINARY_DIR}/${NAME}_bench.json
+      --benchmark_out_format=json
+    WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+    DEPENDS ${NAME}_bench
+    COMMENT "Running benchmarks of ${NAME}"
+    VERBATIM)
+endfunction()
+
 # -----------------------------------------------------------------------------
 # Function to profile memory of a unit test (executable)
 # -----------------------------------------------------------------------------
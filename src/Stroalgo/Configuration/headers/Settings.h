@@ -15,8 +15,11 @@
 
 #include <boost/log/trivial.hpp>
 #include <boost/property_tree/ptree.hpp>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -30,6 +33,112 @@ namespace Stroalgo::Configuration {
  */
 class Settings {
  public:
+  /**
+   * @brief Struct to hold the flush policy of a module logger, read from
+   * [Logger] and overridden by [Module:<Name>] sections
+   * @memberof Settings
+   * @struct FlushSettings
+   * @public
+   */
+  struct FlushSettings {
+    // Flush once this many bytes are pending (FlushBytes), 0 disables it
+    std::size_t m_Bytes{0};
+    // Flush once this many records are pending (FlushRecords), 0 disables it
+    std::size_t m_Records{0};
+    // Flush pending records after this delay (FlushIntervalMs), 0 disables it
+    std::uint32_t m_IntervalMs{0};
+    // Flush immediately records at or above this level (FlushLevel)
+    boost::log::trivial::severity_level m_Level{boost::log::trivial::trace};
+    // Run fdatasync after each flush (FlushSync)
+    bool m_Sync{false};
+  };
+
+  /**
+   * @brief Struct to hold the records dropped by a module logger during log
+   * storms, read from [Logger] and overridden by [Module:<Name>] sections
+   * @memberof Settings
+   * @struct ThrottleSettings
+   * @public
+   */
+  struct ThrottleSettings {
+    // Records written per second (RateLimit), 0 disables it
+    double m_RateLimit{0};
+    // Records written at once after an idle period (RateBurst), 0 for one
+    // second of records
+    std::uint32_t m_RateBurst{0};
+    // Fraction of the trace and debug records written (SampleRate)
+    double m_SampleRate{1};
+    // Collapse identical consecutive records (SuppressDuplicates)
+    bool m_SuppressDuplicates{false};
+  };
+
+  /**
+   * @brief Struct to hold the retention of the log files, read from [Logger],
+   * the quota and age are overridden by [Module:<Name>] sections
+   * @memberof Settings
+   * @struct RetentionSettings
+   * @public
+   */
+  struct RetentionSettings {
+    // Daily files kept (RetentionMaxDays), 0 keeps them
+    std::uint16_t m_MaxDays{31};
+    // Bytes of log files kept (RetentionMaxBytes), all modules in [Logger],
+    // the module in [Module:<Name>], 0 disables it
+    std::uint64_t m_MaxBytes{0};
+    // Oldest files removed below this free disk space
+    // (RetentionMinFreeBytes), 0 disables it
+    std::uint64_t m_MinFreeBytes{0};
+    // Free disk space restored once below the minimum
+    // (RetentionTargetFreeBytes), 0 restores the minimum
+    std::uint64_t m_TargetFreeBytes{0};
+    // Time between two retention rounds (RetentionIntervalMs)
+    std::uint32_t m_IntervalMs{60000};
+    // Bytes compressed or removed per second (RetentionIoRate), 0 unlimited
+    std::uint64_t m_IoRate{0};
+    // Compress the oldest files before removing any (RetentionCompress)
+    bool m_Compress{true};
+  };
+
+  /**
+   * @brief Struct to hold the flight recorder of a module logger, read from
+   * [Logger] and overridden by [Module:<Name>] sections
+   * @memberof Settings
+   * @struct FlightRecorderSettings
+   * @public
+   */
+  struct FlightRecorderSettings {
+    // Bytes of records kept in memory (FlightRecorderSize), 0 disables it
+    std::size_t m_Size{0};
+    // Lowest level kept in memory (FlightRecorderLevel)
+    boost::log::trivial::severity_level m_Level{boost::log::trivial::trace};
+    // Records at or above this level dump the memory (FlightRecorderTrigger)
+    boost::log::trivial::severity_level m_Trigger{boost::log::trivial::error};
+    // Map the memory on a file surviving a crash (FlightRecorderFileBacked)
+    bool m_FileBacked{false};
+  };
+
+  /**
+   * @brief How the text and JSON files of a module are written (FileWriter),
+   * read from [Logger] and overridden by [Module:<Name>] sections
+   * @memberof Settings
+   * @public
+   */
+  enum class FileWriter {
+    // Buffered stdio, one write per flush ("stdio")
+    Stdio,
+    // Memory mapped preallocated segments ("mmap")
+    Mapped,
+    // io_uring submissions, stdio if not supported ("io_uring")
+    IoUring
+  };
+
+  /**
+   * @brief Callback run after every LoadSettings, with the settings reloaded
+   * @memberof Settings
+   * @public
+   */
+  using ReloadListener = std::function<void(const Settings&)>;
+
   /**
    * @brief Destroy the Settings Manager object
    * @memberof Settings
@@ -82,6 +191,82 @@ class Settings {
   const boost::log::trivial::severity_level& GetSettingModuleLogLevel(
       const std::string& pModuleName);
 
+  /**
+   * @brief Get the Module Log Level without requiring module settings
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The module level if it is listed in [Modules] or has a
+   * [Module:<Name>] section, the [Logger] level otherwise
+   */
+  boost::log::trivial::severity_level GetSettingModuleLogLevelOrDefault(
+      const std::string& pModuleName) const;
+
+  /**
+   * @brief Check if the logs of a module are written
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The Enabled key of its [Module:<Name>] section, true otherwise
+   */
+  bool GetSettingModuleEnabled(const std::string& pModuleName) const;
+
+  /**
+   * @brief Get the flush policy of a module
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The module policy if it has a [Module:<Name>] section, the
+   * [Logger] policy otherwise
+   */
+  const FlushSettings& GetSettingModuleFlush(
+      const std::string& pModuleName) const;
+
+  /**
+   * @brief Get the throttle of a module
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The module throttle if it has a [Module:<Name>] section, the
+   * [Logger] throttle otherwise
+   */
+  const ThrottleSettings& GetSettingModuleThrottle(
+      const std::string& pModuleName) const;
+
+  /**
+   * @brief Get the file writer of a module
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The module writer if it has a [Module:<Name>] section, the
+   * [Logger] writer otherwise
+   */
+  FileWriter GetSettingModuleFileWriter(const std::string& pModuleName) const;
+
+  /**
+   * @brief Get the flight recorder of a module
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The module recorder if it has a [Module:<Name>] section, the
+   * [Logger] recorder otherwise
+   */
+  const FlightRecorderSettings& GetSettingModuleFlightRecorder(
+      const std::string& pModuleName) const;
+
+  /**
+   * @brief Get the retention of the log files
+   * @memberof Settings
+   * @return The [Logger] retention
+   */
+  inline const RetentionSettings& GetSettingRetention() const {
+    return m_LoggerSettings.m_Retention;
+  }
+
+  /**
+   * @brief Get the retention of the files of a module
+   * @memberof Settings
+   * @param pModuleName Name of the module
+   * @return The [Logger] retention with the quota and age of the module,
+   * without quota if the module has none
+   */
+  RetentionSettings GetSettingModuleRetention(
+      const std::string& pModuleName) const;
+
   /**
    * @brief Get the Settings Server Port object
    * @memberof Settings
@@ -113,6 +298,23 @@ class Settings {
    */
   inline bool AreSettingsLoaded() const { return m_SettingsLoaded; }
 
+  /**
+   * @brief Run a callback after every LoadSettings, on the reloading thread
+   * @memberof Settings
+   * @param pListener Callback, must not add or remove listeners
+   * @return Id used to remove the listener
+   * @public
+   */
+  std::size_t AddReloadListener(ReloadListener pListener) const;
+
+  /**
+   * @brief Stop running a callback after LoadSettings
+   * @memberof Settings
+   * @param pId Id returned by AddReloadListener
+   * @public
+   */
+  void RemoveReloadListener(std::size_t pId) const;
+
   // TODO(stroalgo) :Future implementations
   //   void SaveSettings();
   //   void ResetSettings();
@@ -132,6 +334,11 @@ class Settings {
     std::string m_SettingLogPath{"LOGS"};
     boost::log::trivial::severity_level m_SettingLogLevel{
         boost::log::trivial::trace};
+    FlushSettings m_Flush{};
+    ThrottleSettings m_Throttle{};
+    FileWriter m_FileWriter{FileWriter::Stdio};
+    RetentionSettings m_Retention{};
+    FlightRecorderSettings m_FlightRecorder{};
   } m_LoggerSettings{};
 
   /**
@@ -144,6 +351,12 @@ class Settings {
     std::string m_ModuleName{""};
     boost::log::trivial::severity_level m_ModuleLogLevel{
         boost::log::trivial::trace};
+    bool m_Enabled{true};
+    FlushSettings m_Flush{};
+    ThrottleSettings m_Throttle{};
+    FileWriter m_FileWriter{FileWriter::Stdio};
+    RetentionSettings m_Retention{};
+    FlightRecorderSettings m_FlightRecorder{};
   };
 
   /**
@@ -163,6 +376,73 @@ class Settings {
     std::uint16_t m_ServerPort{};
   } m_ServerSettings{};
 
+  /**
+   * @brief Read the flush keys of a section
+   * @memberof Settings
+   * @param pSection The [Logger] or [Module:<Name>] section
+   * @param pDefault Values of the missing keys
+   * @return The flush policy
+   * @private
+   */
+  static FlushSettings ReadFlushSettings(
+      const boost::property_tree::ptree& pSection,
+      const FlushSettings& pDefault);
+
+  /**
+   * @brief Read the throttle keys of a section
+   * @memberof Settings
+   * @param pSection The [Logger] or [Module:<Name>] section
+   * @param pDefault Values of the missing keys
+   * @return The throttle
+   * @private
+   */
+  static ThrottleSettings ReadThrottleSettings(
+      const boost::property_tree::ptree& pSection,
+      const ThrottleSettings& pDefault);
+
+  /**
+   * @brief Read the retention keys of a section
+   * @memberof Settings
+   * @param pSection The [Logger] or [Module:<Name>] section
+   * @param pDefault Values of the missing keys
+   * @return The retention
+   * @private
+   */
+  static RetentionSettings ReadRetentionSettings(
+      const boost::property_tree::ptree& pSection,
+      const RetentionSettings& pDefault);
+
+  /**
+   * @brief Read the flight recorder keys of a section
+   * @memberof Settings
+   * @param pSection The [Logger] or [Module:<Name>] section
+   * @param pDefault Values of the missing keys
+   * @return The flight recorder
+   * @private
+   */
+  static FlightRecorderSettings ReadFlightRecorderSettings(
+      const boost::property_tree::ptree& pSection,
+      const FlightRecorderSettings& pDefault);
+
+  /**
+   * @brief Read the FileWriter key of a section
+   * @memberof Settings
+   * @param pSection The [Logger] or [Module:<Name>] section
+   * @param pDefault Value if the key is missing
+   * @return The file writer, throw if the value is unknown
+   * @private
+   */
+  static FileWriter ReadFileWriter(const boost::property_tree::ptree& pSection,
+                                   FileWriter pDefault);
+
+  /**
+   * @brief Read every [Module:<Name>] section
+   * @memberof Settings
+   * @param pSettingsTree The whole settings file
+   * @private
+   */
+  void ReadModulesSections(const boost::property_tree::ptree& pSettingsTree);
+
   /**
    * @brief Create a default settings file
    * @memberof Settings
@@ -191,6 +471,28 @@ class Settings {
    * @private
    */
   bool m_SettingsLoaded{false};
+
+  /**
+   * @brief Protect the reload listeners, they are registered from const
+   * references
+   * @memberof Settings
+   * @private
+   */
+  mutable std::mutex m_ListenersMutex{};
+
+  /**
+   * @brief Callbacks run after LoadSettings, by id
+   * @memberof Settings
+   * @private
+   */
+  mutable std::map<std::size_t, ReloadListener> m_ReloadListeners{};
+
+  /**
+   * @brief Id of the next reload listener
+   * @memberof Settings
+   * @private
+   */
+  mutable std::size_t m_NextListenerId{0};
 };
 
 /**
@@ -9,8 +9,11 @@
 
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/regex.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <string_view>
+#include <utility>
 
 #include "Constants.h"
 #include "Exceptions.h"
@@ -39,6 +42,207 @@ const boost::log::trivial::severity_level& Settings::GetSettingModuleLogLevel(
         "Module settings not found for module: " + pModuleName);
   }
 }
+
+boost::log::trivial::severity_level
+Settings::GetSettingModuleLogLevelOrDefault(
+    const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt != m_ModulesSettings.end() ? lIt->second.m_ModuleLogLevel
+                                        : m_LoggerSettings.m_SettingLogLevel;
+}
+
+bool Settings::GetSettingModuleEnabled(const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt == m_ModulesSettings.end() || lIt->second.m_Enabled;
+}
+
+const Settings::FlushSettings& Settings::GetSettingModuleFlush(
+    const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt != m_ModulesSettings.end() ? lIt->second.m_Flush
+                                        : m_LoggerSettings.m_Flush;
+}
+
+const Settings::ThrottleSettings& Settings::GetSettingModuleThrottle(
+    const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt != m_ModulesSettings.end() ? lIt->second.m_Throttle
+                                        : m_LoggerSettings.m_Throttle;
+}
+
+Settings::RetentionSettings Settings::GetSettingModuleRetention(
+    const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  if (lIt != m_ModulesSettings.end()) {
+    return lIt->second.m_Retention;
+  }
+  // The [Logger] quota applies to all the modules together
+  RetentionSettings lRet{m_LoggerSettings.m_Retention};
+  lRet.m_MaxBytes = 0;
+  return lRet;
+}
+
+const Settings::FlightRecorderSettings&
+Settings::GetSettingModuleFlightRecorder(const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt != m_ModulesSettings.end() ? lIt->second.m_FlightRecorder
+                                        : m_LoggerSettings.m_FlightRecorder;
+}
+
+Settings::FileWriter Settings::GetSettingModuleFileWriter(
+    const std::string& pModuleName) const {
+  auto lIt = m_ModulesSettings.find(pModuleName);
+  return lIt != m_ModulesSettings.end() ? lIt->second.m_FileWriter
+                                        : m_LoggerSettings.m_FileWriter;
+}
+
+Settings::FileWriter Settings::ReadFileWriter(
+    const boost::property_tree::ptree& pSection, FileWriter pDefault) {
+  const auto lValue{pSection.get_optional<std::string>("FileWriter")};
+  if (!lValue) {
+    return pDefault;
+  }
+  if (*lValue == "stdio") {
+    return FileWriter::Stdio;
+  }
+  if (*lValue == "mmap") {
+    return FileWriter::Mapped;
+  }
+  if (*lValue == "io_uring") {
+    return FileWriter::IoUring;
+  }
+  throw Exceptions::LoggerException(*lValue + "File writer unknown");
+}
+
+Settings::FlushSettings Settings::ReadFlushSettings(
+    const boost::property_tree::ptree& pSection,
+    const FlushSettings& pDefault) {
+  FlushSettings lRet{};
+  lRet.m_Bytes = pSection.get<std::size_t>("FlushBytes", pDefault.m_Bytes);
+  lRet.m_Records =
+      pSection.get<std::size_t>("FlushRecords", pDefault.m_Records);
+  lRet.m_IntervalMs =
+      pSection.get<std::uint32_t>("FlushIntervalMs", pDefault.m_IntervalMs);
+  lRet.m_Level = pSection.get<boost::log::trivial::severity_level>(
+      "FlushLevel", pDefault.m_Level);
+  lRet.m_Sync = pSection.get<bool>("FlushSync", pDefault.m_Sync);
+  return lRet;
+}
+
+Settings::FlightRecorderSettings Settings::ReadFlightRecorderSettings(
+    const boost::property_tree::ptree& pSection,
+    const FlightRecorderSettings& pDefault) {
+  FlightRecorderSettings lRet{};
+  lRet.m_Size =
+      pSection.get<std::size_t>("FlightRecorderSize", pDefault.m_Size);
+  lRet.m_Level = pSection.get<boost::log::trivial::severity_level>(
+      "FlightRecorderLevel", pDefault.m_Level);
+  lRet.m_Trigger = pSection.get<boost::log::trivial::severity_level>(
+      "FlightRecorderTrigger", pDefault.m_Trigger);
+  lRet.m_FileBacked =
+      pSection.get<bool>("FlightRecorderFileBacked", pDefault.m_FileBacked);
+  return lRet;
+}
+
+Settings::ThrottleSettings Settings::ReadThrottleSettings(
+    const boost::property_tree::ptree& pSection,
+    const ThrottleSettings& pDefault) {
+  ThrottleSettings lRet{};
+  lRet.m_RateLimit = pSection.get<double>("RateLimit", pDefault.m_RateLimit);
+  lRet.m_RateBurst =
+      pSection.get<std::uint32_t>("RateBurst", pDefault.m_RateBurst);
+  lRet.m_SampleRate = pSection.get<double>("SampleRate", pDefault.m_SampleRate);
+  lRet.m_SuppressDuplicates =
+      pSection.get<bool>("SuppressDuplicates", pDefault.m_SuppressDuplicates);
+  if (lRet.m_RateLimit < 0 || lRet.m_SampleRate < 0 ||
+      lRet.m_SampleRate > 1) {
+    throw Exceptions::LoggerException("Throttle settings out of range");
+  }
+  return lRet;
+}
+
+Settings::RetentionSettings Settings::ReadRetentionSettings(
+    const boost::property_tree::ptree& pSection,
+    const RetentionSettings& pDefault) {
+  RetentionSettings lRet{pDefault};
+  lRet.m_MaxDays =
+      pSection.get<std::uint16_t>("RetentionMaxDays", pDefault.m_MaxDays);
+  lRet.m_MaxBytes =
+      pSection.get<std::uint64_t>("RetentionMaxBytes", pDefault.m_MaxBytes);
+  lRet.m_MinFreeBytes = pSection.get<std::uint64_t>("RetentionMinFreeBytes",
+                                                    pDefault.m_MinFreeBytes);
+  lRet.m_TargetFreeBytes = pSection.get<std::uint64_t>(
+      "RetentionTargetFreeBytes", pDefault.m_TargetFreeBytes);
+  lRet.m_IntervalMs = pSection.get<std::uint32_t>("RetentionIntervalMs",
+                                                  pDefault.m_IntervalMs);
+  lRet.m_IoRate = pSection.get<std::uint64_t>("RetentionIoRate",
+                                              pDefault.m_IoRate);
+  lRet.m_Compress =
+      pSection.get<bool>("RetentionCompress", pDefault.m_Compress);
+  if (lRet.m_IntervalMs == 0) {
+    throw Exceptions::LoggerException("Retention interval out of range");
+  }
+  return lRet;
+}
+
+void Settings::ReadModulesSections(
+    const boost::property_tree::ptree& pSettingsTree) {
+  constexpr std::string_view lPrefix{"Module:"};
+
+  // Modules without their own section use the [Logger] values
+  for (auto& lModule : m_ModulesSettings) {
+    lModule.second.m_Flush = m_LoggerSettings.m_Flush;
+    lModule.second.m_Throttle = m_LoggerSettings.m_Throttle;
+    lModule.second.m_FileWriter = m_LoggerSettings.m_FileWriter;
+    lModule.second.m_Retention = m_LoggerSettings.m_Retention;
+    lModule.second.m_Retention.m_MaxBytes = 0;
+    lModule.second.m_FlightRecorder = m_LoggerSettings.m_FlightRecorder;
+  }
+
+  const boost::regex special_char_regex("[^a-zA-Z0-9_]");
+  for (const auto& lSection : pSettingsTree) {
+    if (lSection.first.compare(0, lPrefix.size(), lPrefix) != 0) {
+      continue;
+    }
+    const std::string lModuleName{lSection.first.substr(lPrefix.size())};
+    if (lModuleName.empty() ||
+        boost::regex_search(lModuleName, special_char_regex)) {
+      throw Exceptions::LoggerException(lModuleName +
+                                        "Module name ill formatted");
+    }
+
+    // A module only described by its section gets the default log level
+    auto lModule = m_ModulesSettings.find(lModuleName);
+    if (lModule == m_ModulesSettings.end()) {
+      ModuleSettings lModuleSettings{};
+      lModuleSettings.m_ModuleName = lModuleName;
+      lModuleSettings.m_ModuleLogLevel = m_LoggerSettings.m_SettingLogLevel;
+      lModule = m_ModulesSettings.emplace(lModuleName, lModuleSettings).first;
+    }
+    lModule->second.m_ModuleLogLevel =
+        lSection.second.get<boost::log::trivial::severity_level>(
+            "LogLevel", lModule->second.m_ModuleLogLevel);
+    lModule->second.m_Enabled = lSection.second.get<bool>("Enabled", true);
+    lModule->second.m_Flush =
+        ReadFlushSettings(lSection.second, m_LoggerSettings.m_Flush);
+    lModule->second.m_Throttle =
+        ReadThrottleSettings(lSection.second, m_LoggerSettings.m_Throttle);
+    lModule->second.m_FileWriter =
+        ReadFileWriter(lSection.second, m_LoggerSettings.m_FileWriter);
+    lModule->second.m_FlightRecorder = ReadFlightRecorderSettings(
+        lSection.second, m_LoggerSettings.m_FlightRecorder);
+
+    // Only the quota and the age are chosen per module, the disk and the
+    // retention thread are shared
+    const RetentionSettings lRetention{
+        ReadRetentionSettings(lSection.second, m_LoggerSettings.m_Retention)};
+    lModule->second.m_Retention = m_LoggerSettings.m_Retention;
+    lModule->second.m_Retention.m_MaxDays = lRetention.m_MaxDays;
+    lModule->second.m_Retention.m_MaxBytes =
+        lSection.second.get<std::uint64_t>("RetentionMaxBytes", 0);
+  }
+}
+
 void Settings::CreateDefaultSettingsFile() {
   // Create default settings
   // Default log path is LOGS/
@@ -53,6 +257,64 @@ void Settings::CreateDefaultSettingsFile() {
   lSettingsTree.put<boost::log::trivial::severity_level>(
       "Logger.LogLevel", boost::log::trivial::trace);
 
+  // Default flush policy writes every record immediately
+  m_LoggerSettings.m_Flush = FlushSettings{};
+  lSettingsTree.put<std::size_t>("Logger.FlushBytes",
+                                 m_LoggerSettings.m_Flush.m_Bytes);
+  lSettingsTree.put<std::size_t>("Logger.FlushRecords",
+                                 m_LoggerSettings.m_Flush.m_Records);
+  lSettingsTree.put<std::uint32_t>("Logger.FlushIntervalMs",
+                                   m_LoggerSettings.m_Flush.m_IntervalMs);
+  lSettingsTree.put<boost::log::trivial::severity_level>(
+      "Logger.FlushLevel", m_LoggerSettings.m_Flush.m_Level);
+  lSettingsTree.put<bool>("Logger.FlushSync", m_LoggerSettings.m_Flush.m_Sync);
+
+  // Default throttle writes every record
+  m_LoggerSettings.m_Throttle = ThrottleSettings{};
+  lSettingsTree.put<double>("Logger.RateLimit",
+                            m_LoggerSettings.m_Throttle.m_RateLimit);
+  lSettingsTree.put<std::uint32_t>("Logger.RateBurst",
+                                   m_LoggerSettings.m_Throttle.m_RateBurst);
+  lSettingsTree.put<double>("Logger.SampleRate",
+                            m_LoggerSettings.m_Throttle.m_SampleRate);
+  lSettingsTree.put<bool>("Logger.SuppressDuplicates",
+                          m_LoggerSettings.m_Throttle.m_SuppressDuplicates);
+
+  // Default file writer is buffered stdio
+  m_LoggerSettings.m_FileWriter = FileWriter::Stdio;
+  lSettingsTree.put<std::string>("Logger.FileWriter", "stdio");
+
+  // Default retention keeps 31 daily files without quota
+  m_LoggerSettings.m_Retention = RetentionSettings{};
+  lSettingsTree.put<std::uint16_t>("Logger.RetentionMaxDays",
+                                   m_LoggerSettings.m_Retention.m_MaxDays);
+  lSettingsTree.put<std::uint64_t>("Logger.RetentionMaxBytes",
+                                   m_LoggerSettings.m_Retention.m_MaxBytes);
+  lSettingsTree.put<std::uint64_t>(
+      "Logger.RetentionMinFreeBytes",
+      m_LoggerSettings.m_Retention.m_MinFreeBytes);
+  lSettingsTree.put<std::uint64_t>(
+      "Logger.RetentionTargetFreeBytes",
+      m_LoggerSettings.m_Retention.m_TargetFreeBytes);
+  lSettingsTree.put<std::uint32_t>("Logger.RetentionIntervalMs",
+                                   m_LoggerSettings.m_Retention.m_IntervalMs);
+  lSettingsTree.put<std::uint64_t>("Logger.RetentionIoRate",
+                                   m_LoggerSettings.m_Retention.m_IoRate);
+  lSettingsTree.put<bool>("Logger.RetentionCompress",
+                          m_LoggerSettings.m_Retention.m_Compress);
+
+  // Default flight recorder is disabled
+  m_LoggerSettings.m_FlightRecorder = FlightRecorderSettings{};
+  lSettingsTree.put<std::size_t>("Logger.FlightRecorderSize",
+                                 m_LoggerSettings.m_FlightRecorder.m_Size);
+  lSettingsTree.put<boost::log::trivial::severity_level>(
+      "Logger.FlightRecorderLevel", m_LoggerSettings.m_FlightRecorder.m_Level);
+  lSettingsTree.put<boost::log::trivial::severity_level>(
+      "Logger.FlightRecorderTrigger",
+      m_LoggerSettings.m_FlightRecorder.m_Trigger);
+  lSettingsTree.put<bool>("Logger.FlightRecorderFileBacked",
+                          m_LoggerSettings.m_FlightRecorder.m_FileBacked);
+
   // Default modules settings
   m_ModulesSettings.clear();
   for (const auto& lModule : Constants::c_ModuleNames) {
@@ -127,6 +389,20 @@ void Settings::LoadSettings() {
       }
     }
 
+    // Populate flush policy, throttle and file writer of LoggerSettings struct
+    // then of every module
+    m_LoggerSettings.m_Flush = ReadFlushSettings(
+        lSettingsTree.get_child("Logger"), FlushSettings{});
+    m_LoggerSettings.m_Throttle = ReadThrottleSettings(
+        lSettingsTree.get_child("Logger"), ThrottleSettings{});
+    m_LoggerSettings.m_FileWriter =
+        ReadFileWriter(lSettingsTree.get_child("Logger"), FileWriter::Stdio);
+    m_LoggerSettings.m_Retention = ReadRetentionSettings(
+        lSettingsTree.get_child("Logger"), RetentionSettings{});
+    m_LoggerSettings.m_FlightRecorder = ReadFlightRecorderSettings(
+        lSettingsTree.get_child("Logger"), FlightRecorderSettings{});
+    ReadModulesSections(lSettingsTree);
+
     // Check and Populate Server port of ServerSettings struct
     const std::uint16_t lServerPort{lSettingsTree.get<std::uint16_t>(
         "Server.Port")};  // Default port 0 is invalid
@@ -141,5 +417,27 @@ void Settings::LoadSettings() {
     // default settings file
     CreateDefaultSettingsFile();
   }
+
+  // Listeners run outside the lock, they may read the settings
+  std::map<std::size_t, ReloadListener> lListeners{};
+  {
+    std::lock_guard<std::mutex> lLock(m_ListenersMutex);
+    lListeners = m_ReloadListeners;
+  }
+  for (const auto& lListener : lListeners) {
+    lListener.second(*this);
+  }
+}
+
+std::size_t Settings::AddReloadListener(ReloadListener pListener) const {
+  std::lock_guard<std::mutex> lLock(m_ListenersMutex);
+  const std::size_t lId{m_NextListenerId++};
+  m_ReloadListeners.emplace(lId, std::move(pListener));
+  return lId;
+}
+
+void Settings::RemoveReloadListener(std::size_t pId) const {
+  std::lock_guard<std::mutex> lLock(m_ListenersMutex);
+  m_ReloadListeners.erase(pId);
 }
 }  // namespace Stroalgo::Configuration
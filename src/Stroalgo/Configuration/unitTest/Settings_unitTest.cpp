@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -35,12 +36,16 @@ class SettingsManagerTest : public ::testing::Test {
       const std::string_view pLogsPathFolder = "",
       const std::string_view pLogsLevel = "",
       const std::map<std::string, std::string> &pModules = {},
-      const std::map<std::string, std::string> &pServer = {}) {
+      const std::map<std::string, std::string> &pServer = {},
+      const std::map<std::string, std::string> &pLogger = {}) {
     std::ofstream lSettingsFile("settings.ini");
     if (lSettingsFile.is_open()) {
       lSettingsFile << "[Logger]" << std::endl;
       lSettingsFile << "LogPath=" << pLogsPathFolder << std::endl;
       lSettingsFile << "LogLevel=" << pLogsLevel << std::endl;
+      for (const auto &lSetting : pLogger) {
+        lSettingsFile << lSetting.first << "=" << lSetting.second << std::endl;
+      }
 
       if (!pModules.empty()) {
         lSettingsFile << "[Modules]" << std::endl;
@@ -62,6 +67,16 @@ class SettingsManagerTest : public ::testing::Test {
       std::cout << "Unable to create settings.ini file \n";
     }
   };
+
+  void AppendMockModuleSection(
+      const std::string_view pModuleName,
+      const std::map<std::string, std::string> &pSettings) {
+    std::ofstream lSettingsFile("settings.ini", std::ios::app);
+    lSettingsFile << "[Module:" << pModuleName << "]" << std::endl;
+    for (const auto &lSetting : pSettings) {
+      lSettingsFile << lSetting.first << "=" << lSetting.second << std::endl;
+    }
+  }
 };
 
 TEST_F(SettingsManagerTest, Instantiate_nothrow) {
@@ -501,3 +516,221 @@ TEST_F(SettingsManagerTest, LoadSettings_FileExists_ServerPortValid) {
                 .GetSettingsServerPort(),
             stoi(pServer.at("Port")));
 }
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_FlushDefaults) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  // Without Flush keys every record is flushed
+  const auto &lFlush{Stroalgo::Configuration::SettingsManager::GetInstance()
+                         .GetSettingModuleFlush("Module_Library")};
+  EXPECT_EQ(lFlush.m_Bytes, 0U);
+  EXPECT_EQ(lFlush.m_Records, 0U);
+  EXPECT_EQ(lFlush.m_IntervalMs, 0U);
+  EXPECT_EQ(lFlush.m_Level, boost::log::trivial::trace);
+  EXPECT_FALSE(lFlush.m_Sync);
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_FlushGlobalAndModule) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}},
+                         {{"FlushBytes", "65536"},
+                          {"FlushRecords", "128"},
+                          {"FlushIntervalMs", "200"},
+                          {"FlushLevel", "error"}});
+  AppendMockModuleSection("Module_Library",
+                          {{"FlushRecords", "16"}, {"FlushSync", "true"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  // Module section overrides its keys only
+  const auto &lModule{Stroalgo::Configuration::SettingsManager::GetInstance()
+                          .GetSettingModuleFlush("Module_Library")};
+  EXPECT_EQ(lModule.m_Bytes, 65536U);
+  EXPECT_EQ(lModule.m_Records, 16U);
+  EXPECT_EQ(lModule.m_IntervalMs, 200U);
+  EXPECT_EQ(lModule.m_Level, boost::log::trivial::error);
+  EXPECT_TRUE(lModule.m_Sync);
+
+  // Unknown module gets the [Logger] policy
+  const auto &lOther{Stroalgo::Configuration::SettingsManager::GetInstance()
+                         .GetSettingModuleFlush("Module_Unknown")};
+  EXPECT_EQ(lOther.m_Records, 128U);
+  EXPECT_FALSE(lOther.m_Sync);
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_RetentionGlobalAndModule) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}},
+                         {{"RetentionMaxDays", "7"},
+                          {"RetentionMaxBytes", "1000000"},
+                          {"RetentionMinFreeBytes", "5000"},
+                          {"RetentionIoRate", "1024"},
+                          {"RetentionCompress", "false"}});
+  AppendMockModuleSection("Module_Library", {{"RetentionMaxDays", "2"},
+                                             {"RetentionMaxBytes", "4096"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  const auto &lGlobal{Stroalgo::Configuration::SettingsManager::GetInstance()
+                          .GetSettingRetention()};
+  EXPECT_EQ(lGlobal.m_MaxDays, 7U);
+  EXPECT_EQ(lGlobal.m_MaxBytes, 1000000U);
+  EXPECT_EQ(lGlobal.m_MinFreeBytes, 5000U);
+  EXPECT_EQ(lGlobal.m_IntervalMs, 60000U);
+  EXPECT_EQ(lGlobal.m_IoRate, 1024U);
+  EXPECT_FALSE(lGlobal.m_Compress);
+
+  // Module section sets its age limit and its own quota
+  const auto lModule{Stroalgo::Configuration::SettingsManager::GetInstance()
+                         .GetSettingModuleRetention("Module_Library")};
+  EXPECT_EQ(lModule.m_MaxDays, 2U);
+  EXPECT_EQ(lModule.m_MaxBytes, 4096U);
+
+  // Unknown module gets the [Logger] age limit without quota
+  const auto lOther{Stroalgo::Configuration::SettingsManager::GetInstance()
+                        .GetSettingModuleRetention("Module_Unknown")};
+  EXPECT_EQ(lOther.m_MaxDays, 7U);
+  EXPECT_EQ(lOther.m_MaxBytes, 0U);
+}
+
+TEST_F(SettingsManagerTest,
+       LoadSettings_FileExists_FlightRecorderGlobalAndModule) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}},
+                         {{"FlightRecorderSize", "1048576"},
+                          {"FlightRecorderLevel", "debug"}});
+  AppendMockModuleSection("Module_Library",
+                          {{"FlightRecorderTrigger", "warning"},
+                           {"FlightRecorderFileBacked", "true"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  // Module section overrides its keys only
+  const auto &lModule{Stroalgo::Configuration::SettingsManager::GetInstance()
+                          .GetSettingModuleFlightRecorder("Module_Library")};
+  EXPECT_EQ(lModule.m_Size, 1048576U);
+  EXPECT_EQ(lModule.m_Level, boost::log::trivial::debug);
+  EXPECT_EQ(lModule.m_Trigger, boost::log::trivial::warning);
+  EXPECT_TRUE(lModule.m_FileBacked);
+
+  // Unknown module gets the [Logger] recorder
+  const auto &lOther{Stroalgo::Configuration::SettingsManager::GetInstance()
+                         .GetSettingModuleFlightRecorder("Module_Unknown")};
+  EXPECT_EQ(lOther.m_Size, 1048576U);
+  EXPECT_EQ(lOther.m_Trigger, boost::log::trivial::error);
+  EXPECT_FALSE(lOther.m_FileBacked);
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_ThrottleGlobalAndModule) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}},
+                         {{"RateLimit", "1000"}, {"SampleRate", "0.25"}});
+  AppendMockModuleSection("Module_Library", {{"RateBurst", "50"},
+                                             {"SuppressDuplicates", "true"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  // Module section overrides its keys only
+  const auto &lModule{Stroalgo::Configuration::SettingsManager::GetInstance()
+                          .GetSettingModuleThrottle("Module_Library")};
+  EXPECT_DOUBLE_EQ(lModule.m_RateLimit, 1000);
+  EXPECT_EQ(lModule.m_RateBurst, 50U);
+  EXPECT_DOUBLE_EQ(lModule.m_SampleRate, 0.25);
+  EXPECT_TRUE(lModule.m_SuppressDuplicates);
+
+  // Unknown module gets the [Logger] throttle
+  const auto &lOther{Stroalgo::Configuration::SettingsManager::GetInstance()
+                         .GetSettingModuleThrottle("Module_Unknown")};
+  EXPECT_EQ(lOther.m_RateBurst, 0U);
+  EXPECT_FALSE(lOther.m_SuppressDuplicates);
+
+  // Sample rate above 1 loads the default settings
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}}, {{"SampleRate", "2"}});
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+  EXPECT_DOUBLE_EQ(Stroalgo::Configuration::SettingsManager::GetInstance()
+                       .GetSettingModuleThrottle("Module_Library")
+                       .m_SampleRate,
+                   1);
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_FileWriter) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}}, {{"FileWriter", "mmap"}});
+  AppendMockModuleSection("Module_Library", {{"FileWriter", "io_uring"}});
+
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+
+  EXPECT_EQ(Stroalgo::Configuration::SettingsManager::GetInstance()
+                .GetSettingModuleFileWriter("Module_Library"),
+            Stroalgo::Configuration::Settings::FileWriter::IoUring);
+  EXPECT_EQ(Stroalgo::Configuration::SettingsManager::GetInstance()
+                .GetSettingModuleFileWriter("Module_Unknown"),
+            Stroalgo::Configuration::Settings::FileWriter::Mapped);
+
+  // Unknown writer loads the default settings
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}}, {{"FileWriter", "aio"}});
+  Stroalgo::Configuration::SettingsManager::GetInstance().LoadSettings();
+  EXPECT_EQ(Stroalgo::Configuration::SettingsManager::GetInstance()
+                .GetSettingModuleFileWriter("Module_Library"),
+            Stroalgo::Configuration::Settings::FileWriter::Stdio);
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_FileExists_ModuleLevelAndEnabled) {
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}});
+  AppendMockModuleSection("Module_Library",
+                          {{"LogLevel", "error"}, {"Enabled", "false"}});
+  AppendMockModuleSection("Module_Section", {{"FlushRecords", "8"}});
+
+  auto &lSettings{Stroalgo::Configuration::SettingsManager::GetInstance()};
+  lSettings.LoadSettings();
+
+  // The section overrides the [Modules] level
+  EXPECT_EQ(lSettings.GetSettingModuleLogLevelOrDefault("Module_Library"),
+            boost::log::trivial::error);
+  EXPECT_FALSE(lSettings.GetSettingModuleEnabled("Module_Library"));
+
+  // Module only described by its section gets the [Logger] level
+  EXPECT_EQ(lSettings.GetSettingModuleLogLevelOrDefault("Module_Section"),
+            boost::log::trivial::info);
+  EXPECT_TRUE(lSettings.GetSettingModuleEnabled("Module_Section"));
+
+  // Unknown module gets the [Logger] level without throwing
+  EXPECT_EQ(lSettings.GetSettingModuleLogLevelOrDefault("Module_Unknown"),
+            boost::log::trivial::info);
+  EXPECT_TRUE(lSettings.GetSettingModuleEnabled("Module_Unknown"));
+}
+
+TEST_F(SettingsManagerTest, LoadSettings_ReloadListeners) {
+  auto &lSettings{Stroalgo::Configuration::SettingsManager::GetInstance()};
+  int lCalls{0};
+  boost::log::trivial::severity_level lSeen{boost::log::trivial::trace};
+  const std::size_t lId{lSettings.AddReloadListener(
+      [&lCalls, &lSeen](const Stroalgo::Configuration::Settings &pSettings) {
+        ++lCalls;
+        lSeen = pSettings.GetSettingModuleLogLevelOrDefault("Module_Library");
+      })};
+
+  // Listeners see the reloaded values
+  CreateMockSettingsFile("LOGS", "info", {{"Module_Library", "warning"}},
+                         {{"Port", "9313"}});
+  lSettings.LoadSettings();
+  EXPECT_EQ(lCalls, 1);
+  EXPECT_EQ(lSeen, boost::log::trivial::warning);
+
+  // Default settings written after an error are reported too
+  CreateEmptySettingsFile();
+  lSettings.LoadSettings();
+  EXPECT_EQ(lCalls, 2);
+  EXPECT_EQ(lSeen, boost::log::trivial::trace);
+
+  // Removed listeners are not called anymore
+  lSettings.RemoveReloadListener(lId);
+  lSettings.LoadSettings();
+  EXPECT_EQ(lCalls, 2);
+}
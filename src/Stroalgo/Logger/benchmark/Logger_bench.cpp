@@ -0,0 +1,506 @@
+/**
+ * @file Logger_bench.cpp
+ * @brief Benchmarks of the Logger hot path and sinks
+ * @details Uses Google Benchmark. Modules are built directly on the sink under
+ * measure, without the console sink added by RegisterModule. Run the
+ * Logger_bench_json target to write the results as JSON.
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include <benchmark/benchmark.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "AsyncBackend.h"
+#include "BinaryFileSink.h"
+#include "DurationHistogram.h"
+#include "FieldFormatter.h"
+#include "LogMacros.h"
+#include "ModuleLevels.h"
+#include "ModuleLogger.h"
+#ifdef STROALGO_LOG_MAPPED_FILES
+#include "MappedFileSink.h"
+#endif
+#ifdef STROALGO_LOG_IO_URING
+#include "IoUring.h"
+#include "UringFileSink.h"
+#endif
+
+namespace {
+
+/**
+ * @brief Folder of the files written by the benchmarks
+ */
+const std::string c_BenchLogsPath{"Logs/Bench/"};
+
+/**
+ * @brief Module written by a benchmark, on a single sink
+ */
+class BenchModule {
+ public:
+  /**
+   * @brief Construct a module writing into a sink
+   *
+   * @param pName Name of the module
+   * @param pSink The sink under measure
+   */
+  BenchModule(const std::string &pName, spdlog::sink_ptr pSink)
+      : m_Sink(std::move(pSink)),
+        m_Logger(std::make_shared<spdlog::logger>(pName, m_Sink)) {
+    m_Logger->set_level(spdlog::level::trace);
+    m_Logger->flush_on(spdlog::level::off);
+    m_Context.m_Name = pName;
+    m_Context.m_Logger = m_Logger;
+    m_Context.m_ActiveBackend = &m_Backend;
+    m_Context.m_Threshold = &m_Threshold;
+  }
+
+  BenchModule(const BenchModule &) = delete;
+  BenchModule &operator=(const BenchModule &) = delete;
+
+  /**
+   * @brief Destroy the Bench Module object, queued records are written
+   *
+   */
+  ~BenchModule() { DisableAsync(); }
+
+  /**
+   * @brief Queue the records to a backend thread
+   *
+   * @param pOptions Options of the backend
+   */
+  void EnableAsync(const Stroalgo::Log::AsyncOptions &pOptions) {
+    m_AsyncBackend = std::make_unique<Stroalgo::Log::AsyncBackend>(pOptions);
+    m_Backend.store(m_AsyncBackend.get(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Write the queued records and go back to synchronous writes
+   *
+   */
+  void DisableAsync() {
+    m_Backend.store(nullptr, std::memory_order_release);
+    m_AsyncBackend.reset();
+  }
+
+  /**
+   * @brief Wait for the queued records then flush the sink
+   *
+   */
+  void Flush() {
+    if (m_AsyncBackend != nullptr) {
+      m_AsyncBackend->Drain();
+    }
+    m_Logger->flush();
+  }
+
+  /**
+   * @brief Get a handle to write the module logs
+   *
+   * @return The handle
+   */
+  Stroalgo::Log::ModuleLogger Handle() {
+    return Stroalgo::Log::ModuleLogger{&m_Context};
+  }
+
+  /**
+   * @brief Runtime level of the module
+   */
+  Stroalgo::Log::ModuleThreshold m_Threshold{0};
+
+ private:
+  /**
+   * @brief The sink under measure
+   */
+  spdlog::sink_ptr m_Sink;
+
+  /**
+   * @brief spdlog logger owning the sink
+   */
+  std::shared_ptr<spdlog::logger> m_Logger;
+
+  /**
+   * @brief Backend used by the module, null for synchronous writes
+   */
+  std::atomic<Stroalgo::Log::AsyncBackend *> m_Backend{nullptr};
+
+  /**
+   * @brief Backend of the asynchronous writes
+   */
+  std::unique_ptr<Stroalgo::Log::AsyncBackend> m_AsyncBackend{nullptr};
+
+  /**
+   * @brief Context written through the handles
+   */
+  Stroalgo::Log::ModuleContext m_Context{};
+};
+
+/**
+ * @brief Log-linear histogram of latencies, 32 buckets per power of two so
+ * percentiles are within 3 %
+ */
+class LatencyHistogram {
+ public:
+  /**
+   * @brief Count a latency
+   *
+   * @param pNanoseconds The latency
+   */
+  void Record(std::uint64_t pNanoseconds) {
+    ++m_Buckets[BucketOf(pNanoseconds)];
+    ++m_Count;
+  }
+
+  /**
+   * @brief Add the latencies of another histogram
+   *
+   * @param pOther Histogram to add
+   */
+  void Merge(const LatencyHistogram &pOther) {
+    for (std::size_t lBucket = 0; lBucket < m_Buckets.size(); ++lBucket) {
+      m_Buckets[lBucket] += pOther.m_Buckets[lBucket];
+    }
+    m_Count += pOther.m_Count;
+  }
+
+  /**
+   * @brief Get a percentile of the recorded latencies
+   *
+   * @param pRatio Percentile as a ratio, 0.99 for p99
+   * @return Upper bound of the bucket holding the percentile, in nanoseconds
+   */
+  double Percentile(double pRatio) const {
+    const auto lRank{static_cast<std::uint64_t>(
+        pRatio * static_cast<double>(m_Count))};
+    std::uint64_t lSeen{0};
+    for (std::size_t lBucket = 0; lBucket < m_Buckets.size(); ++lBucket) {
+      lSeen += m_Buckets[lBucket];
+      if (lSeen > lRank) {
+        return static_cast<double>(UpperBoundOf(lBucket));
+      }
+    }
+    return 0;
+  }
+
+ private:
+  static constexpr std::size_t c_SubBits{5};
+  static constexpr std::size_t c_SubBuckets{std::size_t{1} << c_SubBits};
+
+  /**
+   * @brief Get the bucket of a latency
+   *
+   * @param pValue The latency
+   * @return Index of the bucket
+   */
+  static std::size_t BucketOf(std::uint64_t pValue) {
+    if (pValue < c_SubBuckets) {
+      return pValue;
+    }
+    const std::size_t lExponent{Stroalgo::Log::GetBitLength(pValue) - 1};
+    const std::size_t lSub{(pValue >> (lExponent - c_SubBits)) &
+                           (c_SubBuckets - 1)};
+    return (lExponent - c_SubBits + 1) * c_SubBuckets + lSub;
+  }
+
+  /**
+   * @brief Get the largest latency of a bucket
+   *
+   * @param pBucket Index of the bucket
+   * @return The latency
+   */
+  static std::uint64_t UpperBoundOf(std::size_t pBucket) {
+    if (pBucket < c_SubBuckets) {
+      return pBucket;
+    }
+    const std::size_t lExponent{pBucket / c_SubBuckets + c_SubBits - 1};
+    const std::uint64_t lSub{pBucket % c_SubBuckets + c_SubBuckets};
+    return ((lSub + 1) << (lExponent - c_SubBits)) - 1;
+  }
+
+  /**
+   * @brief Number of latencies in each bucket
+   */
+  std::array<std::uint64_t, (64 - c_SubBits + 1) * c_SubBuckets> m_Buckets{};
+
+  /**
+   * @brief Number of latencies recorded
+   */
+  std::uint64_t m_Count{0};
+};
+
+/**
+ * @brief Create the text file sink of the Logger
+ *
+ * @param pName Name of the file
+ * @return The sink
+ */
+spdlog::sink_ptr MakeTextSink(const std::string &pName) {
+  auto lSink{std::make_shared<spdlog::sinks::daily_file_sink_mt>(
+      c_BenchLogsPath + pName + ".txt", 0, 0)};
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Text, Stroalgo::Log::LogFields{}));
+  return lSink;
+}
+
+/**
+ * @brief Create the JSON file sink of the Logger
+ *
+ * @param pName Name of the file
+ * @return The sink
+ */
+spdlog::sink_ptr MakeJsonSink(const std::string &pName) {
+  auto lSink{std::make_shared<spdlog::sinks::daily_file_sink_mt>(
+      c_BenchLogsPath + pName + ".json", 0, 0)};
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Json,
+      Stroalgo::Log::LogFields{true, true, true, true, true}));
+  return lSink;
+}
+
+/**
+ * @brief Create the binary file sink of the Logger
+ *
+ * @param pName Name of the file
+ * @return The sink
+ */
+spdlog::sink_ptr MakeBinarySink(const std::string &pName) {
+  return std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      c_BenchLogsPath + pName + ".slog", pName, 0);
+}
+
+#ifdef STROALGO_LOG_MAPPED_FILES
+/**
+ * @brief Create the memory mapped text file sink of the Logger
+ *
+ * @param pName Name of the file
+ * @return The sink
+ */
+spdlog::sink_ptr MakeMappedSink(const std::string &pName) {
+  auto lSink{std::make_shared<Stroalgo::Log::MappedFileSink>(
+      c_BenchLogsPath + pName + ".txt")};
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Text, Stroalgo::Log::LogFields{}));
+  return lSink;
+}
+#endif
+
+#ifdef STROALGO_LOG_IO_URING
+/**
+ * @brief Create the io_uring text file sink of the Logger
+ *
+ * @param pName Name of the file
+ * @return The sink
+ */
+spdlog::sink_ptr MakeUringSink(const std::string &pName) {
+  auto lSink{std::make_shared<Stroalgo::Log::UringFileSink>(
+      c_BenchLogsPath + pName + ".txt")};
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Text, Stroalgo::Log::LogFields{}));
+  return lSink;
+}
+#endif
+
+/**
+ * @brief Create a sink discarding every record
+ *
+ * @return The sink
+ */
+spdlog::sink_ptr MakeNullSink(const std::string &) {
+  return std::make_shared<spdlog::sinks::null_sink_mt>();
+}
+
+/**
+ * @brief Module shared by the threads of the multi-producer benchmarks,
+ * asynchronous on a text file
+ *
+ * @return The module, alive until the end of the program
+ */
+BenchModule &SharedAsyncModule() {
+  static BenchModule lModule{[]() {
+    std::filesystem::create_directories(c_BenchLogsPath);
+    return BenchModule{"Bench_Producers", MakeTextSink("Bench_Producers")};
+  }()};
+  return lModule;
+}
+
+/**
+ * @brief Latencies of all the threads of a multi-producer run
+ * @struct MergedLatencies
+ */
+struct MergedLatencies {
+  /**
+   * @brief Protects the histogram and the number of threads merged
+   */
+  std::mutex m_Mutex{};
+
+  /**
+   * @brief Signaled when a thread merged its latencies
+   */
+  std::condition_variable m_Merged{};
+
+  /**
+   * @brief Latencies of the threads merged so far
+   */
+  LatencyHistogram m_Histogram{};
+
+  /**
+   * @brief Number of threads merged so far
+   */
+  int m_Threads{0};
+};
+
+/**
+ * @brief Latencies shared by the threads of the multi-producer benchmarks
+ *
+ * @return The latencies, alive until the end of the program
+ */
+MergedLatencies &SharedLatencies() {
+  static MergedLatencies sLatencies{};
+  return sLatencies;
+}
+
+}  // namespace
+
+// Cost of a call written into a sink doing nothing
+static void BM_EnabledLevel(benchmark::State &pState) {
+  BenchModule lModule{"Bench_Enabled", MakeNullSink("")};
+  auto lHandle{lModule.Handle()};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    STROALGO_LOG_INFO(lHandle, "Order {} filled at {}", ++lValue, 101.25);
+  }
+}
+BENCHMARK(BM_EnabledLevel);
+
+// Cost of a call below the runtime level of its module
+static void BM_DisabledLevel(benchmark::State &pState) {
+  BenchModule lModule{"Bench_Disabled", MakeNullSink("")};
+  lModule.m_Threshold.store(spdlog::level::warn);
+  auto lHandle{lModule.Handle()};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    STROALGO_LOG_DEBUG(lHandle, "Order {} filled at {}", ++lValue, 101.25);
+    benchmark::DoNotOptimize(lValue);
+  }
+}
+BENCHMARK(BM_DisabledLevel);
+
+// Cost of a call of a disabled module
+static void BM_DisabledModule(benchmark::State &pState) {
+  BenchModule lModule{"Bench_Off", MakeNullSink("")};
+  lModule.m_Threshold.store(Stroalgo::Log::c_ModuleDisabled);
+  auto lHandle{lModule.Handle()};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    STROALGO_LOG_ERROR(lHandle, "Order {} filled at {}", ++lValue, 101.25);
+    benchmark::DoNotOptimize(lValue);
+  }
+}
+BENCHMARK(BM_DisabledModule);
+
+// Cost of a synchronous call for each sink type, flushed by the OS buffers
+static void BM_Sink(
+    benchmark::State &pState,
+    const std::function<spdlog::sink_ptr(const std::string &)> &pMakeSink) {
+  std::filesystem::create_directories(c_BenchLogsPath);
+  BenchModule lModule{"Bench_Sink", pMakeSink("Bench_Sink")};
+  auto lHandle{lModule.Handle()};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    lHandle.Info("Order {} filled at {}", ++lValue, 101.25);
+  }
+  lModule.Flush();
+  pState.SetItemsProcessed(pState.iterations());
+}
+BENCHMARK_CAPTURE(BM_Sink, Text, MakeTextSink);
+BENCHMARK_CAPTURE(BM_Sink, Json, MakeJsonSink);
+BENCHMARK_CAPTURE(BM_Sink, Binary, MakeBinarySink);
+#ifdef STROALGO_LOG_MAPPED_FILES
+BENCHMARK_CAPTURE(BM_Sink, Mapped, MakeMappedSink);
+#endif
+#ifdef STROALGO_LOG_IO_URING
+BENCHMARK_CAPTURE(BM_Sink, Uring, MakeUringSink);
+#endif
+
+// Throughput and latency of the callers when several threads queue records
+// to the backend, percentiles are those of the latencies of all the threads
+static void BM_Producers(benchmark::State &pState) {
+  BenchModule &lModule{SharedAsyncModule()};
+  MergedLatencies &lMerged{SharedLatencies()};
+  if (pState.thread_index() == 0) {
+    // No thread merges before the end of the loop
+    lMerged.m_Histogram = LatencyHistogram{};
+    lMerged.m_Threads = 0;
+    Stroalgo::Log::AsyncOptions lOptions{};
+    lOptions.m_ThreadLocalBuffers = pState.range(0) != 0;
+    lModule.EnableAsync(lOptions);
+  }
+  auto lHandle{lModule.Handle()};
+  LatencyHistogram lLatencies{};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    const auto lStart{std::chrono::steady_clock::now()};
+    lHandle.Info("Order {} filled at {}", ++lValue, 101.25);
+    const auto lEnd{std::chrono::steady_clock::now()};
+    lLatencies.Record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(lEnd - lStart)
+            .count()));
+  }
+  pState.SetItemsProcessed(pState.iterations());
+  std::unique_lock<std::mutex> lLock(lMerged.m_Mutex);
+  lMerged.m_Histogram.Merge(lLatencies);
+  ++lMerged.m_Threads;
+  lMerged.m_Merged.notify_all();
+  if (pState.thread_index() == 0) {
+    // Counters of the threads are summed, only the first one reports
+    lMerged.m_Merged.wait(lLock, [&lMerged, &pState]() {
+      return lMerged.m_Threads == pState.threads();
+    });
+    pState.counters["p50_ns"] = lMerged.m_Histogram.Percentile(0.5);
+    pState.counters["p99_ns"] = lMerged.m_Histogram.Percentile(0.99);
+    pState.counters["p99.9_ns"] = lMerged.m_Histogram.Percentile(0.999);
+    lLock.unlock();
+    lModule.DisableAsync();
+  }
+}
+BENCHMARK(BM_Producers)
+    ->ArgName("ThreadLocalBuffers")
+    ->Arg(0)
+    ->Arg(1)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(64)
+    ->UseRealTime();
+
+// Records per second written to disk, the queue is drained and the file
+// flushed after every batch
+static void BM_EndToEnd(benchmark::State &pState) {
+  constexpr std::int64_t lBatch{1000};
+  std::filesystem::create_directories(c_BenchLogsPath);
+  BenchModule lModule{"Bench_EndToEnd", MakeTextSink("Bench_EndToEnd")};
+  lModule.EnableAsync(Stroalgo::Log::AsyncOptions{});
+  auto lHandle{lModule.Handle()};
+  std::int64_t lValue{0};
+  for (auto _ : pState) {
+    for (std::int64_t lRecord = 0; lRecord < lBatch; ++lRecord) {
+      lHandle.Info("Order {} filled at {}", ++lValue, 101.25);
+    }
+    lModule.Flush();
+  }
+  pState.SetItemsProcessed(pState.iterations() * lBatch);
+}
+BENCHMARK(BM_EndToEnd)->UseRealTime();
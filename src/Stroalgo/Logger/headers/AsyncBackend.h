@@ -0,0 +1,375 @@
+/**
+ * @file        AsyncBackend.h
+ * @author      ALLOGHO
+ * @brief       Asynchronous front-end for the Logger
+ * @details     Callers push records into a lock-free ring buffer, or into a
+ *              ring buffer of their own thread, a dedicated thread drains
+ *              them into the spdlog sinks
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_ASYNCBACKEND_H_
+#define STROALGO_LOGGER_HEADERS_ASYNCBACKEND_H_
+
+#include <spdlog/common.h>
+#include <spdlog/details/os.h>
+#include <spdlog/logger.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "LogClock.h"
+#include "LogRecord.h"
+#include "MpscRingBuffer.h"
+#include "SpscRingBuffer.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Options of the asynchronous mode
+ * @struct AsyncOptions
+ */
+struct AsyncOptions {
+  /**
+   * @brief Number of records the queue can hold (rounded to a power of two)
+   */
+  std::size_t m_QueueCapacity{8192};
+
+  /**
+   * @brief What producers do when the queue is full
+   */
+  OverflowPolicy m_OverflowPolicy{OverflowPolicy::Block};
+
+  /**
+   * @brief Time the backend sleeps when it finds the queue empty
+   */
+  std::chrono::microseconds m_IdleSleep{200};
+
+  /**
+   * @brief Copy the arguments and format them on the backend thread when
+   * their types allow it (see IsDeferrableArg)
+   */
+  bool m_DeferFormatting{false};
+
+  /**
+   * @brief Give each producer thread its own queue, no cache line is shared
+   * between producers. The backend merges the queues by time.
+   * @note The drop-oldest policy drops the newest record instead, a producer
+   * cannot evict from a queue read by the backend
+   */
+  bool m_ThreadLocalBuffers{false};
+
+  /**
+   * @brief Number of records the queue of a thread can hold (rounded to a
+   * power of two)
+   */
+  std::size_t m_ThreadBufferCapacity{1024};
+};
+
+/**
+ * @brief Queue of the records of a producer thread
+ * @struct ThreadStagingBuffer
+ */
+struct ThreadStagingBuffer {
+  /**
+   * @brief Construct a new Thread Staging Buffer object
+   *
+   * @param pCapacity Number of records the queue can hold
+   */
+  explicit ThreadStagingBuffer(std::size_t pCapacity) : m_Records(pCapacity) {}
+
+  /**
+   * @brief Records written by the thread, read by the backend
+   */
+  SpscRingBuffer<LogRecord> m_Records;
+
+  /**
+   * @brief The thread has exited, the buffer is released once empty
+   */
+  std::atomic<bool> m_Closed{false};
+};
+
+/**
+ * @brief Loss counters of the asynchronous mode
+ * @struct AsyncCounters
+ */
+struct AsyncCounters {
+  /**
+   * @brief Records discarded by the drop-newest policy
+   */
+  std::uint64_t m_DroppedNewest{0};
+
+  /**
+   * @brief Records evicted by the drop-oldest policy
+   */
+  std::uint64_t m_DroppedOldest{0};
+
+  /**
+   * @brief Records whose producer waited for room with the block policy
+   */
+  std::uint64_t m_Blocked{0};
+
+  /**
+   * @brief Highest number of records seen waiting by the backend
+   */
+  std::size_t m_QueueHighWater{0};
+};
+
+/**
+ * @class AsyncBackend
+ * @brief Owns the record queue and the thread writing records to the sinks
+ *
+ */
+class AsyncBackend {
+ public:
+  /**
+   * @brief Construct a new Async Backend object and start its thread
+   *
+   * @param pOptions Queue and overflow options
+   */
+  explicit AsyncBackend(const AsyncOptions &pOptions);
+
+  /**
+   * @brief Destroy the Async Backend object, pending records are written
+   *
+   */
+  virtual ~AsyncBackend();
+
+  AsyncBackend(const AsyncBackend &) = delete;
+  AsyncBackend &operator=(const AsyncBackend &) = delete;
+
+  /**
+   * @brief Format a message on the caller thread, or capture its arguments
+   * in deferred mode, and queue it
+   *
+   * @tparam Args Type
+   * @param pLogger Logger owning the destination sinks
+   * @param pCounters Counters of the module producing the record
+   * @param pLogLevel The log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   * @return false if the record was dropped by the drop-newest policy
+   */
+  template <typename... Args>
+  inline bool Submit(spdlog::logger *pLogger, ModuleCounters *pCounters,
+                     const spdlog::level::level_enum pLogLevel,
+                     const spdlog::format_string_t<Args...> &pFormat,
+                     Args &&...pArgs) {
+    LogRecord lRecord;
+    lRecord.m_Logger = pLogger;
+    lRecord.m_Counters = pCounters;
+    lRecord.m_Level = pLogLevel;
+    lRecord.m_Time = LogClockNow();
+    lRecord.m_ThreadId = spdlog::details::os::thread_id();
+    if constexpr ((IsDeferrableArg<Args>() && ...)) {
+      if (!m_Options.m_DeferFormatting ||
+          !lRecord.Capture<Args...>(pFormat, pArgs...)) {
+        lRecord.Format(pFormat, std::forward<Args>(pArgs)...);
+      }
+    } else {
+      lRecord.Format(pFormat, std::forward<Args>(pArgs)...);
+    }
+    return Submit(std::move(lRecord));
+  }
+
+  /**
+   * @brief Queue a message followed by its structured fields
+   *
+   * @param pLogger Logger owning the destination sinks
+   * @param pCounters Counters of the module producing the record
+   * @param pLogLevel The log level
+   * @param pPayload Formatted message and encoded fields
+   * @return false if the record was dropped by the drop-newest policy
+   */
+  inline bool SubmitStructured(spdlog::logger *pLogger,
+                               ModuleCounters *pCounters,
+                               const spdlog::level::level_enum pLogLevel,
+                               std::string_view pPayload) {
+    LogRecord lRecord;
+    lRecord.m_Logger = pLogger;
+    lRecord.m_Counters = pCounters;
+    lRecord.m_Level = pLogLevel;
+    lRecord.m_Time = LogClockNow();
+    lRecord.m_ThreadId = spdlog::details::os::thread_id();
+    lRecord.m_Structured = true;
+    lRecord.Format<std::string_view>("{}", std::string_view{pPayload});
+    return Submit(std::move(lRecord));
+  }
+
+  /**
+   * @brief Queue an already built record
+   *
+   * @param pRecord The record to queue
+   * @return false if the record was dropped by the drop-newest policy
+   */
+  bool Submit(LogRecord &&pRecord);
+
+  /**
+   * @brief Wait until every record queued before the call has been written
+   *
+   */
+  void Drain();
+
+  /**
+   * @brief Write pending records and stop the backend thread
+   *
+   */
+  void Stop();
+
+  /**
+   * @brief Get the loss and backpressure counters
+   *
+   * @return Number of records dropped by each overflow policy, or delayed
+   */
+  AsyncCounters GetCounters() const;
+
+ private:
+  /**
+   * @brief Get the queue of the calling thread, registered on first use
+   *
+   * @return The queue owned by this backend
+   */
+  ThreadStagingBuffer &GetThreadBuffer();
+
+  /**
+   * @brief Write the oldest records of the thread queues, in time order
+   *
+   * @param pBuffers Thread queues known by the backend thread
+   * @return Number of records written
+   */
+  std::size_t MergeThreadBuffers(
+      const std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers);
+
+  /**
+   * @brief Release the queues of the exited threads once empty
+   *
+   * @param pBuffers Thread queues known by the backend thread
+   */
+  void ReleaseThreadBuffers(
+      std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers);
+
+  /**
+   * @brief Update the high-water mark with the records currently waiting
+   *
+   * @param pBuffers Thread queues known by the backend thread
+   */
+  void UpdateQueueHighWater(
+      const std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers);
+
+  /**
+   * @brief Backend thread loop
+   *
+   */
+  void Run();
+
+  /**
+   * @brief Write a record into the sinks of its logger
+   *
+   * @param pRecord The record to write
+   */
+  void Dispatch(const LogRecord &pRecord);
+
+  /**
+   * @brief Maximum number of records written between two counter updates
+   * @private
+   */
+  static constexpr std::size_t c_MaxBatchSize{256};
+
+  /**
+   * @brief Options used at construction
+   * @private
+   */
+  const AsyncOptions m_Options;
+
+  /**
+   * @brief Identifier telling the backends apart in the thread caches
+   * @private
+   */
+  const std::uint64_t m_Id;
+
+  /**
+   * @brief Queue of records waiting to be written
+   * @private
+   */
+  MpscRingBuffer<LogRecord> m_Queue;
+
+  /**
+   * @brief Protects the registered thread queues
+   * @private
+   */
+  std::mutex m_BuffersMutex{};
+
+  /**
+   * @brief Registered thread queues
+   * @private
+   */
+  std::vector<std::shared_ptr<ThreadStagingBuffer>> m_Buffers{};
+
+  /**
+   * @brief Incremented when a thread queue is registered or released
+   * @private
+   */
+  std::atomic<std::size_t> m_BuffersVersion{0};
+
+  /**
+   * @brief Number of queued records already written or evicted
+   * @private
+   */
+  std::atomic<std::size_t> m_Completed{0};
+
+  /**
+   * @brief Records discarded by the drop-newest policy
+   * @private
+   */
+  std::atomic<std::uint64_t> m_DroppedNewest{0};
+
+  /**
+   * @brief Records evicted by the drop-oldest policy
+   * @private
+   */
+  std::atomic<std::uint64_t> m_DroppedOldest{0};
+
+  /**
+   * @brief Records whose producer waited for room
+   * @private
+   */
+  std::atomic<std::uint64_t> m_Blocked{0};
+
+  /**
+   * @brief Highest number of waiting records, written by the backend thread
+   * @private
+   */
+  std::atomic<std::size_t> m_QueueHighWater{0};
+
+  /**
+   * @brief Flag keeping the backend thread alive
+   * @private
+   */
+  std::atomic<bool> m_Running{true};
+
+  /**
+   * @brief Backend thread
+   * @private
+   */
+  std::thread m_Thread;
+
+  /**
+   * @brief Buffer receiving the message of deferred records
+   * @private
+   */
+  fmt::memory_buffer m_DeferredPayload{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_ASYNCBACKEND_H_
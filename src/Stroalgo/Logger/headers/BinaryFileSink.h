@@ -0,0 +1,207 @@
+/**
+ * @file        BinaryFileSink.h
+ * @author      ALLOGHO
+ * @brief       spdlog sink writing daily binary log files
+ * @details     See BinaryLogFormat.h for the layout, stroalgo-logcat converts
+ *              the files to text or JSON. A time index is written along with
+ *              every file, see BinaryLogIndex.h
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_BINARYFILESINK_H_
+#define STROALGO_LOGGER_HEADERS_BINARYFILESINK_H_
+
+#include <spdlog/details/file_helper.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "BinaryLogIndex.h"
+#include "RecordSink.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @class BinaryFileSink
+ * @brief Write records in a new binary file every day at 00:00
+ *
+ */
+class BinaryFileSink final : public spdlog::sinks::base_sink<std::mutex>,
+                             public RecordSink {
+ public:
+  /**
+   * @brief Construct a new Binary File Sink object and open today's file
+   *
+   * @param pBaseFilename Path without date, "Logs/M/M.slog" writes
+   * "Logs/M/M_YYYY-MM-DD.slog"
+   * @param pModuleName Name of the module written in the file header
+   * @param pModuleId Registration id of the module
+   * @param pMaxFiles Number of daily files kept, 0 keeps all of them
+   */
+  BinaryFileSink(const std::string &pBaseFilename,
+                 const std::string &pModuleName, std::uint32_t pModuleId,
+                 std::uint16_t pMaxFiles = 0);
+
+  /**
+   * @brief Store a record, deferred arguments are written without being
+   * formatted
+   *
+   * @param pRecord The record to store
+   */
+  void WriteRecord(const LogRecord &pRecord) override;
+
+  /**
+   * @brief Empty the current file and its index, its header is written again
+   *
+   */
+  void Truncate();
+
+  /**
+   * @brief Get the path of the file currently written
+   *
+   * @return Path of today's file
+   */
+  std::string GetFilename();
+
+  /**
+   * @brief Get the number of bytes written, every file included
+   *
+   * @return Bytes written since construction
+   */
+  inline std::uint64_t GetWrittenBytes() const {
+    return m_WrittenBytes.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  /**
+   * @brief Store a formatted message
+   *
+   * @param pMsg The message
+   */
+  void sink_it_(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Flush the current file
+   *
+   */
+  void flush_() override;
+
+ private:
+  /**
+   * @brief Encode a record entry then write it, the mutex must be held
+   *
+   * @param pTime Time of the record
+   * @param pLevel Level of the record
+   * @param pThreadId Thread which produced the record
+   * @param pFormat Format string of deferred arguments, null for text
+   * @param pPayload Formatted text or deferred arguments
+   * @param pStructured The text is followed by structured fields
+   */
+  void WriteEntry(spdlog::log_clock::time_point pTime,
+                  spdlog::level::level_enum pLevel, std::size_t pThreadId,
+                  std::string_view pFormat, std::string_view pPayload,
+                  bool pStructured);
+
+  /**
+   * @brief Open the file of the record day when needed, the mutex must be held
+   *
+   * @param pTime Time of the record about to be written
+   */
+  void RotateIfNeeded(spdlog::log_clock::time_point pTime);
+
+  /**
+   * @brief Write the file header if the file is empty, the mutex must be held
+   *
+   */
+  void WriteHeaderIfEmpty();
+
+  /**
+   * @brief Path without date
+   * @private
+   * @memberof BinaryFileSink
+   */
+  const std::string m_BaseFilename;
+
+  /**
+   * @brief Name of the module written in the file header
+   * @private
+   * @memberof BinaryFileSink
+   */
+  const std::string m_ModuleName;
+
+  /**
+   * @brief Registration id of the module
+   * @private
+   * @memberof BinaryFileSink
+   */
+  const std::uint32_t m_ModuleId;
+
+  /**
+   * @brief Number of daily files kept
+   * @private
+   * @memberof BinaryFileSink
+   */
+  const std::uint16_t m_MaxFiles;
+
+  /**
+   * @brief Time at which the next file is opened
+   * @private
+   * @memberof BinaryFileSink
+   */
+  spdlog::log_clock::time_point m_NextRotation{};
+
+  /**
+   * @brief File currently written
+   * @private
+   * @memberof BinaryFileSink
+   */
+  spdlog::details::file_helper m_File{};
+
+  /**
+   * @brief Size of the current file, offset of the next entry
+   * @private
+   * @memberof BinaryFileSink
+   */
+  std::uint64_t m_Offset{0};
+
+  /**
+   * @brief Bytes written since construction, read without the sink mutex
+   * @private
+   * @memberof BinaryFileSink
+   */
+  std::atomic<std::uint64_t> m_WrittenBytes{0};
+
+  /**
+   * @brief Index of the current file
+   * @private
+   * @memberof BinaryFileSink
+   */
+  BinaryLogIndexWriter m_Index{};
+
+  /**
+   * @brief Format strings already written in the current file, by address
+   * of their interned copy (InternFormat), unique to each content
+   * @private
+   * @memberof BinaryFileSink
+   */
+  std::unordered_map<const char *, std::uint32_t> m_Formats{};
+
+  /**
+   * @brief Buffer reused to encode entries
+   * @private
+   * @memberof BinaryFileSink
+   */
+  spdlog::memory_buf_t m_Buffer{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_BINARYFILESINK_H_
@@ -0,0 +1,390 @@
+/**
+ * @file        BinaryLogFormat.h
+ * @author      ALLOGHO
+ * @brief       Layout of the binary log files and their reader
+ * @details     A file starts with a header naming its module, followed by
+ *              entries. Format strings are written once in a dictionary entry
+ *              before the first record using them. Integers are little-endian.
+ *
+ *              Header : magic "SLOG", u16 version, u32 module id,
+ *                       u32 name length, name
+ *              Format : u8 kind (1), u32 format id, u32 length, format string
+ *              Record : u8 kind (2), i64 time (ns since epoch), u8 level,
+ *                       u32 module id, u64 thread id, u32 format id,
+ *                       u32 payload length, payload
+ *
+ *              A record with format id 0 holds formatted text, any other id
+ *              holds arguments captured by a DeferredArgWriter. Format id
+ *              0xFFFFFFFF is reserved since version 2: such records hold
+ *              formatted text followed by structured fields (see
+ *              StructuredFields.h). Version 1 files have no reserved id,
+ *              their text records are structured when they hold the fields
+ *              separator.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_BINARYLOGFORMAT_H_
+#define STROALGO_LOGGER_HEADERS_BINARYLOGFORMAT_H_
+
+#include <spdlog/common.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Magic bytes starting every binary log file
+ */
+constexpr std::string_view c_BinaryLogMagic{"SLOG"};
+
+/**
+ * @brief Version of the binary log layout
+ */
+constexpr std::uint16_t c_BinaryLogVersion{2};
+
+/**
+ * @brief Oldest version still read, structured fields marked in-band
+ */
+constexpr std::uint16_t c_BinaryLogInBandVersion{1};
+
+/**
+ * @brief Format id of records holding already formatted text
+ */
+constexpr std::uint32_t c_TextFormatId{0};
+
+/**
+ * @brief Format id of records holding formatted text followed by their
+ * structured fields
+ */
+constexpr std::uint32_t c_StructuredFormatId{
+    std::numeric_limits<std::uint32_t>::max()};
+
+/**
+ * @brief Get the format id of a record holding formatted text
+ *
+ * @param pStructured The text is followed by structured fields
+ * @return c_StructuredFormatId or c_TextFormatId
+ */
+constexpr std::uint32_t GetTextFormatId(bool pStructured) {
+  return pStructured ? c_StructuredFormatId : c_TextFormatId;
+}
+
+/**
+ * @brief Size of a record entry without its payload
+ */
+constexpr std::size_t c_BinaryRecordHeaderSize{1 + 8 + 1 + 4 + 8 + 4 + 4};
+
+/**
+ * @brief Kind of an entry following the file header
+ */
+enum class BinaryEntryKind : std::uint8_t { Format = 1, Record = 2 };
+
+/**
+ * @brief Append an unsigned integer in little-endian order
+ *
+ * @tparam Buffer Container with push_back (std::string, fmt buffer)
+ * @tparam T Integer type
+ * @param pOut Destination buffer
+ * @param pValue The value
+ */
+template <typename Buffer, typename T>
+inline void AppendLittleEndian(Buffer &pOut, T pValue) {
+  using Unsigned = std::make_unsigned_t<T>;
+  auto lValue{static_cast<Unsigned>(pValue)};
+  for (std::size_t lByte = 0; lByte < sizeof(T); ++lByte) {
+    pOut.push_back(static_cast<char>(lValue & 0xFFU));
+    lValue = static_cast<Unsigned>(lValue >> 8U);
+  }
+}
+
+/**
+ * @brief Read an integer stored in little-endian order
+ *
+ * @tparam T Integer type
+ * @param pData At least sizeof(T) bytes
+ * @return The value
+ */
+template <typename T>
+inline T ReadLittleEndian(const char *pData) {
+  using Unsigned = std::make_unsigned_t<T>;
+  Unsigned lValue{0};
+  for (std::size_t lByte = sizeof(T); lByte > 0; --lByte) {
+    lValue = static_cast<Unsigned>(
+        (lValue << 8U) | static_cast<unsigned char>(pData[lByte - 1]));
+  }
+  return static_cast<T>(lValue);
+}
+
+/**
+ * @brief Convert a time to the ns since epoch stored in the files, saturated
+ * for clocks with a wider range than int64 ns (time_point::min() and max()
+ * are valid bounds)
+ *
+ * @param pTime The time
+ * @return ns since epoch
+ */
+inline std::int64_t ToBinaryTime(spdlog::log_clock::time_point pTime) {
+  using Nanoseconds = std::chrono::nanoseconds;
+  using Duration = spdlog::log_clock::duration;
+  if (pTime.time_since_epoch() >=
+      std::chrono::duration_cast<Duration>(Nanoseconds::max())) {
+    return std::numeric_limits<std::int64_t>::max();
+  }
+  if (pTime.time_since_epoch() <=
+      std::chrono::duration_cast<Duration>(Nanoseconds::min())) {
+    return std::numeric_limits<std::int64_t>::min();
+  }
+  return std::chrono::duration_cast<Nanoseconds>(pTime.time_since_epoch())
+      .count();
+}
+
+/**
+ * @brief Append a file header
+ *
+ * @param pOut Destination buffer
+ * @param pModuleId Registration id of the module
+ * @param pModuleName Name of the module
+ */
+inline void AppendBinaryHeader(spdlog::memory_buf_t &pOut,
+                               std::uint32_t pModuleId,
+                               std::string_view pModuleName) {
+  pOut.append(c_BinaryLogMagic.data(),
+              c_BinaryLogMagic.data() + c_BinaryLogMagic.size());
+  AppendLittleEndian(pOut, c_BinaryLogVersion);
+  AppendLittleEndian(pOut, pModuleId);
+  AppendLittleEndian(pOut, static_cast<std::uint32_t>(pModuleName.size()));
+  pOut.append(pModuleName.data(), pModuleName.data() + pModuleName.size());
+}
+
+/**
+ * @brief Append a record entry
+ *
+ * @param pOut Destination buffer
+ * @param pTime Time of the record, ns since epoch
+ * @param pLevel Level of the record
+ * @param pModuleId Registration id of the module
+ * @param pThreadId Thread which produced the record
+ * @param pFormatId Format id, GetTextFormatId for formatted text
+ * @param pPayload Formatted text or deferred arguments
+ */
+inline void AppendBinaryRecord(spdlog::memory_buf_t &pOut, std::int64_t pTime,
+                               spdlog::level::level_enum pLevel,
+                               std::uint32_t pModuleId, std::uint64_t pThreadId,
+                               std::uint32_t pFormatId,
+                               std::string_view pPayload) {
+  pOut.push_back(static_cast<char>(BinaryEntryKind::Record));
+  AppendLittleEndian(pOut, pTime);
+  AppendLittleEndian(pOut, static_cast<std::uint8_t>(pLevel));
+  AppendLittleEndian(pOut, pModuleId);
+  AppendLittleEndian(pOut, pThreadId);
+  AppendLittleEndian(pOut, pFormatId);
+  AppendLittleEndian(pOut, static_cast<std::uint32_t>(pPayload.size()));
+  pOut.append(pPayload.data(), pPayload.data() + pPayload.size());
+}
+
+/**
+ * @brief A record read back from a binary log file
+ * @struct BinaryLogEntry
+ */
+struct BinaryLogEntry {
+  /**
+   * @brief Time at which the record has been produced
+   */
+  spdlog::log_clock::time_point m_Time{};
+
+  /**
+   * @brief Level of the record
+   */
+  spdlog::level::level_enum m_Level{spdlog::level::off};
+
+  /**
+   * @brief Registration id of the module
+   */
+  std::uint32_t m_ModuleId{0};
+
+  /**
+   * @brief Id of the thread which produced the record
+   */
+  std::uint64_t m_ThreadId{0};
+
+  /**
+   * @brief Formatted message
+   */
+  std::string m_Message{};
+
+  /**
+   * @brief The message is followed by structured fields
+   */
+  bool m_Structured{false};
+};
+
+/**
+ * @class BinaryLogReader
+ * @brief Read the records of a binary log file sequentially
+ *
+ */
+class BinaryLogReader {
+ public:
+  /**
+   * @brief Open a binary log file and read its header
+   *
+   * @param pFilePath Path of the file or of its archive
+   */
+  explicit BinaryLogReader(const std::string &pFilePath);
+
+  /**
+   * @brief Check if the file has been opened and has a supported header
+   *
+   * @return true if records can be read
+   */
+  inline bool IsValid() const { return m_Valid; }
+
+  /**
+   * @brief Get the name of the module which wrote the file
+   *
+   * @return Module name, empty if the file is not valid
+   */
+  inline const std::string &GetModuleName() const { return m_ModuleName; }
+
+  /**
+   * @brief Get the registration id written in the file header
+   *
+   * @return Module id, 0 if the file is not valid
+   */
+  inline std::uint32_t GetModuleId() const { return m_ModuleId; }
+
+  /**
+   * @brief Read the next record, format dictionary entries are consumed
+   *
+   * @param pEntry Record read
+   * @return false at the end of the file or on a truncated or corrupted entry
+   */
+  bool Next(BinaryLogEntry &pEntry);
+
+  /**
+   * @brief Get the offset of the next entry
+   *
+   * @return Offset in the file
+   */
+  std::uint64_t GetOffset();
+
+  /**
+   * @brief Get the offset of the first entry, following the header
+   *
+   * @return Offset in the file
+   */
+  inline std::uint64_t GetDataOffset() const { return m_DataOffset; }
+
+  /**
+   * @brief Move to an entry
+   *
+   * @param pOffset Offset of the entry
+   */
+  void Seek(std::uint64_t pOffset);
+
+  /**
+   * @brief Load a format dictionary entry, records read after a Seek may use
+   * formats written before
+   *
+   * @param pOffset Offset of the format entry
+   * @return false if there is no format entry at this offset
+   */
+  bool ReadFormatAt(std::uint64_t pOffset);
+
+ private:
+  /**
+   * @brief Read the body of a format entry, its kind being read
+   *
+   * @return false on a truncated entry
+   */
+  bool ReadFormat();
+
+  /**
+   * @brief Read exactly pSize bytes
+   *
+   * @param pData Destination
+   * @param pSize Number of bytes
+   * @return false if the file is shorter
+   */
+  bool Read(char *pData, std::size_t pSize);
+
+  /**
+   * @brief Buffer of the opened file, decompressing archives
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::unique_ptr<std::streambuf> m_Buffer{};
+
+  /**
+   * @brief Stream reading m_Buffer
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::istream m_File{nullptr};
+
+  /**
+   * @brief Header has been read and is supported
+   * @private
+   * @memberof BinaryLogReader
+   */
+  bool m_Valid{false};
+
+  /**
+   * @brief Offset of the first entry
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::uint64_t m_DataOffset{0};
+
+  /**
+   * @brief Name of the module which wrote the file
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::string m_ModuleName{};
+
+  /**
+   * @brief Registration id of the module which wrote the file
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::uint32_t m_ModuleId{0};
+
+  /**
+   * @brief Version read in the header
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::uint16_t m_Version{0};
+
+  /**
+   * @brief Format strings read so far, by id
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::unordered_map<std::uint32_t, std::string> m_Formats{};
+
+  /**
+   * @brief Payload of the last record read
+   * @private
+   * @memberof BinaryLogReader
+   */
+  std::string m_Payload{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_BINARYLOGFORMAT_H_
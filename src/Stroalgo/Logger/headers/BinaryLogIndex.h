@@ -0,0 +1,406 @@
+/**
+ * @file        BinaryLogIndex.h
+ * @author      ALLOGHO
+ * @brief       Sparse time index of the binary log files
+ * @details     Every binary log file "<file>.slog" has an index
+ *              "<file>.slog.idx" written along with it. The records of the
+ *              file are grouped in blocks of about 4 KiB, the index holds the
+ *              byte range, the time range and the levels of every closed
+ *              block, and the offset of every format dictionary entry.
+ *              Integers are little-endian.
+ *
+ *              Header : magic "SIDX", u16 version
+ *              Block  : u8 kind (1), u64 begin, u64 end, i64 min time,
+ *                       i64 max time (ns since epoch), u8 levels (bit n set
+ *                       if the block holds a record of spdlog level n)
+ *              Format : u8 kind (2), u64 offset of the format entry
+ *
+ *              Bytes of the log file not covered by a block (last block
+ *              being filled, blocks lost by a crash) are always read.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_BINARYLOGINDEX_H_
+#define STROALGO_LOGGER_HEADERS_BINARYLOGINDEX_H_
+
+#include <spdlog/common.h>
+#include <spdlog/details/file_helper.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogTombstones.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Magic bytes starting every index file
+ */
+constexpr std::string_view c_BinaryIndexMagic{"SIDX"};
+
+/**
+ * @brief Version of the index layout
+ */
+constexpr std::uint16_t c_BinaryIndexVersion{2};
+
+/**
+ * @brief Size from which a block of records is closed and indexed
+ */
+constexpr std::size_t c_BinaryIndexBlockSize{4096};
+
+/**
+ * @brief Kind of an index entry
+ */
+enum class BinaryIndexKind : std::uint8_t { Block = 1, Format = 2 };
+
+/**
+ * @brief Get the path of the index of a binary log file
+ *
+ * @param pFilePath Path of the binary log file
+ * @return Path of its index
+ */
+inline std::string GetBinaryIndexFilename(const std::string &pFilePath) {
+  return pFilePath + ".idx";
+}
+
+/**
+ * @brief Block of records described by the index
+ * @struct BinaryLogBlock
+ */
+struct BinaryLogBlock {
+  /**
+   * @brief Offset of the first entry of the block
+   */
+  std::uint64_t m_Begin{0};
+
+  /**
+   * @brief Offset following the last entry of the block
+   */
+  std::uint64_t m_End{0};
+
+  /**
+   * @brief Oldest record time, ns since epoch
+   */
+  std::int64_t m_MinTime{0};
+
+  /**
+   * @brief Newest record time, ns since epoch
+   */
+  std::int64_t m_MaxTime{0};
+
+  /**
+   * @brief Levels of the records, see GetLevelMask
+   */
+  std::uint8_t m_Levels{0};
+};
+
+/**
+ * @class BinaryLogIndexWriter
+ * @brief Write the index of a binary log file, used by BinaryFileSink
+ *
+ */
+class BinaryLogIndexWriter {
+ public:
+  /**
+   * @brief Open the index of a log file, the next block starts at the end of
+   * the log file
+   *
+   * @param pFilePath Path of the binary log file
+   * @param pFileSize Size of the binary log file
+   * @param pNewFile The log file has just been created, an index left by a
+   * removed file is emptied
+   */
+  void Open(const std::string &pFilePath, std::uint64_t pFileSize,
+            bool pNewFile);
+
+  /**
+   * @brief Empty the index after the log file has been emptied
+   *
+   * @param pFileSize Size of the binary log file, its header
+   */
+  void Truncate(std::uint64_t pFileSize);
+
+  /**
+   * @brief Index a format dictionary entry
+   *
+   * @param pOffset Offset of the entry in the log file
+   */
+  void AddFormat(std::uint64_t pOffset);
+
+  /**
+   * @brief Account a record, the block is indexed once large enough
+   *
+   * @param pEnd Offset following the record in the log file
+   * @param pTime Time of the record, ns since epoch
+   * @param pLevel Level of the record
+   */
+  void AddRecord(std::uint64_t pEnd, std::int64_t pTime,
+                 spdlog::level::level_enum pLevel);
+
+  /**
+   * @brief Flush the index file
+   *
+   */
+  void Flush();
+
+ private:
+  /**
+   * @brief Write the header if the index is empty
+   *
+   */
+  void WriteHeaderIfEmpty();
+
+  /**
+   * @brief Index file
+   * @private
+   * @memberof BinaryLogIndexWriter
+   */
+  spdlog::details::file_helper m_File{};
+
+  /**
+   * @brief Block being filled
+   * @private
+   * @memberof BinaryLogIndexWriter
+   */
+  BinaryLogBlock m_Block{};
+
+  /**
+   * @brief The block being filled holds at least a record
+   * @private
+   * @memberof BinaryLogIndexWriter
+   */
+  bool m_BlockUsed{false};
+
+  /**
+   * @brief Buffer reused to encode entries
+   * @private
+   * @memberof BinaryLogIndexWriter
+   */
+  spdlog::memory_buf_t m_Buffer{};
+};
+
+/**
+ * @class BinaryLogIndex
+ * @brief Index of a binary log file loaded in memory
+ *
+ */
+class BinaryLogIndex {
+ public:
+  /**
+   * @brief Load the index of a binary log file
+   *
+   * @param pFilePath Path of the binary log file
+   */
+  explicit BinaryLogIndex(const std::string &pFilePath);
+
+  /**
+   * @brief Check if the index exists and has a supported header
+   *
+   * @return false if the whole log file has to be read
+   */
+  inline bool IsValid() const { return m_Valid; }
+
+  /**
+   * @brief Get the indexed blocks
+   *
+   * @return Blocks in file order
+   */
+  inline const std::vector<BinaryLogBlock> &GetBlocks() const {
+    return m_Blocks;
+  }
+
+  /**
+   * @brief Get the offsets of the format dictionary entries
+   *
+   * @return Offsets in file order
+   */
+  inline const std::vector<std::uint64_t> &GetFormats() const {
+    return m_Formats;
+  }
+
+ private:
+  /**
+   * @brief Header has been read and is supported
+   * @private
+   * @memberof BinaryLogIndex
+   */
+  bool m_Valid{false};
+
+  /**
+   * @brief Indexed blocks
+   * @private
+   * @memberof BinaryLogIndex
+   */
+  std::vector<BinaryLogBlock> m_Blocks{};
+
+  /**
+   * @brief Offsets of the format dictionary entries
+   * @private
+   * @memberof BinaryLogIndex
+   */
+  std::vector<std::uint64_t> m_Formats{};
+};
+
+/**
+ * @class BinaryLogRangeReader
+ * @brief Read the records of a binary log file within a time range and
+ * levels, blocks which can not match are skipped using the index. Records
+ * deleted by a tombstone are not returned
+ *
+ */
+class BinaryLogRangeReader {
+ public:
+  /**
+   * @brief Open a binary log file and select the blocks to read
+   *
+   * @param pFilePath Path of the file
+   * @param pStart Oldest time read
+   * @param pEnd Newest time read
+   * @param pLevels Levels read, see GetLevelMask
+   */
+  BinaryLogRangeReader(const std::string &pFilePath,
+                       spdlog::log_clock::time_point pStart,
+                       spdlog::log_clock::time_point pEnd,
+                       std::uint8_t pLevels = c_AllLevelsMask);
+
+  /**
+   * @brief Check if the file has been opened and has a supported header
+   *
+   * @return true if records can be read
+   */
+  inline bool IsValid() const { return m_Reader.IsValid(); }
+
+  /**
+   * @brief Get the name of the module which wrote the file
+   *
+   * @return Module name, empty if the file is not valid
+   */
+  inline const std::string &GetModuleName() const {
+    return m_Reader.GetModuleName();
+  }
+
+  /**
+   * @brief Get the registration id written in the file header
+   *
+   * @return Module id, 0 if the file is not valid
+   */
+  inline std::uint32_t GetModuleId() const { return m_Reader.GetModuleId(); }
+
+  /**
+   * @brief Get the byte ranges of the file read
+   *
+   * @return Begin and end offsets, in file order
+   */
+  inline const std::vector<std::pair<std::uint64_t, std::uint64_t>> &
+  GetRanges() const {
+    return m_Ranges;
+  }
+
+  /**
+   * @brief Start reading at an entry offset, blocks before it are skipped.
+   * Must be called before the first Next
+   *
+   * @param pOffset Offset of an entry, returned by GetEntryOffset
+   */
+  void SetStartOffset(std::uint64_t pOffset);
+
+  /**
+   * @brief Get the offset from which the last record returned was read,
+   * reading again from it returns this record first
+   *
+   * @return Offset of the record or of the format entry preceding it
+   */
+  inline std::uint64_t GetEntryOffset() const { return m_EntryOffset; }
+
+  /**
+   * @brief Read the next record within the time range and levels
+   *
+   * @param pEntry Record read
+   * @return false once every selected block has been read
+   */
+  bool Next(BinaryLogEntry &pEntry);
+
+ private:
+  /**
+   * @brief Reader of the log file
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  BinaryLogReader m_Reader;
+
+  /**
+   * @brief Index of the log file
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  BinaryLogIndex m_Index;
+
+  /**
+   * @brief Time range, ns since epoch
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::int64_t m_Start{0};
+  std::int64_t m_End{0};
+
+  /**
+   * @brief Levels read
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::uint8_t m_Levels{c_AllLevelsMask};
+
+  /**
+   * @brief Tombstones of the log file
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::vector<BinaryLogTombstone> m_Tombstones{};
+
+  /**
+   * @brief Byte ranges to read
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> m_Ranges{};
+
+  /**
+   * @brief Next byte range to read, the current one is the previous
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::size_t m_NextRange{0};
+
+  /**
+   * @brief Next format dictionary entry to load before seeking
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::size_t m_NextFormat{0};
+
+  /**
+   * @brief End of the byte range being read, 0 before the first one
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::uint64_t m_RangeEnd{0};
+
+  /**
+   * @brief Offset from which the last record returned was read
+   * @private
+   * @memberof BinaryLogRangeReader
+   */
+  std::uint64_t m_EntryOffset{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_BINARYLOGINDEX_H_
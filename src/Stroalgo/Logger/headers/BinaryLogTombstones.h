@@ -0,0 +1,142 @@
+/**
+ * @file        BinaryLogTombstones.h
+ * @author      ALLOGHO
+ * @brief       Deletion marks of the records of a binary log file
+ * @details     Deleting records of a binary log file "<file>.slog" appends a
+ *              tombstone to "<file>.slog.del" and takes effect immediately
+ *              for the readers of the index. LogCompactor rewrites the file
+ *              later without the deleted records. Integers are little-endian.
+ *
+ *              Header    : magic "SDEL", u16 version
+ *              Tombstone : i64 start, i64 end (ns since epoch, inclusive),
+ *                          u8 levels (see GetLevelMask)
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_BINARYLOGTOMBSTONES_H_
+#define STROALGO_LOGGER_HEADERS_BINARYLOGTOMBSTONES_H_
+
+#include <spdlog/common.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Magic bytes starting every tombstone file
+ */
+constexpr std::string_view c_BinaryTombstoneMagic{"SDEL"};
+
+/**
+ * @brief Version of the tombstone layout
+ */
+constexpr std::uint16_t c_BinaryTombstoneVersion{1};
+
+/**
+ * @brief Levels mask selecting every level, trace to critical
+ */
+constexpr std::uint8_t c_AllLevelsMask{0x7F};
+
+/**
+ * @brief Get the bit of a level in a levels mask
+ *
+ * @param pLevel The level
+ * @return Mask holding only this level, 0 for off
+ */
+constexpr std::uint8_t GetLevelMask(spdlog::level::level_enum pLevel) {
+  return pLevel < spdlog::level::off
+             ? static_cast<std::uint8_t>(1U << static_cast<unsigned>(pLevel))
+             : std::uint8_t{0};
+}
+
+/**
+ * @brief Get the path of the tombstones of a binary log file
+ *
+ * @param pFilePath Path of the binary log file
+ * @return Path of its tombstones
+ */
+inline std::string GetBinaryTombstoneFilename(const std::string &pFilePath) {
+  return pFilePath + ".del";
+}
+
+/**
+ * @brief Records deleted from a binary log file
+ * @struct BinaryLogTombstone
+ */
+struct BinaryLogTombstone {
+  /**
+   * @brief Oldest time deleted, ns since epoch
+   */
+  std::int64_t m_Start{0};
+
+  /**
+   * @brief Newest time deleted, ns since epoch
+   */
+  std::int64_t m_End{0};
+
+  /**
+   * @brief Levels deleted, see GetLevelMask
+   */
+  std::uint8_t m_Levels{c_AllLevelsMask};
+
+  /**
+   * @brief Check if a record is deleted
+   *
+   * @param pTime Time of the record, ns since epoch
+   * @param pLevel Level of the record
+   * @return true if the record must not be returned
+   */
+  inline bool Matches(std::int64_t pTime,
+                      spdlog::level::level_enum pLevel) const {
+    return pTime >= m_Start && pTime <= m_End &&
+           (GetLevelMask(pLevel) & m_Levels) != 0;
+  }
+};
+
+/**
+ * @brief Append a tombstone to the tombstones of a binary log file
+ *
+ * @param pFilePath Path of the binary log file
+ * @param pTombstone Records deleted
+ * @throw spdlog::spdlog_ex if the tombstone file can not be written
+ */
+void AddBinaryTombstone(const std::string &pFilePath,
+                        const BinaryLogTombstone &pTombstone);
+
+/**
+ * @brief Load the tombstones of a binary log file
+ *
+ * @param pFilePath Path of the binary log file
+ * @return Tombstones in the order they were added, empty if none
+ */
+std::vector<BinaryLogTombstone> LoadBinaryTombstones(
+    const std::string &pFilePath);
+
+/**
+ * @brief Remove the tombstones applied by a compaction, tombstones added
+ * meanwhile are kept
+ *
+ * @param pFilePath Path of the binary log file
+ * @param pCount Number of tombstones applied, the oldest ones
+ */
+void RemoveBinaryTombstones(const std::string &pFilePath, std::size_t pCount);
+
+/**
+ * @brief Move the tombstones of a binary log file to its new path
+ *
+ * @param pFilePath Path of the binary log file
+ * @param pNewFilePath New path of the binary log file
+ */
+void RenameBinaryTombstones(const std::string &pFilePath,
+                            const std::string &pNewFilePath);
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_BINARYLOGTOMBSTONES_H_
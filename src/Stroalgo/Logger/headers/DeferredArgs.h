@@ -0,0 +1,246 @@
+/**
+ * @file        DeferredArgs.h
+ * @author      ALLOGHO
+ * @brief       Binary capture of log arguments formatted later
+ * @details     Arguments are copied with a one byte type tag, in
+ *              little-endian order as the binary log files, the backend
+ *              thread or an offline tool rebuilds them to run fmt. The
+ *              format strings are interned, a deferred record never points
+ *              to the memory of its caller.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_DEFERREDARGS_H_
+#define STROALGO_LOGGER_HEADERS_DEFERREDARGS_H_
+
+#include <spdlog/fmt/fmt.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Unsigned integer holding the bytes of a captured value
+ *
+ * @tparam Size Size of the value, 1, 2, 4 or 8 bytes
+ */
+template <std::size_t Size>
+using DeferredArgBits = std::conditional_t<
+    Size == 1, std::uint8_t,
+    std::conditional_t<Size == 2, std::uint16_t,
+                       std::conditional_t<Size == 4, std::uint32_t,
+                                          std::uint64_t>>>;
+
+/**
+ * @brief Number of distinct format strings interned at most, later formats
+ * are formatted on the caller thread
+ */
+constexpr std::size_t c_MaxInternedFormats{4096};
+
+/**
+ * @brief Type tag written before each captured argument
+ */
+enum class DeferredArgType : std::uint8_t {
+  Int = 0,
+  UInt,
+  Float,
+  Double,
+  Bool,
+  Char,
+  String
+};
+
+/**
+ * @brief Check if an argument type can be captured instead of formatted
+ * @details Integers, floating points, bool, char, strings and enums without a
+ * custom formatter. Anything else is formatted on the caller thread.
+ *
+ * @tparam T Type of the argument as passed to the log call
+ * @return true if the argument can be captured
+ */
+template <typename T>
+constexpr bool IsDeferrableArg() {
+  using Type = std::decay_t<T>;
+  if constexpr (std::is_enum_v<Type>) {
+    return !fmt::has_formatter<Type, fmt::format_context>::value;
+  } else if constexpr (std::is_same_v<Type, bool> ||
+                       std::is_same_v<Type, char> ||
+                       std::is_same_v<Type, float> ||
+                       std::is_same_v<Type, double>) {
+    return true;
+  } else if constexpr (std::is_integral_v<Type>) {
+    // Other character types do not format with a char format string
+    return !std::is_same_v<Type, wchar_t> && !std::is_same_v<Type, char16_t> &&
+           !std::is_same_v<Type, char32_t>;
+  } else {
+    return std::is_same_v<Type, std::string> ||
+           std::is_same_v<Type, std::string_view> ||
+           std::is_same_v<Type, fmt::string_view> ||
+           std::is_same_v<Type, const char *> || std::is_same_v<Type, char *>;
+  }
+}
+
+/**
+ * @class DeferredArgWriter
+ * @brief Append captured arguments into a fixed size buffer
+ *
+ */
+class DeferredArgWriter {
+ public:
+  /**
+   * @brief Construct a writer on a caller owned buffer
+   *
+   * @param pBuffer Destination buffer
+   * @param pCapacity Size of the destination buffer
+   */
+  DeferredArgWriter(char *pBuffer, std::size_t pCapacity)
+      : m_Buffer(pBuffer), m_Capacity(pCapacity) {}
+
+  /**
+   * @brief Capture one argument
+   *
+   * @tparam T Type of the argument, must satisfy IsDeferrableArg
+   * @param pArg The argument
+   * @return false if the buffer is too small or the argument can not be
+   * captured (null C string)
+   */
+  template <typename T>
+  bool Write(const T &pArg) {
+    using Type = std::decay_t<T>;
+    static_assert(IsDeferrableArg<T>(), "Argument can not be deferred");
+    bool lRet{false};
+    if constexpr (std::is_enum_v<Type>) {
+      lRet = Write(static_cast<std::underlying_type_t<Type>>(pArg));
+    } else if constexpr (std::is_same_v<Type, bool>) {
+      lRet = Append(DeferredArgType::Bool, static_cast<std::uint8_t>(pArg));
+    } else if constexpr (std::is_same_v<Type, char>) {
+      lRet = Append(DeferredArgType::Char, pArg);
+    } else if constexpr (std::is_same_v<Type, float>) {
+      lRet = Append(DeferredArgType::Float, pArg);
+    } else if constexpr (std::is_same_v<Type, double>) {
+      lRet = Append(DeferredArgType::Double, pArg);
+    } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+      lRet = Append(DeferredArgType::Int, static_cast<std::int64_t>(pArg));
+    } else if constexpr (std::is_integral_v<Type>) {
+      lRet = Append(DeferredArgType::UInt, static_cast<std::uint64_t>(pArg));
+    } else if constexpr (std::is_pointer_v<Type>) {
+      // fmt reports null C strings, leave it to the eager path
+      lRet = pArg != nullptr && WriteString(std::string_view{pArg});
+    } else {
+      lRet = WriteString(std::string_view{pArg.data(), pArg.size()});
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Get the number of bytes written
+   *
+   * @return Size of the captured arguments
+   */
+  inline std::size_t Size() const { return m_Size; }
+
+ private:
+  /**
+   * @brief Append a tag followed by a fixed size value in little-endian
+   * order, floating points by their bits
+   *
+   * @tparam T Type of the value
+   * @param pType Tag of the value
+   * @param pValue The value
+   * @return false if the buffer is too small
+   */
+  template <typename T>
+  bool Append(DeferredArgType pType, const T &pValue) {
+    using Bits = DeferredArgBits<sizeof(T)>;
+    static_assert(sizeof(Bits) == sizeof(T), "Value can not be captured");
+    bool lRet{false};
+    if (m_Size + 1 + sizeof(T) <= m_Capacity) {
+      m_Buffer[m_Size] = static_cast<char>(pType);
+      Bits lBits{0};
+      std::memcpy(&lBits, &pValue, sizeof(T));
+      for (std::size_t lByte = 0; lByte < sizeof(T); ++lByte) {
+        m_Buffer[m_Size + 1 + lByte] = static_cast<char>(lBits & 0xFFU);
+        lBits = static_cast<Bits>(lBits >> 8U);
+      }
+      m_Size += 1 + sizeof(T);
+      lRet = true;
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Append a string tag, its 32 bits length and its bytes
+   *
+   * @param pValue The string
+   * @return false if the buffer is too small
+   */
+  bool WriteString(std::string_view pValue) {
+    bool lRet{false};
+    const std::size_t lSize{m_Size + 1 + sizeof(std::uint32_t) +
+                            pValue.size()};
+    if (lSize <= m_Capacity) {
+      const auto lLength{static_cast<std::uint32_t>(pValue.size())};
+      Append(DeferredArgType::String, lLength);
+      std::memcpy(m_Buffer + m_Size, pValue.data(), pValue.size());
+      m_Size = lSize;
+      lRet = true;
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Destination buffer
+   * @private
+   * @memberof DeferredArgWriter
+   */
+  char *m_Buffer{nullptr};
+
+  /**
+   * @brief Size of the destination buffer
+   * @private
+   * @memberof DeferredArgWriter
+   */
+  std::size_t m_Capacity{0};
+
+  /**
+   * @brief Number of bytes written
+   * @private
+   * @memberof DeferredArgWriter
+   */
+  std::size_t m_Size{0};
+};
+
+/**
+ * @brief Get the copy of a format string kept until the process exits
+ * @details Equal format strings share one copy, its address identifies the
+ * format. Thread-safe, the lookup of a format already seen by the thread takes
+ * no lock.
+ *
+ * @param pFormat Format string of a log call, literal or built at runtime
+ * @return The copy, or a null view once c_MaxInternedFormats formats are kept
+ */
+std::string_view InternFormat(std::string_view pFormat);
+
+/**
+ * @brief Format captured arguments
+ *
+ * @param pFormat Format string of the log call
+ * @param pArgs Arguments written by a DeferredArgWriter
+ * @param pOut Buffer the message is appended to
+ * @return false if the captured arguments are corrupted, nothing is written
+ * @throw fmt::format_error if the arguments do not match the format string
+ */
+bool FormatDeferredArgs(std::string_view pFormat, std::string_view pArgs,
+                        fmt::memory_buffer &pOut);
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_DEFERREDARGS_H_
@@ -0,0 +1,163 @@
+/**
+ * @file        DurationHistogram.h
+ * @author      ALLOGHO
+ * @brief       Lock-free histogram of durations
+ * @details     Durations are counted in buckets of powers of two
+ *              microseconds, recording is one relaxed increment per bucket
+ *              and per total so it can sit on the write path
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_DURATIONHISTOGRAM_H_
+#define STROALGO_LOGGER_HEADERS_DURATIONHISTOGRAM_H_
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Number of buckets of a duration histogram, the last one counts
+ * every duration from about a quarter of a second
+ */
+constexpr std::size_t c_HistogramBuckets{20};
+
+/**
+ * @brief Get the number of bits needed to write a value
+ *
+ * @param pValue The value
+ * @return Position of the highest bit set plus one, 0 for 0
+ */
+inline std::size_t GetBitLength(std::uint64_t pValue) {
+  if (pValue == 0) {
+    return 0;
+  }
+#ifdef _MSC_VER
+  unsigned long lIndex{0};
+  _BitScanReverse64(&lIndex, pValue);
+  return static_cast<std::size_t>(lIndex) + 1;
+#else
+  return static_cast<std::size_t>(64 - __builtin_clzll(pValue));
+#endif
+}
+
+/**
+ * @brief Counts of a duration histogram at a given time
+ * @struct HistogramSnapshot
+ */
+struct HistogramSnapshot {
+  /**
+   * @brief Get the exclusive upper bound of a bucket
+   *
+   * @param pBucket Index of the bucket, the last one has no bound
+   * @return 2^pBucket microseconds
+   */
+  static inline std::chrono::microseconds UpperBound(std::size_t pBucket) {
+    return std::chrono::microseconds{std::int64_t{1} << pBucket};
+  }
+
+  /**
+   * @brief Durations of each bucket, bucket i counts durations below
+   * UpperBound(i) and from UpperBound(i - 1)
+   */
+  std::array<std::uint64_t, c_HistogramBuckets> m_Counts{};
+
+  /**
+   * @brief Number of durations recorded
+   */
+  std::uint64_t m_Count{0};
+
+  /**
+   * @brief Sum of the durations recorded
+   */
+  std::chrono::nanoseconds m_Total{0};
+
+  /**
+   * @brief Longest duration recorded
+   */
+  std::chrono::nanoseconds m_Max{0};
+};
+
+/**
+ * @class DurationHistogram
+ * @brief Histogram recorded by any thread without lock
+ *
+ */
+class DurationHistogram {
+ public:
+  /**
+   * @brief Count a duration
+   *
+   * @param pDuration The duration, negative durations count as 0
+   */
+  void Record(std::chrono::nanoseconds pDuration) {
+    const std::int64_t lNs{std::max<std::int64_t>(pDuration.count(), 0)};
+    const std::uint64_t lUs{static_cast<std::uint64_t>(lNs / 1000)};
+    // Bucket of the highest bit, durations below 1us go in the first one
+    const std::size_t lBucket{
+        std::min(GetBitLength(lUs), c_HistogramBuckets - 1)};
+    m_Counts[lBucket].fetch_add(1, std::memory_order_relaxed);
+    m_TotalNs.fetch_add(lNs, std::memory_order_relaxed);
+    std::int64_t lMax{m_MaxNs.load(std::memory_order_relaxed)};
+    while (lNs > lMax &&
+           !m_MaxNs.compare_exchange_weak(lMax, lNs,
+                                          std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * @brief Read the counts, consistent with each other once recording stops
+   *
+   * @return The snapshot
+   */
+  HistogramSnapshot Snapshot() const {
+    HistogramSnapshot lRet{};
+    for (std::size_t lBucket = 0; lBucket < c_HistogramBuckets; ++lBucket) {
+      lRet.m_Counts[lBucket] =
+          m_Counts[lBucket].load(std::memory_order_relaxed);
+      lRet.m_Count += lRet.m_Counts[lBucket];
+    }
+    lRet.m_Total =
+        std::chrono::nanoseconds{m_TotalNs.load(std::memory_order_relaxed)};
+    lRet.m_Max =
+        std::chrono::nanoseconds{m_MaxNs.load(std::memory_order_relaxed)};
+    return lRet;
+  }
+
+ private:
+  /**
+   * @brief Durations of each bucket
+   * @private
+   * @memberof DurationHistogram
+   */
+  std::array<std::atomic<std::uint64_t>, c_HistogramBuckets> m_Counts{};
+
+  /**
+   * @brief Sum of the durations, in nanoseconds
+   * @private
+   * @memberof DurationHistogram
+   */
+  std::atomic<std::int64_t> m_TotalNs{0};
+
+  /**
+   * @brief Longest duration, in nanoseconds
+   * @private
+   * @memberof DurationHistogram
+   */
+  std::atomic<std::int64_t> m_MaxNs{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_DURATIONHISTOGRAM_H_
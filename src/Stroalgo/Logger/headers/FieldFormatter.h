@@ -0,0 +1,155 @@
+/**
+ * @file        FieldFormatter.h
+ * @author      ALLOGHO
+ * @brief       spdlog formatter sharing the rendered fields between sinks
+ * @details     The timestamp of a message is rendered once per thread and
+ *              reused by every sink of the logger, each sink only adds its
+ *              framing (text line or JSON object) around the fields it keeps
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_FIELDFORMATTER_H_
+#define STROALGO_LOGGER_HEADERS_FIELDFORMATTER_H_
+
+#include <spdlog/common.h>
+#include <spdlog/formatter.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Number of bytes written by a sink, shared with the Logger stats
+ */
+using ByteCounter = std::atomic<std::uint64_t>;
+
+/**
+ * @brief Framing added by a sink around the fields of a message
+ */
+enum class LogFraming {
+  /**
+   * @brief "[time] [name] [level] ---> message", colored on console
+   */
+  Text,
+
+  /**
+   * @brief {"time": "...", "name": "...", ..., "message": "..."},
+   */
+  Json
+};
+
+/**
+ * @brief Fields written by a sink, the message is always written
+ * @struct LogFields
+ */
+struct LogFields {
+  /**
+   * @brief Date and time, milliseconds in text, microseconds and UTC offset
+   * in JSON
+   */
+  bool m_Time{true};
+
+  /**
+   * @brief Module name
+   */
+  bool m_Name{true};
+
+  /**
+   * @brief Level name
+   */
+  bool m_Level{true};
+
+  /**
+   * @brief Process id
+   */
+  bool m_Process{false};
+
+  /**
+   * @brief Thread id
+   */
+  bool m_Thread{false};
+};
+
+/**
+ * @class FieldFormatter
+ * @brief Formatter replacing the spdlog pattern formatter of the module sinks
+ *
+ */
+class FieldFormatter final : public spdlog::formatter {
+ public:
+  /**
+   * @brief Construct a new Field Formatter object
+   *
+   * @param pFraming Framing of the messages
+   * @param pFields Fields kept by the sink
+   * @param pWrittenBytes Receives the size of every formatted message, null
+   * to count nothing
+   */
+  FieldFormatter(LogFraming pFraming, const LogFields &pFields,
+                 std::shared_ptr<ByteCounter> pWrittenBytes = nullptr);
+
+  /**
+   * @brief Write a message with its framing
+   *
+   * @param pMsg The message
+   * @param pDest Buffer receiving the framed message and its end of line
+   */
+  void format(const spdlog::details::log_msg &pMsg,
+              spdlog::memory_buf_t &pDest) override;
+
+  /**
+   * @brief Copy the formatter, required by spdlog
+   *
+   * @return A formatter with the same framing, fields and byte counter
+   */
+  std::unique_ptr<spdlog::formatter> clone() const override;
+
+ private:
+  /**
+   * @brief Write a message as a text line
+   *
+   * @param pMsg The message
+   * @param pDest Destination buffer
+   */
+  void FormatText(const spdlog::details::log_msg &pMsg,
+                  spdlog::memory_buf_t &pDest) const;
+
+  /**
+   * @brief Write a message as a JSON object
+   *
+   * @param pMsg The message
+   * @param pDest Destination buffer
+   */
+  void FormatJson(const spdlog::details::log_msg &pMsg,
+                  spdlog::memory_buf_t &pDest) const;
+
+  /**
+   * @brief Framing of the messages
+   * @private
+   * @memberof FieldFormatter
+   */
+  const LogFraming m_Framing;
+
+  /**
+   * @brief Fields kept by the sink
+   * @private
+   * @memberof FieldFormatter
+   */
+  const LogFields m_Fields;
+
+  /**
+   * @brief Size of the formatted messages, null if not counted
+   * @private
+   * @memberof FieldFormatter
+   */
+  const std::shared_ptr<ByteCounter> m_WrittenBytes;
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_FIELDFORMATTER_H_
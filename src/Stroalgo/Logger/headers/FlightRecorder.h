@@ -0,0 +1,408 @@
+/**
+ * @file        FlightRecorder.h
+ * @author      ALLOGHO
+ * @brief       In-memory ring keeping the last records of a module
+ * @details     Records below the module level, usually trace and debug, are
+ *              only copied into a memory mapped ring, the oldest ones being
+ *              overwritten. The ring is written to disk when a record at or
+ *              above the trigger level is logged, on a fatal signal or on
+ *              request, so an incident comes with its full trace context
+ *              without paying to persist that volume all the time.
+ *
+ *              The ring is anonymous memory or a file mapped shared, the
+ *              latter survives any crash of the process, SIGKILL included.
+ *              The image "<Module>.<pid>.<start>.<n>.flight" is named after
+ *              the process writing it, <start> being the start time of the
+ *              process (ProcessIdentity.h) and <n> the rank of the recorder
+ *              in the process. A recorder only recovers the images of the
+ *              processes gone, it never reads over nor removes the ring of
+ *              a live one. The image holds, in host byte order :
+ *
+ *              Header : magic "SLFR", u16 version, u16 name length,
+ *                       u32 module id, u32 process id,
+ *                       u64 process start time, u64 capacity, u64 head,
+ *                       u64 tail, u64 dumped, name, padded to
+ *                       c_FlightRecorderHeaderSize bytes
+ *              Data   : capacity bytes of binary record entries
+ *                       (BinaryLogFormat.h), entry at position p is at
+ *                       offset p % capacity and may wrap
+ *
+ *              head, tail and dumped are positions counted in bytes since
+ *              the ring was created. The records between tail and head are
+ *              complete : tail moves before the bytes of the oldest records
+ *              are overwritten and head only once a record is copied.
+ *
+ *              Dumps are appended to the daily binary file
+ *              "<Module>_flight_YYYY-MM-DD.fdump", read with stroalgo-logcat,
+ *              each dump holds the records not dumped yet. Their extension
+ *              keeps them out of the queries, the archiver and the deletions
+ *              meant for the daily log files.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_FLIGHTRECORDER_H_
+#define STROALGO_LOGGER_HEADERS_FLIGHTRECORDER_H_
+
+#include <spdlog/common.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Extension of the dump files, distinct from the daily log files
+ */
+constexpr std::string_view c_FlightDumpExtension{".fdump"};
+
+/**
+ * @brief Magic bytes starting every flight recorder image
+ */
+constexpr std::string_view c_FlightRecorderMagic{"SLFR"};
+
+/**
+ * @brief Version of the flight recorder image layout
+ */
+constexpr std::uint16_t c_FlightRecorderVersion{2};
+
+/**
+ * @brief Size of the image header, the data follows
+ */
+constexpr std::size_t c_FlightRecorderHeaderSize{256};
+
+/**
+ * @brief Bytes of the module name kept in the image header, longer names are
+ * truncated
+ */
+constexpr std::size_t c_FlightRecorderNameSize{192};
+
+/**
+ * @brief Smallest ring, smaller sizes are rounded up
+ */
+constexpr std::size_t c_MinFlightRecorderSize{4096};
+
+/**
+ * @brief Flight recorder of a module
+ * @details The default options disable the recorder
+ * @struct FlightRecorderOptions
+ */
+struct FlightRecorderOptions {
+  /**
+   * @brief Bytes of records kept in memory, 0 disables the recorder
+   */
+  std::size_t m_Size{0};
+
+  /**
+   * @brief Lowest level kept in memory, records at or above the module level
+   * are kept as well
+   */
+  spdlog::level::level_enum m_Level{spdlog::level::trace};
+
+  /**
+   * @brief Records at or above this level dump the ring, off never dumps
+   */
+  spdlog::level::level_enum m_TriggerLevel{spdlog::level::err};
+
+  /**
+   * @brief Map the ring on its image file instead of anonymous memory
+   */
+  bool m_FileBacked{false};
+
+  /**
+   * @brief Write the ring image when the process receives SIGSEGV, SIGBUS,
+   * SIGFPE, SIGILL or SIGABRT
+   */
+  bool m_DumpOnFatalSignal{true};
+};
+
+struct FlightRecorderHeader;
+
+/**
+ * @class FlightRecorder
+ * @brief spdlog sink copying records into a ring and dumping it on errors
+ * @details Records below the module level do not go through spdlog, the
+ * module hands them to Record.
+ *
+ */
+class FlightRecorder final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  /**
+   * @brief Construct a new Flight Recorder object and map its ring, the
+   * records of the images left by the processes gone are dumped first
+   *
+   * @param pImageBaseFilename Path of the ring images without process,
+   * "Logs/M/M.flight" names the image "Logs/M/M.<pid>.<start>.<n>.flight"
+   * @param pDumpBaseFilename Path of the dumps without date,
+   * "Logs/M/M_flight.fdump" writes "Logs/M/M_flight_YYYY-MM-DD.fdump"
+   * @param pModuleName Name of the module written in the dumps
+   * @param pModuleId Registration id of the module
+   * @param pOptions Size, trigger and backing of the ring
+   */
+  FlightRecorder(const std::string &pImageBaseFilename,
+                 const std::string &pDumpBaseFilename,
+                 const std::string &pModuleName, std::uint32_t pModuleId,
+                 const FlightRecorderOptions &pOptions);
+
+  /**
+   * @brief Destroy the Flight Recorder object, the image of a file backed
+   * ring is removed since nothing has to be recovered
+   *
+   */
+  ~FlightRecorder() override;
+
+  FlightRecorder(const FlightRecorder &) = delete;
+  FlightRecorder &operator=(const FlightRecorder &) = delete;
+
+  /**
+   * @brief Keep a record in the ring only
+   *
+   * @param pLevel Level of the record
+   * @param pTime Time of the record
+   * @param pThreadId Thread which produced the record
+   * @param pPayload Formatted message
+   * @param pStructured The message is followed by structured fields
+   */
+  void Record(spdlog::level::level_enum pLevel,
+              spdlog::log_clock::time_point pTime, std::size_t pThreadId,
+              std::string_view pPayload, bool pStructured);
+
+  /**
+   * @brief Append the records not dumped yet to today's dump file
+   *
+   * @return Number of records dumped
+   */
+  std::size_t Dump();
+
+  /**
+   * @brief Write the whole ring to its image file without lock nor
+   * allocation, called from the fatal signal handler
+   *
+   */
+  void WriteCrashImage() const noexcept;
+
+  /**
+   * @brief Get the path of today's dump file
+   *
+   * @return "<Module>_flight_YYYY-MM-DD.fdump"
+   */
+  std::string GetDumpFilename() const;
+
+  /**
+   * @brief Get the path of the ring image
+   *
+   * @return "<Module>.<pid>.<start>.<n>.flight"
+   */
+  inline const std::string &GetImageFilename() const {
+    return m_ImageFilename;
+  }
+
+  /**
+   * @brief Get the options of the recorder
+   *
+   * @return The options, the size rounded up
+   */
+  inline const FlightRecorderOptions &GetOptions() const { return m_Options; }
+
+  /**
+   * @brief Get the number of records copied into the ring
+   *
+   * @return Records recorded since construction
+   */
+  inline std::uint64_t GetRecordedRecords() const {
+    return m_Recorded.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the number of dumps written
+   *
+   * @return Dumps since construction, recovered images included
+   */
+  inline std::uint64_t GetDumps() const {
+    return m_Dumps.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  /**
+   * @brief Keep a record written to the other sinks, dump the ring on a
+   * trigger level
+   *
+   * @param pMsg The message
+   */
+  void sink_it_(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Nothing to flush, the ring is only written by dumps
+   *
+   */
+  void flush_() override {}
+
+ private:
+  /**
+   * @brief Copy a record into the ring, overwriting the oldest ones, and
+   * dump the ring on a trigger level, the mutex must be held
+   *
+   * @param pLevel Level of the record
+   * @param pTime Time of the record
+   * @param pThreadId Thread which produced the record
+   * @param pPayload Formatted message
+   * @param pStructured The message is followed by structured fields
+   */
+  void Append(spdlog::level::level_enum pLevel,
+              spdlog::log_clock::time_point pTime, std::size_t pThreadId,
+              std::string_view pPayload, bool pStructured);
+
+  /**
+   * @brief Append the records not dumped yet, the mutex must be held
+   *
+   * @return Number of records dumped
+   */
+  std::size_t DumpLocked();
+
+  /**
+   * @brief Dump and remove the images left by the processes gone
+   *
+   * @param pImageBaseFilename Path of the ring images without process
+   */
+  void RecoverImages(const std::string &pImageBaseFilename);
+
+  /**
+   * @brief Map the ring and write its header
+   *
+   */
+  void Map();
+
+  /**
+   * @brief Process writing the ring
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::uint32_t m_ProcessId;
+
+  /**
+   * @brief Start time of the process, 0 if unknown
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::uint64_t m_StartTime;
+
+  /**
+   * @brief Path of the ring image
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::string m_ImageFilename;
+
+  /**
+   * @brief Path of the dumps without date
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::string m_DumpBaseFilename;
+
+  /**
+   * @brief Name of the module
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::string m_ModuleName;
+
+  /**
+   * @brief Registration id of the module
+   * @private
+   * @memberof FlightRecorder
+   */
+  const std::uint32_t m_ModuleId;
+
+  /**
+   * @brief Options, the size rounded up
+   * @private
+   * @memberof FlightRecorder
+   */
+  FlightRecorderOptions m_Options;
+
+  /**
+   * @brief Header and data of the ring
+   * @private
+   * @memberof FlightRecorder
+   */
+  char *m_Mapping{nullptr};
+
+  /**
+   * @brief Header of the ring, at the start of m_Mapping
+   * @private
+   * @memberof FlightRecorder
+   */
+  FlightRecorderHeader *m_Header{nullptr};
+
+  /**
+   * @brief Slot of the recorder in the table of the signal handler, -1 if
+   * not registered
+   * @private
+   * @memberof FlightRecorder
+   */
+  int m_SignalSlot{-1};
+
+  /**
+   * @brief Records copied into the ring
+   * @private
+   * @memberof FlightRecorder
+   */
+  std::atomic<std::uint64_t> m_Recorded{0};
+
+  /**
+   * @brief Dumps written
+   * @private
+   * @memberof FlightRecorder
+   */
+  std::atomic<std::uint64_t> m_Dumps{0};
+
+  /**
+   * @brief Buffer reused to encode records
+   * @private
+   * @memberof FlightRecorder
+   */
+  spdlog::memory_buf_t m_Buffer{};
+};
+
+/**
+ * @brief Get the path of the ring image of a recorder
+ *
+ * @param pImageBaseFilename Path of the images without process,
+ * "<Module>.flight"
+ * @param pProcessId Process writing the ring
+ * @param pStartTime Start time of the process
+ * @param pRank Rank of the recorder in the process
+ * @return "<Module>.<pid>.<start>.<n>.flight"
+ */
+std::string GetFlightImageFilename(const std::string &pImageBaseFilename,
+                                   std::uint32_t pProcessId,
+                                   std::uint64_t pStartTime,
+                                   std::uint32_t pRank);
+
+/**
+ * @brief Append the records of a ring image to a binary log file, used to
+ * recover the ring of a crashed process
+ *
+ * @param pImageFilename Path of the image "<Module>.<pid>.<start>.<n>.flight"
+ * @param pOutputFilename Binary log file, its header is written if it is
+ * empty
+ * @param pUndumpedOnly Skip the records already dumped by the process
+ * @return Number of records appended, empty if the image is not valid or the
+ * file cannot be written
+ */
+std::optional<std::size_t> ExtractFlightRecording(
+    const std::string &pImageFilename, const std::string &pOutputFilename,
+    bool pUndumpedOnly = false);
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_FLIGHTRECORDER_H_
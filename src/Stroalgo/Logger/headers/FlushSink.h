@@ -0,0 +1,233 @@
+/**
+ * @file        FlushSink.h
+ * @author      ALLOGHO
+ * @brief       Flush policy of a module logger
+ * @details     Added as the last sink of a module logger, it accounts every
+ *              record written and flushes the module files in batches
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_FLUSHSINK_H_
+#define STROALGO_LOGGER_HEADERS_FLUSHSINK_H_
+
+#include <spdlog/logger.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "DurationHistogram.h"
+#include "RecordSink.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief When the records of a module are flushed to disk
+ * @details The default policy flushes every record
+ * @struct FlushPolicy
+ */
+struct FlushPolicy {
+  /**
+   * @brief Flush once this many payload bytes are pending, 0 disables it
+   */
+  std::size_t m_MaxBytes{0};
+
+  /**
+   * @brief Flush once this many records are pending, 0 disables it
+   */
+  std::size_t m_MaxRecords{0};
+
+  /**
+   * @brief Flush pending records after this delay, 0 disables it
+   */
+  std::chrono::milliseconds m_Interval{0};
+
+  /**
+   * @brief Flush immediately records at or above this level
+   */
+  spdlog::level::level_enum m_Level{spdlog::level::trace};
+
+  /**
+   * @brief Run fdatasync on the module files after each flush
+   */
+  bool m_Sync{false};
+};
+
+/**
+ * @class FlushSink
+ * @brief Sink applying a FlushPolicy to the logger owning it
+ * @details Writes nothing itself. Thread safe without lock, the policy can be
+ * changed while logging.
+ *
+ */
+class FlushSink final : public spdlog::sinks::sink, public RecordSink {
+ public:
+  /**
+   * @brief Construct a new Flush Sink object
+   *
+   * @param pPolicy Initial policy
+   */
+  explicit FlushSink(const FlushPolicy &pPolicy = FlushPolicy{});
+
+  /**
+   * @brief Attach the logger flushed by the policy, it must own the sink
+   *
+   * @param pLogger The module logger
+   */
+  void SetLogger(spdlog::logger *pLogger);
+
+  /**
+   * @brief Change the policy
+   *
+   * @param pPolicy New policy
+   */
+  void SetPolicy(const FlushPolicy &pPolicy);
+
+  /**
+   * @brief Get the current policy
+   *
+   * @return The policy
+   */
+  FlushPolicy GetPolicy() const;
+
+  /**
+   * @brief Flush if pending records are older than the policy interval
+   *
+   */
+  void FlushIfDue();
+
+  /**
+   * @brief Flush the logger now, with fdatasync if enabled
+   *
+   */
+  void FlushNow();
+
+  /**
+   * @brief Get the number of records written through the logger
+   *
+   * @return Records accounted since construction
+   */
+  inline std::uint64_t GetWrittenRecords() const {
+    return m_WrittenRecords.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the durations of the flushes, fdatasync included
+   *
+   * @return Histogram of every flush since construction
+   */
+  inline HistogramSnapshot GetFlushDurations() const {
+    return m_FlushDurations.Snapshot();
+  }
+
+  /**
+   * @brief Account a formatted record
+   *
+   * @param pMsg The record
+   */
+  void log(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Account a record from the asynchronous backend
+   *
+   * @param pRecord The record
+   */
+  void WriteRecord(const LogRecord &pRecord) override;
+
+  /**
+   * @brief Nothing to flush, the sink writes nothing
+   *
+   */
+  void flush() override {}
+
+  /**
+   * @brief Nothing to format, the sink writes nothing
+   *
+   */
+  void set_pattern(const std::string &) override {}
+
+  /**
+   * @brief Nothing to format, the sink writes nothing
+   *
+   */
+  void set_formatter(std::unique_ptr<spdlog::formatter>) override {}
+
+ private:
+  /**
+   * @brief Account a record and flush if the policy requires it
+   *
+   * @param pLevel Level of the record
+   * @param pSize Size of its payload
+   */
+  void OnRecord(spdlog::level::level_enum pLevel, std::size_t pSize);
+
+  /**
+   * @brief Current time used by the interval, in nanoseconds
+   *
+   * @return Steady clock time
+   */
+  static std::int64_t Now();
+
+  /**
+   * @brief Logger flushed by the policy
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<spdlog::logger *> m_Logger{nullptr};
+
+  /**
+   * @brief Policy fields, stored separately to be updated without lock
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<std::size_t> m_MaxBytes{0};
+  std::atomic<std::size_t> m_MaxRecords{0};
+  std::atomic<std::int64_t> m_IntervalNs{0};
+  std::atomic<int> m_Level{spdlog::level::trace};
+  std::atomic<bool> m_Sync{false};
+
+  /**
+   * @brief Payload bytes written since the last flush
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<std::size_t> m_PendingBytes{0};
+
+  /**
+   * @brief Records written since the last flush
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<std::size_t> m_PendingRecords{0};
+
+  /**
+   * @brief Time of the last flush
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<std::int64_t> m_LastFlush{0};
+
+  /**
+   * @brief Records written since construction
+   * @private
+   * @memberof FlushSink
+   */
+  std::atomic<std::uint64_t> m_WrittenRecords{0};
+
+  /**
+   * @brief Durations of the flushes
+   * @private
+   * @memberof FlushSink
+   */
+  DurationHistogram m_FlushDurations{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_FLUSHSINK_H_
@@ -0,0 +1,193 @@
+/**
+ * @file        IoUring.h
+ * @author      ALLOGHO
+ * @brief       Minimal Linux io_uring submission and completion rings
+ * @details     Only what the log file writers need : registered buffers,
+ *              fixed buffer writes and fdatasync. Uses the raw system calls,
+ *              no liburing dependency.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_IOURING_H_
+#define STROALGO_LOGGER_HEADERS_IOURING_H_
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Stroalgo::Log {
+
+/**
+ * @class IoUring
+ * @brief io_uring instance used by a single thread
+ *
+ */
+class IoUring {
+ public:
+  /**
+   * @brief Create the rings
+   *
+   * @param pEntries Size of the submission queue
+   */
+  explicit IoUring(unsigned pEntries);
+
+  /**
+   * @brief Destroy the rings, submitted operations still complete
+   *
+   */
+  ~IoUring();
+
+  IoUring(const IoUring &) = delete;
+  IoUring &operator=(const IoUring &) = delete;
+
+  /**
+   * @brief Check if io_uring can be used by the process (kernel version,
+   * seccomp filters, ...)
+   *
+   * @return true if an instance can be created
+   */
+  static bool IsSupported();
+
+  /**
+   * @brief Check if the rings have been created
+   *
+   * @return true if operations can be submitted
+   */
+  inline bool IsValid() const { return m_Ring >= 0; }
+
+  /**
+   * @brief Register the buffers of the fixed buffer writes
+   *
+   * @param pBuffers The buffers, they must outlive the rings
+   * @param pCount Number of buffers
+   * @return true on success
+   */
+  bool RegisterBuffers(const iovec *pBuffers, unsigned pCount);
+
+  /**
+   * @brief Queue a write from a registered buffer
+   *
+   * @param pFile Descriptor of the file
+   * @param pData First byte, inside the registered buffer
+   * @param pSize Number of bytes
+   * @param pOffset Offset in the file
+   * @param pBufferIndex Index of the registered buffer
+   * @param pUserData Returned with the completion
+   * @return false if the submission queue is full
+   */
+  bool PrepareWriteFixed(int pFile, const char *pData, std::uint32_t pSize,
+                         std::uint64_t pOffset, std::uint16_t pBufferIndex,
+                         std::uint64_t pUserData);
+
+  /**
+   * @brief Queue a fdatasync started once the operations queued before it are
+   * completed
+   *
+   * @param pFile Descriptor of the file
+   * @param pUserData Returned with the completion
+   * @return false if the submission queue is full
+   */
+  bool PrepareDataSync(int pFile, std::uint64_t pUserData);
+
+  /**
+   * @brief Submit the queued operations in one system call
+   *
+   * @param pWaitCompletions Number of completions to wait for, 0 to return
+   * immediately
+   * @return false if the kernel rejected the submission
+   */
+  bool Submit(unsigned pWaitCompletions = 0);
+
+  /**
+   * @brief Take a completion
+   *
+   * @param pUserData User data of the completed operation
+   * @param pResult Result of the operation, negative errno on failure
+   * @return false if no completion is available
+   */
+  bool PopCompletion(std::uint64_t &pUserData, std::int32_t &pResult);
+
+ private:
+  /**
+   * @brief Get the next free submission entry
+   *
+   * @return The entry cleared, null if the queue is full
+   */
+  io_uring_sqe *NextEntry();
+
+  /**
+   * @brief Descriptor of the instance, -1 if not created
+   * @private
+   * @memberof IoUring
+   */
+  int m_Ring{-1};
+
+  /**
+   * @brief Mapped submission ring and its size
+   * @private
+   * @memberof IoUring
+   */
+  void *m_SubmitRing{nullptr};
+  std::size_t m_SubmitRingSize{0};
+
+  /**
+   * @brief Mapped completion ring and its size, same as the submission ring
+   * on kernels sharing the mapping
+   * @private
+   * @memberof IoUring
+   */
+  void *m_CompleteRing{nullptr};
+  std::size_t m_CompleteRingSize{0};
+
+  /**
+   * @brief Mapped submission entries and their size
+   * @private
+   * @memberof IoUring
+   */
+  io_uring_sqe *m_Entries{nullptr};
+  std::size_t m_EntriesSize{0};
+
+  /**
+   * @brief Submission ring fields
+   * @private
+   * @memberof IoUring
+   */
+  unsigned *m_SubmitHead{nullptr};
+  unsigned *m_SubmitTail{nullptr};
+  unsigned *m_SubmitArray{nullptr};
+  unsigned m_SubmitMask{0};
+  unsigned m_SubmitEntries{0};
+
+  /**
+   * @brief Completion ring fields
+   * @private
+   * @memberof IoUring
+   */
+  unsigned *m_CompleteHead{nullptr};
+  unsigned *m_CompleteTail{nullptr};
+  io_uring_cqe *m_Completions{nullptr};
+  unsigned m_CompleteMask{0};
+
+  /**
+   * @brief Entries filled and not published to the kernel yet
+   * @private
+   * @memberof IoUring
+   */
+  unsigned m_Unpublished{0};
+
+  /**
+   * @brief Operations queued and not submitted yet
+   * @private
+   * @memberof IoUring
+   */
+  unsigned m_Queued{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_IOURING_H_
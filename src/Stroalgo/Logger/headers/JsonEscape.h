@@ -0,0 +1,121 @@
+/**
+ * @file        JsonEscape.h
+ * @author      ALLOGHO
+ * @brief       Escaping of the strings written in JSON log outputs
+ * @details     Shared by the JSON sinks, the query results and
+ *              stroalgo-logcat
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_JSONESCAPE_H_
+#define STROALGO_LOGGER_HEADERS_JSONESCAPE_H_
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Check if a character must be escaped in a JSON string
+ *
+ * @param pChar The character
+ * @return true for quotes, backslashes and control characters
+ */
+constexpr bool IsJsonSpecial(char pChar) {
+  return pChar == '"' || pChar == '\\' ||
+         static_cast<unsigned char>(pChar) < 0x20;
+}
+
+/**
+ * @brief Check if 8 characters may hold one to escape, without branching on
+ * each of them
+ * @note A word holding one may report the following characters too, they
+ * are checked one by one
+ *
+ * @param pWord 8 characters loaded in a word
+ * @return false if none of them must be escaped
+ */
+constexpr bool MayHoldJsonSpecial(std::uint64_t pWord) {
+  constexpr std::uint64_t lOnes{0x0101010101010101};
+  constexpr std::uint64_t lHigh{0x8080808080808080};
+  const std::uint64_t lQuote{pWord ^ (lOnes * '"')};
+  const std::uint64_t lBackslash{pWord ^ (lOnes * '\\')};
+  const std::uint64_t lControl{(pWord - lOnes * 0x20) & ~pWord};
+  const std::uint64_t lZeroQuote{(lQuote - lOnes) & ~lQuote};
+  const std::uint64_t lZeroBackslash{(lBackslash - lOnes) & ~lBackslash};
+  return ((lControl | lZeroQuote | lZeroBackslash) & lHigh) != 0;
+}
+
+/**
+ * @brief Write a string as a JSON string value
+ * @details Runs of characters not to escape are found 8 at a time and copied
+ * at once
+ *
+ * @param pOut Destination buffer
+ * @param pValue String to escape
+ */
+inline void AppendJsonString(spdlog::memory_buf_t &pOut,
+                             std::string_view pValue) {
+  const char *lData{pValue.data()};
+  const std::size_t lSize{pValue.size()};
+  std::size_t lCopied{0};
+  std::size_t lPos{0};
+  pOut.push_back('"');
+  while (lPos < lSize) {
+    std::uint64_t lWord{0};
+    while (lPos + sizeof(lWord) <= lSize) {
+      std::memcpy(&lWord, lData + lPos, sizeof(lWord));
+      if (MayHoldJsonSpecial(lWord)) {
+        break;
+      }
+      lPos += sizeof(lWord);
+    }
+
+    const std::size_t lEnd{std::min(lPos + sizeof(lWord), lSize)};
+    for (; lPos < lEnd; ++lPos) {
+      const char lChar{lData[lPos]};
+      if (!IsJsonSpecial(lChar)) {
+        continue;
+      }
+      pOut.append(lData + lCopied, lData + lPos);
+      lCopied = lPos + 1;
+      switch (lChar) {
+        case '"':
+          pOut.append(std::string_view{"\\\""});
+          break;
+        case '\\':
+          pOut.append(std::string_view{"\\\\"});
+          break;
+        case '\n':
+          pOut.append(std::string_view{"\\n"});
+          break;
+        case '\r':
+          pOut.append(std::string_view{"\\r"});
+          break;
+        case '\t':
+          pOut.append(std::string_view{"\\t"});
+          break;
+        default:
+          fmt::format_to(std::back_inserter(pOut), "\\u{:04x}",
+                         static_cast<unsigned int>(lChar));
+          break;
+      }
+    }
+  }
+  pOut.append(lData + lCopied, lData + lSize);
+  pOut.push_back('"');
+}
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_JSONESCAPE_H_
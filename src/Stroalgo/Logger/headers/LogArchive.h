@@ -0,0 +1,438 @@
+/**
+ * @file        LogArchive.h
+ * @author      ALLOGHO
+ * @brief       Block compressed archives of the log files of previous days
+ * @details     An archive "<file>.slz" holds the bytes of a log file split in
+ *              blocks compressed independently with zlib, followed by an
+ *              index of the blocks. A reader seeking to an offset of the
+ *              original file only decompresses the block holding it, so the
+ *              time index of a binary log file, renamed "<file>.slz.idx",
+ *              still applies. Integers are little-endian.
+ *
+ *              Header  : magic "SLZA", u16 version
+ *              Blocks  : zlib streams
+ *              Index   : per block u64 offset in the original file,
+ *                        u32 original size, u64 offset in the archive,
+ *                        u32 compressed size
+ *              Trailer : u32 number of blocks, magic "SLZI"
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGARCHIVE_H_
+#define STROALGO_LOGGER_HEADERS_LOGARCHIVE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Magic bytes starting every archive
+ */
+constexpr std::string_view c_LogArchiveMagic{"SLZA"};
+
+/**
+ * @brief Magic bytes ending every complete archive
+ */
+constexpr std::string_view c_LogArchiveIndexMagic{"SLZI"};
+
+/**
+ * @brief Version of the archive layout
+ */
+constexpr std::uint16_t c_LogArchiveVersion{1};
+
+/**
+ * @brief Extension appended to the name of an archived log file
+ */
+constexpr std::string_view c_LogArchiveExtension{".slz"};
+
+/**
+ * @brief Bytes of the original file per compressed block, a seek decompresses
+ * one block at most
+ */
+constexpr std::size_t c_DefaultArchiveBlockSize{64 * 1024};
+
+/**
+ * @brief Check if a file is an archive
+ *
+ * @param pFilePath Path of the file
+ * @return true if its name ends with the archive extension
+ */
+inline bool IsLogArchive(const std::filesystem::path &pFilePath) {
+  return pFilePath.extension() == c_LogArchiveExtension;
+}
+
+/**
+ * @brief Get the path of the archive of a log file
+ *
+ * @param pFilePath Path of the log file
+ * @return Path of its archive
+ */
+inline std::string GetLogArchiveFilename(const std::string &pFilePath) {
+  return pFilePath + std::string(c_LogArchiveExtension);
+}
+
+/**
+ * @brief Get the path of the log file held by an archive
+ *
+ * @param pFilePath Path of an archive or of a log file
+ * @return Path without the archive extension
+ */
+inline std::filesystem::path GetArchivedLogPath(
+    const std::filesystem::path &pFilePath) {
+  return IsLogArchive(pFilePath) ? std::filesystem::path{pFilePath}
+                                       .replace_extension()
+                                 : pFilePath;
+}
+
+/**
+ * @brief Get the day of a daily file from its name "<Module>_YYYY-MM-DD.ext"
+ *
+ * @param pFilePath Path of the file
+ * @return The date, empty if the name does not end with a date
+ */
+std::string GetLogFileDate(const std::filesystem::path &pFilePath);
+
+/**
+ * @brief Remove a log file or an archive with its index and tombstones
+ *
+ * @param pFilePath Path of the file
+ */
+void RemoveLogFile(const std::string &pFilePath);
+
+/**
+ * @brief Compressed block of an archive
+ * @struct LogArchiveBlock
+ */
+struct LogArchiveBlock {
+  /**
+   * @brief Offset of the block in the original file
+   */
+  std::uint64_t m_Begin{0};
+
+  /**
+   * @brief Size of the block in the original file
+   */
+  std::uint32_t m_Length{0};
+
+  /**
+   * @brief Offset of the zlib stream in the archive
+   */
+  std::uint64_t m_Offset{0};
+
+  /**
+   * @brief Size of the zlib stream
+   */
+  std::uint32_t m_Size{0};
+};
+
+/**
+ * @brief Compress a log file into its archive, the log file is left in place
+ *
+ * @param pFilePath Path of the log file
+ * @param pBlockSize Bytes of the log file per block
+ * @return false if the file could not be read or the archive written
+ */
+bool WriteLogArchive(const std::string &pFilePath,
+                     std::size_t pBlockSize = c_DefaultArchiveBlockSize);
+
+/**
+ * @class LogArchiveBuffer
+ * @brief Read only stream buffer over the original bytes of an archive
+ *
+ */
+class LogArchiveBuffer final : public std::streambuf {
+ public:
+  /**
+   * @brief Open an archive and load its index
+   *
+   * @param pFilePath Path of the archive
+   */
+  explicit LogArchiveBuffer(const std::string &pFilePath);
+
+  /**
+   * @brief Check if the archive has been opened and its index loaded
+   *
+   * @return true if the original bytes can be read
+   */
+  inline bool IsValid() const { return m_Valid; }
+
+  /**
+   * @brief Get the blocks of the archive
+   *
+   * @return Blocks in file order
+   */
+  inline const std::vector<LogArchiveBlock> &GetBlocks() const {
+    return m_Blocks;
+  }
+
+  /**
+   * @brief Get the size of the original file
+   *
+   * @return Size in bytes
+   */
+  std::uint64_t GetSize() const;
+
+ protected:
+  /**
+   * @brief Decompress the block following the current one
+   *
+   * @return Next byte, eof at the end of the original file
+   */
+  int_type underflow() override;
+
+  /**
+   * @brief Move in the original bytes
+   *
+   * @param pOffset Offset from pDirection
+   * @param pDirection Origin of the offset
+   * @param pMode Only input is supported
+   * @return New position, -1 on failure
+   */
+  pos_type seekoff(off_type pOffset, std::ios_base::seekdir pDirection,
+                   std::ios_base::openmode pMode) override;
+
+  /**
+   * @brief Move in the original bytes
+   *
+   * @param pPosition Position in the original file
+   * @param pMode Only input is supported
+   * @return New position, -1 on failure
+   */
+  pos_type seekpos(pos_type pPosition, std::ios_base::openmode pMode) override;
+
+ private:
+  /**
+   * @brief Get the position of the next byte read
+   *
+   * @return Position in the original file
+   */
+  std::uint64_t GetPosition() const;
+
+  /**
+   * @brief Decompress the block holding a position and make it current
+   *
+   * @param pPosition Position in the original file
+   * @return false past the end or on a corrupted block
+   */
+  bool LoadBlock(std::uint64_t pPosition);
+
+  /**
+   * @brief Opened archive
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  std::ifstream m_File{};
+
+  /**
+   * @brief Index has been loaded
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  bool m_Valid{false};
+
+  /**
+   * @brief Blocks of the archive
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  std::vector<LogArchiveBlock> m_Blocks{};
+
+  /**
+   * @brief Index of the decompressed block, the number of blocks if none
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  std::size_t m_Current{0};
+
+  /**
+   * @brief Position of the next byte read when no block is decompressed
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  std::uint64_t m_Position{0};
+
+  /**
+   * @brief Original bytes of the current block
+   * @private
+   * @memberof LogArchiveBuffer
+   */
+  std::string m_Data{};
+};
+
+/**
+ * @brief Open a log file for reading, archives are decompressed on the fly
+ *
+ * @param pFilePath Path of a log file or of an archive
+ * @return Stream buffer over the original bytes
+ */
+std::unique_ptr<std::streambuf> OpenLogFileBuffer(const std::string &pFilePath);
+
+/**
+ * @brief Archiving of the log files of the previous days
+ * @struct ArchiveOptions
+ */
+struct ArchiveOptions {
+  /**
+   * @brief Time between two archiving rounds
+   */
+  std::chrono::milliseconds m_Interval{std::chrono::minutes{10}};
+
+  /**
+   * @brief Time without write before a file is archived, data still
+   * buffered by a sink after midnight must not be lost
+   */
+  std::chrono::milliseconds m_MinAge{std::chrono::hours{1}};
+
+  /**
+   * @brief Bytes of the log files per compressed block
+   */
+  std::size_t m_BlockSize{c_DefaultArchiveBlockSize};
+
+  /**
+   * @brief Archives older than this number of days are removed, like the
+   * daily files they replace, 0 to keep them
+   */
+  std::uint16_t m_MaxDays{31};
+};
+
+/**
+ * @class LogArchiver
+ * @brief Thread replacing the text, JSON and binary files of the previous
+ * days by their archives
+ *
+ */
+class LogArchiver {
+ public:
+  /**
+   * @brief Construct a new Log Archiver object and start its thread
+   *
+   * @param pDirectory Directory holding a sub directory per module
+   * @param pOptions Archiving options
+   */
+  LogArchiver(std::string pDirectory, const ArchiveOptions &pOptions);
+
+  /**
+   * @brief Destroy the Log Archiver object, the file being archived is
+   * finished
+   *
+   */
+  ~LogArchiver();
+
+  LogArchiver(const LogArchiver &) = delete;
+  LogArchiver &operator=(const LogArchiver &) = delete;
+
+  /**
+   * @brief Start an archiving round without waiting for the interval
+   *
+   */
+  void Wake();
+
+  /**
+   * @brief Stop the thread
+   *
+   */
+  void Stop();
+
+  /**
+   * @brief Archive every file of a previous day not written for the minimal
+   * age, then remove the expired archives
+   * @note Binary files having tombstones are compacted first
+   *
+   * @return Number of files archived
+   */
+  std::size_t ArchivePending();
+
+  /**
+   * @brief Replace a log file by its archive, its index and tombstones
+   * follow it
+   * @note Holds the LogFileLock of the file
+   *
+   * @param pFilePath Path of the log file
+   * @param pBlockSize Bytes of the log file per block
+   * @return false if the archive could not be written, the log file is kept
+   */
+  static bool ArchiveFile(const std::string &pFilePath,
+                          std::size_t pBlockSize = c_DefaultArchiveBlockSize);
+
+ private:
+  /**
+   * @brief Thread loop
+   *
+   */
+  void Run();
+
+  /**
+   * @brief Directory holding a sub directory per module
+   * @private
+   * @memberof LogArchiver
+   */
+  const std::string m_Directory;
+
+  /**
+   * @brief Archiving options
+   * @private
+   * @memberof LogArchiver
+   */
+  const ArchiveOptions m_Options;
+
+  /**
+   * @brief Serializes the rounds of the thread and of ArchivePending
+   * @private
+   * @memberof LogArchiver
+   */
+  std::mutex m_ArchiveMutex{};
+
+  /**
+   * @brief Protects the wake up and stop flags
+   * @private
+   * @memberof LogArchiver
+   */
+  std::mutex m_Mutex{};
+
+  /**
+   * @brief Signaled by Wake and Stop
+   * @private
+   * @memberof LogArchiver
+   */
+  std::condition_variable m_Condition{};
+
+  /**
+   * @brief A round has been requested
+   * @private
+   * @memberof LogArchiver
+   */
+  bool m_Woken{false};
+
+  /**
+   * @brief The thread must return
+   * @private
+   * @memberof LogArchiver
+   */
+  bool m_Stop{false};
+
+  /**
+   * @brief Archiving thread
+   * @private
+   * @memberof LogArchiver
+   */
+  std::thread m_Thread{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGARCHIVE_H_
@@ -0,0 +1,137 @@
+/**
+ * @file        LogClock.h
+ * @author      ALLOGHO
+ * @brief       Time source of the records and rendering of local dates
+ * @details     The records are stamped with the precise system clock, or
+ *              with the coarse clock of the kernel (CLOCK_REALTIME_COARSE,
+ *              a few milliseconds resolution read without a system call).
+ *              Local dates are rendered in fixed size buffers, the time zone
+ *              conversion runs once per quarter of an hour and per thread,
+ *              later seconds are derived from it.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGCLOCK_H_
+#define STROALGO_LOGGER_HEADERS_LOGCLOCK_H_
+
+#include <spdlog/common.h>
+
+#include <array>
+#include <cstddef>
+#include <ctime>
+#include <string_view>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Clock stamping the records
+ */
+enum class ClockSource {
+  /**
+   * @brief System clock, microseconds resolution
+   */
+  Precise,
+
+  /**
+   * @brief Coarse kernel clock, cheaper but only advancing every tick, the
+   * precise clock where it is not available
+   */
+  Coarse
+};
+
+/**
+ * @brief Number of characters of a date "YYYY-MM-DD"
+ */
+constexpr std::size_t c_LocalDateSize{10};
+
+/**
+ * @brief Number of characters of a date and time "YYYY-MM-DD HH:MM:SS"
+ */
+constexpr std::size_t c_LocalDateTimeSize{19};
+
+/**
+ * @brief Local date rendered without allocation
+ * @struct LocalDate
+ */
+struct LocalDate {
+  /**
+   * @brief Get the date as a string
+   *
+   * @return "YYYY-MM-DD"
+   */
+  inline std::string_view View() const {
+    return std::string_view{m_Text.data(), m_Text.size()};
+  }
+
+  /**
+   * @brief Characters of the date
+   */
+  std::array<char, c_LocalDateSize> m_Text{};
+};
+
+/**
+ * @brief Select the clock stamping the records
+ *
+ * @param pSource The clock, used by the records written after the call
+ */
+void SetLogClockSource(ClockSource pSource);
+
+/**
+ * @brief Get the clock stamping the records
+ *
+ * @return The clock
+ */
+ClockSource GetLogClockSource();
+
+/**
+ * @brief Read the clock stamping the records
+ *
+ * @return Current time
+ */
+spdlog::log_clock::time_point LogClockNow();
+
+/**
+ * @brief Write a number with a fixed number of digits
+ *
+ * @param pDest First character to write
+ * @param pValue Positive value
+ * @param pDigits Number of digits, leading zeros included
+ */
+inline void WriteDigits(char *pDest, long pValue, int pDigits) {
+  for (int lDigit = pDigits - 1; lDigit >= 0; --lDigit) {
+    pDest[lDigit] = static_cast<char>('0' + pValue % 10);
+    pValue /= 10;
+  }
+}
+
+/**
+ * @brief Render a local date and time
+ *
+ * @param pSecond Time to render
+ * @param pDest Receives "YYYY-MM-DD HH:MM:SS", c_LocalDateTimeSize
+ * characters
+ * @return Offset of the local time from UTC, in minutes
+ */
+int FormatLocalDateTime(std::time_t pSecond, char *pDest);
+
+/**
+ * @brief Render a local date
+ *
+ * @param pSecond Time to render
+ * @return The date
+ */
+LocalDate FormatLocalDate(std::time_t pSecond);
+
+/**
+ * @brief Render the current local date, as written in the log file names
+ *
+ * @return The date
+ */
+LocalDate CurrentLocalDate();
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGCLOCK_H_
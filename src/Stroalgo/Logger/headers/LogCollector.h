@@ -0,0 +1,162 @@
+/**
+ * @file        LogCollector.h
+ * @author      ALLOGHO
+ * @brief       Collector writing the records of every producer process of
+ *              the host
+ * @details     The producers enabling Logger::EnableSharedTransport write
+ *              their records into a shared memory ring each. The collector
+ *              finds the rings of a transport in the directory where Linux
+ *              exposes the POSIX shared memory, drains them into the sinks
+ *              of the Logger of its own process, which owns the files, their
+ *              rotation and their indexes, and removes the ring of a
+ *              producer once it has exited and its last records are
+ *              written. A restarted producer comes with a new ring, a
+ *              restarted collector goes on where the last one stopped.
+ *
+ *              A ring is released after its records are written, so a
+ *              collector killed while writing them writes them again when
+ *              restarted. Producers and collector must share the process id
+ *              namespace of the host.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGCOLLECTOR_H_
+#define STROALGO_LOGGER_HEADERS_LOGCOLLECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "Logger.h"
+#include "SharedLogTransport.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Rings drained by the collector and files it writes
+ * @struct CollectorOptions
+ */
+struct CollectorOptions {
+  /**
+   * @brief Name of the transport used by the producers
+   */
+  std::string m_Name{c_DefaultSharedLogName};
+
+  /**
+   * @brief Directory exposing the POSIX shared memory segments
+   */
+  std::string m_Directory{"/dev/shm"};
+
+  /**
+   * @brief Files written for the modules of the producers, without console
+   * by default
+   */
+  LogFileFormats m_FileFormats{false};
+
+  /**
+   * @brief Records written from a ring before it is released to its producer
+   */
+  std::size_t m_BatchRecords{4096};
+};
+
+/**
+ * @brief Work done by the collector since it started
+ * @struct CollectorCounters
+ */
+struct CollectorCounters {
+  /**
+   * @brief Rings currently drained
+   */
+  std::uint64_t m_Producers{0};
+
+  /**
+   * @brief Rings removed after their producer exited
+   */
+  std::uint64_t m_Departed{0};
+
+  /**
+   * @brief Records written
+   */
+  std::uint64_t m_Collected{0};
+
+  /**
+   * @brief Records dropped by the producers because their ring was full
+   */
+  std::uint64_t m_Dropped{0};
+};
+
+/**
+ * @class LogCollector
+ * @brief Drains the shared memory rings of the producers into the Logger
+ * @details Used by a single thread, see the stroalgo-logcollector tool.
+ *
+ */
+class LogCollector {
+ public:
+  /**
+   * @brief Construct a new Log Collector object, the rings are found by the
+   * first round
+   *
+   * @param pOptions Transport name and files written
+   */
+  explicit LogCollector(CollectorOptions pOptions);
+
+  /**
+   * @brief Find the new rings, write their pending records and remove the
+   * rings of the exited producers
+   *
+   * @return Number of records written
+   */
+  std::size_t CollectPending();
+
+  /**
+   * @brief Get the work done since the collector started
+   *
+   * @return The counters
+   */
+  inline const CollectorCounters &GetCounters() const { return m_Counters; }
+
+ private:
+  /**
+   * @brief Map the rings of the transport not drained yet
+   *
+   */
+  void Discover();
+
+  /**
+   * @brief Write a record, registering its module if it is unknown
+   *
+   * @param pRecord The record
+   */
+  void Write(const SharedLogRecord &pRecord);
+
+  /**
+   * @brief Transport name and files written
+   * @private
+   * @memberof LogCollector
+   */
+  const CollectorOptions m_Options;
+
+  /**
+   * @brief Rings drained, by segment name
+   * @private
+   * @memberof LogCollector
+   */
+  std::map<std::string, std::unique_ptr<SharedLogSegment>> m_Segments{};
+
+  /**
+   * @brief Work done
+   * @private
+   * @memberof LogCollector
+   */
+  CollectorCounters m_Counters{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGCOLLECTOR_H_
@@ -0,0 +1,173 @@
+/**
+ * @file        LogCompactor.h
+ * @author      ALLOGHO
+ * @brief       Background compaction of the binary log files
+ * @details     Files having tombstones are rewritten one at a time without
+ *              their deleted records, then their tombstones are removed.
+ *              Archives are decompressed and compressed again. The file of
+ *              the current day is still written by its sink and is only
+ *              compacted once the day is over and the file has not been
+ *              written for a while, as the sink keeps the file of the
+ *              previous day open until its first record after midnight.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGCOMPACTOR_H_
+#define STROALGO_LOGGER_HEADERS_LOGCOMPACTOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Time between two compaction rounds when not woken up
+ */
+constexpr std::chrono::milliseconds c_DefaultCompactInterval{60000};
+
+/**
+ * @brief Time without write before a file of a previous day is compacted
+ */
+constexpr std::chrono::milliseconds c_DefaultCompactMinAge{
+    std::chrono::hours{1}};
+
+/**
+ * @class LogCompactor
+ * @brief Thread reclaiming the space of the deleted records
+ *
+ */
+class LogCompactor {
+ public:
+  /**
+   * @brief Construct a new Log Compactor object and start its thread
+   *
+   * @param pDirectory Directory holding a sub directory per module
+   * @param pInterval Time between two compaction rounds
+   * @param pMinAge Time without write before a file is compacted
+   */
+  explicit LogCompactor(
+      std::string pDirectory,
+      std::chrono::milliseconds pInterval = c_DefaultCompactInterval,
+      std::chrono::milliseconds pMinAge = c_DefaultCompactMinAge);
+
+  /**
+   * @brief Destroy the Log Compactor object, the file being compacted is
+   * finished
+   *
+   */
+  ~LogCompactor();
+
+  LogCompactor(const LogCompactor &) = delete;
+  LogCompactor &operator=(const LogCompactor &) = delete;
+
+  /**
+   * @brief Start a compaction round without waiting for the interval
+   *
+   */
+  void Wake();
+
+  /**
+   * @brief Stop the thread
+   *
+   */
+  void Stop();
+
+  /**
+   * @brief Compact every file or archive having tombstones, except the files
+   * of the current day and the files written recently
+   *
+   * @return Number of files compacted
+   */
+  std::size_t CompactPending();
+
+  /**
+   * @brief Rewrite a binary log file or archive without its deleted records,
+   * the file is removed if no record is left
+   * @note Holds the LogFileLock of the file
+   *
+   * @param pFilePath Path of the binary log file or of its archive
+   * @return false if the file has no tombstone or could not be rewritten
+   */
+  static bool CompactFile(const std::string &pFilePath);
+
+ private:
+  /**
+   * @brief Thread loop
+   *
+   */
+  void Run();
+
+  /**
+   * @brief Directory holding a sub directory per module
+   * @private
+   * @memberof LogCompactor
+   */
+  const std::string m_Directory;
+
+  /**
+   * @brief Time between two compaction rounds
+   * @private
+   * @memberof LogCompactor
+   */
+  const std::chrono::milliseconds m_Interval;
+
+  /**
+   * @brief Time without write before a file is compacted
+   * @private
+   * @memberof LogCompactor
+   */
+  const std::chrono::milliseconds m_MinAge;
+
+  /**
+   * @brief Serializes the compactions of the thread and of CompactPending
+   * @private
+   * @memberof LogCompactor
+   */
+  std::mutex m_CompactMutex{};
+
+  /**
+   * @brief Protects the wake up and stop flags
+   * @private
+   * @memberof LogCompactor
+   */
+  std::mutex m_Mutex{};
+
+  /**
+   * @brief Signaled by Wake and Stop
+   * @private
+   * @memberof LogCompactor
+   */
+  std::condition_variable m_Condition{};
+
+  /**
+   * @brief A round has been requested
+   * @private
+   * @memberof LogCompactor
+   */
+  bool m_Woken{false};
+
+  /**
+   * @brief The thread must return
+   * @private
+   * @memberof LogCompactor
+   */
+  bool m_Stop{false};
+
+  /**
+   * @brief Compaction thread
+   * @private
+   * @memberof LogCompactor
+   */
+  std::thread m_Thread{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGCOMPACTOR_H_
@@ -0,0 +1,60 @@
+/**
+ * @file        LogFileLock.h
+ * @author      ALLOGHO
+ * @brief       Process-wide lock of the log files maintained in background
+ * @details     The compactor, the archiver and the retention thread rewrite,
+ *              compress or remove the files of the previous days. Each of
+ *              them holds the lock of a file while it works on it, a log file
+ *              and its archive share one lock.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGFILELOCK_H_
+#define STROALGO_LOGGER_HEADERS_LOGFILELOCK_H_
+
+#include <filesystem>
+#include <string>
+
+namespace Stroalgo::Log {
+
+/**
+ * @class LogFileLock
+ * @brief Holds the lock of a log file for its lifetime
+ * @details Not recursive, a thread holding the lock of a file must not take
+ * it again.
+ *
+ */
+class LogFileLock {
+ public:
+  /**
+   * @brief Construct a new Log File Lock object, waiting until no other
+   * thread holds the lock of the file
+   *
+   * @param pFilePath Path of a log file or of its archive
+   */
+  explicit LogFileLock(const std::filesystem::path &pFilePath);
+
+  /**
+   * @brief Destroy the Log File Lock object, releasing the lock
+   *
+   */
+  ~LogFileLock();
+
+  LogFileLock(const LogFileLock &) = delete;
+  LogFileLock &operator=(const LogFileLock &) = delete;
+
+ private:
+  /**
+   * @brief Absolute path of the log file, without archive extension
+   * @private
+   * @memberof LogFileLock
+   */
+  const std::string m_Key;
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGFILELOCK_H_
@@ -0,0 +1,76 @@
+/**
+ * @file        LogMacros.h
+ * @author      ALLOGHO
+ * @brief       Logging macros removing levels below a compile-time floor
+ * @details     The floor comes from STROALGO_LOG_ACTIVE_LEVEL, defined per
+ *              target by the target_log_active_level CMake function. Calls
+ *              below the floor compile to nothing and their arguments are
+ *              never evaluated. Calls above it check the runtime level first,
+ *              their arguments are only evaluated if the level is written.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGMACROS_H_
+#define STROALGO_LOGGER_HEADERS_LOGMACROS_H_
+
+#include <spdlog/common.h>
+
+/**
+ * @brief Lowest level compiled in, uses spdlog numbering (0 = trace,
+ * 6 = off). Every level is kept when the build does not define it.
+ */
+#ifndef STROALGO_LOG_ACTIVE_LEVEL
+#define STROALGO_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Check if a level is kept by a compile-time floor
+ *
+ * @param pLogLevel Level of the log call
+ * @param pActiveLevel Compile-time floor
+ * @return true if calls at this level must be compiled in
+ */
+constexpr bool IsLevelCompiledIn(const spdlog::level::level_enum pLogLevel,
+                                 const int pActiveLevel) {
+  return static_cast<int>(pLogLevel) >= pActiveLevel &&
+         pLogLevel != spdlog::level::off;
+}
+
+}  // namespace Stroalgo::Log
+
+/**
+ * @brief Call a log method only if its level is compiled in and written at
+ * runtime
+ * @details pLogger is a ModuleLogger handle or the Logger itself, remaining
+ * arguments are forwarded to the method. The Logger itself only knows if
+ * some module writes the level, the module is checked again by the method.
+ */
+#define STROALGO_LOG_CALL(pLogLevel, pMethod, pLogger, ...)         \
+  do {                                                              \
+    if constexpr (::Stroalgo::Log::IsLevelCompiledIn(               \
+                      pLogLevel, STROALGO_LOG_ACTIVE_LEVEL)) {      \
+      if ((pLogger).ShouldLog(pLogLevel)) {                         \
+        (pLogger).pMethod(__VA_ARGS__);                             \
+      }                                                             \
+    }                                                               \
+  } while (false)
+
+#define STROALGO_LOG_TRACE(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::trace, Trace, pLogger, __VA_ARGS__)
+#define STROALGO_LOG_DEBUG(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::debug, Debug, pLogger, __VA_ARGS__)
+#define STROALGO_LOG_INFO(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::info, Info, pLogger, __VA_ARGS__)
+#define STROALGO_LOG_WARNING(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::warn, Warning, pLogger, __VA_ARGS__)
+#define STROALGO_LOG_ERROR(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::err, Error, pLogger, __VA_ARGS__)
+#define STROALGO_LOG_CRITICAL(pLogger, ...) \
+  STROALGO_LOG_CALL(::spdlog::level::critical, Critical, pLogger, __VA_ARGS__)
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGMACROS_H_
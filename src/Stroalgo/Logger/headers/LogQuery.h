@@ -0,0 +1,377 @@
+/**
+ * @file        LogQuery.h
+ * @author      ALLOGHO
+ * @brief       Query of the binary log files with constant memory
+ * @details     Records are read through the index of the files and handed to
+ *              the caller in time order, or written as a JSON array of
+ *              LogItem (api/logger.yaml) in chunks of bounded size. A limit
+ *              stops the query and a cursor resumes it. Memory is bounded by
+ *              two batches of records per file.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGQUERY_H_
+#define STROALGO_LOGGER_HEADERS_LOGQUERY_H_
+
+#include <spdlog/common.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Number of records read at once by a query worker
+ */
+constexpr std::size_t c_QueryBatchSize{64};
+
+/**
+ * @brief Size from which a chunk of JSON query results is handed out
+ */
+constexpr std::size_t c_DefaultQueryChunkSize{64 * 1024};
+
+/**
+ * @brief Parameters of a log query
+ * @struct LogQueryOptions
+ */
+struct LogQueryOptions {
+  /**
+   * @brief Directory holding a sub directory per module
+   */
+  std::string m_Directory{"Logs"};
+
+  /**
+   * @brief Module queried, empty for every module
+   */
+  std::string m_Module{};
+
+  /**
+   * @brief Oldest time returned
+   */
+  spdlog::log_clock::time_point m_Start{spdlog::log_clock::time_point::min()};
+
+  /**
+   * @brief Newest time returned
+   */
+  spdlog::log_clock::time_point m_End{spdlog::log_clock::time_point::max()};
+
+  /**
+   * @brief Levels returned, see GetLevelMask
+   */
+  std::uint8_t m_Levels{c_AllLevelsMask};
+
+  /**
+   * @brief Maximum number of records returned, 0 for no limit
+   */
+  std::size_t m_Limit{0};
+
+  /**
+   * @brief Cursor returned by a previous query with the same parameters,
+   * empty to start from the first record. Holds "<file>@<offset>" of every
+   * file read, separated by '|'
+   */
+  std::string m_Cursor{};
+
+  /**
+   * @brief Number of files read in parallel, 0 for the number of cores
+   */
+  std::size_t m_Threads{0};
+};
+
+/**
+ * @brief Record returned by a query
+ * @struct LogQueryItem
+ */
+struct LogQueryItem {
+  /**
+   * @brief Module which wrote the record
+   */
+  std::string m_Module{};
+
+  /**
+   * @brief The record
+   */
+  BinaryLogEntry m_Entry{};
+};
+
+/**
+ * @class LogQuery
+ * @brief Iterate over the records of the binary log files matching a query,
+ * in time order. Files are read in parallel by a bounded pool of workers, a
+ * few batches of records ahead, and merged by time
+ *
+ */
+class LogQuery {
+ public:
+  /**
+   * @brief Select the files of the query, no record is read yet
+   *
+   * @param pOptions Parameters of the query
+   * @throw Stroalgo::Exceptions::LoggerException if the cursor is not valid
+   */
+  explicit LogQuery(LogQueryOptions pOptions);
+
+  /**
+   * @brief Destroy the Log Query object, the workers are stopped
+   *
+   */
+  ~LogQuery();
+
+  LogQuery(const LogQuery &) = delete;
+  LogQuery &operator=(const LogQuery &) = delete;
+
+  /**
+   * @brief Read the next record, the workers are started by the first call
+   *
+   * @param pItem Record read
+   * @return false once every record or the limit has been returned
+   */
+  bool Next(LogQueryItem &pItem);
+
+  /**
+   * @brief Get the cursor resuming the query after the records returned
+   *
+   * @return Cursor to set in LogQueryOptions, empty if no record is left
+   */
+  inline const std::string &GetCursor() const { return m_Cursor; }
+
+  /**
+   * @brief Get the files selected by the query
+   *
+   * @return Paths, by day then by module
+   */
+  inline const std::vector<std::string> &GetFiles() const { return m_Files; }
+
+ private:
+  /**
+   * @brief Record read ahead by a worker
+   * @struct ScanEntry
+   */
+  struct ScanEntry {
+    /**
+     * @brief The record
+     */
+    LogQueryItem m_Item{};
+
+    /**
+     * @brief Offset from which the record is read again
+     */
+    std::uint64_t m_Offset{0};
+  };
+
+  /**
+   * @brief Reading state of a file
+   * @struct FileScan
+   */
+  struct FileScan {
+    /**
+     * @brief Offset from which the file is read, from the cursor
+     */
+    std::uint64_t m_StartOffset{0};
+
+    /**
+     * @brief Reader, opened by the first worker reading the file
+     */
+    std::unique_ptr<BinaryLogRangeReader> m_Reader{};
+
+    /**
+     * @brief Batch read by a worker and not taken by the merge yet
+     */
+    std::vector<ScanEntry> m_Ready{};
+
+    /**
+     * @brief Batch being merged
+     */
+    std::vector<ScanEntry> m_Current{};
+
+    /**
+     * @brief Position of the next record of the batch being merged
+     */
+    std::size_t m_Position{0};
+
+    /**
+     * @brief A worker has been asked for the next batch
+     */
+    bool m_Requested{false};
+
+    /**
+     * @brief Every record of the file has been read by the workers
+     */
+    bool m_Exhausted{false};
+
+    /**
+     * @brief Offset following the last entry of the file, once exhausted
+     */
+    std::uint64_t m_EndOffset{0};
+  };
+
+  /**
+   * @brief Start the workers and wait for the first record of every file
+   *
+   */
+  void Start();
+
+  /**
+   * @brief Worker loop, reads a batch of the files requested
+   *
+   */
+  void Work();
+
+  /**
+   * @brief Ask the workers for the next batch of a file, the mutex must be
+   * held
+   *
+   * @param pFile Index of the file
+   */
+  void Request(std::size_t pFile);
+
+  /**
+   * @brief Make the next record of a file available, waiting for the workers
+   * if needed, and put it in the merge
+   *
+   * @param pFile Index of the file
+   */
+  void Advance(std::size_t pFile);
+
+  /**
+   * @brief Stop and join the workers
+   *
+   */
+  void Stop();
+
+  /**
+   * @brief Build the cursor from the next record of every file
+   *
+   */
+  void BuildCursor();
+
+  /**
+   * @brief Parameters of the query
+   * @private
+   * @memberof LogQuery
+   */
+  const LogQueryOptions m_Options;
+
+  /**
+   * @brief Files selected, by day then by module
+   * @private
+   * @memberof LogQuery
+   */
+  std::vector<std::string> m_Files{};
+
+  /**
+   * @brief Reading state of every file
+   * @private
+   * @memberof LogQuery
+   */
+  std::vector<FileScan> m_Scans{};
+
+  /**
+   * @brief Protects the batches and the requests
+   * @private
+   * @memberof LogQuery
+   */
+  std::mutex m_Mutex{};
+
+  /**
+   * @brief Signaled when a file is requested or the workers are stopped
+   * @private
+   * @memberof LogQuery
+   */
+  std::condition_variable m_WorkAvailable{};
+
+  /**
+   * @brief Signaled when a batch has been read
+   * @private
+   * @memberof LogQuery
+   */
+  std::condition_variable m_BatchReady{};
+
+  /**
+   * @brief Files requested and not taken by a worker yet
+   * @private
+   * @memberof LogQuery
+   */
+  std::deque<std::size_t> m_Requests{};
+
+  /**
+   * @brief Workers reading the files
+   * @private
+   * @memberof LogQuery
+   */
+  std::vector<std::thread> m_Workers{};
+
+  /**
+   * @brief Workers must return
+   * @private
+   * @memberof LogQuery
+   */
+  bool m_Stop{false};
+
+  /**
+   * @brief Workers have been started
+   * @private
+   * @memberof LogQuery
+   */
+  bool m_Started{false};
+
+  /**
+   * @brief Time and file of the next record of every file not exhausted,
+   * oldest first then by file order
+   * @private
+   * @memberof LogQuery
+   */
+  std::priority_queue<std::pair<std::int64_t, std::size_t>,
+                      std::vector<std::pair<std::int64_t, std::size_t>>,
+                      std::greater<>>
+      m_Heads{};
+
+  /**
+   * @brief Number of records returned
+   * @private
+   * @memberof LogQuery
+   */
+  std::size_t m_Returned{0};
+
+  /**
+   * @brief Cursor resuming the query, set once the limit is reached
+   * @private
+   * @memberof LogQuery
+   */
+  std::string m_Cursor{};
+};
+
+/**
+ * @brief Write the records of a query as a JSON array of LogItem, without
+ * holding more than a chunk in memory
+ *
+ * @param pQuery The query
+ * @param pWriteChunk Called with every chunk, e.g. sent as a chunk of a
+ * chunked HTTP response
+ * @param pChunkSize Size from which a chunk is handed out
+ * @return Number of records written
+ */
+std::size_t WriteLogItemsJson(
+    LogQuery &pQuery, const std::function<void(std::string_view)> &pWriteChunk,
+    std::size_t pChunkSize = c_DefaultQueryChunkSize);
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGQUERY_H_
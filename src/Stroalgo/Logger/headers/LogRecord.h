@@ -0,0 +1,170 @@
+/**
+ * @file        LogRecord.h
+ * @author      ALLOGHO
+ * @brief       A log record travelling from the caller to the log backend
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGRECORD_H_
+#define STROALGO_LOGGER_HEADERS_LOGRECORD_H_
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/logger.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "DeferredArgs.h"
+
+namespace Stroalgo::Log {
+
+struct ModuleCounters;
+
+/**
+ * @brief Size of the payload stored inline in a record, longer payloads are
+ * moved to the heap
+ */
+constexpr std::size_t c_InlinePayloadSize{256};
+
+/**
+ * @brief A log message captured on the caller thread
+ * @struct LogRecord
+ */
+struct LogRecord {
+  /**
+   * @brief Fill the payload by formatting the arguments
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void Format(const spdlog::format_string_t<Args...> &pFormat,
+                     Args &&...pArgs) {
+    const fmt::string_view lFormat{pFormat};
+    const auto lArgs{fmt::make_format_args(pArgs...)};
+    const auto lResult{fmt::vformat_to_n(
+        m_InlinePayload.data(), m_InlinePayload.size(), lFormat, lArgs)};
+    m_Format = std::string_view{};
+    if (lResult.size <= m_InlinePayload.size()) {
+      m_Size = lResult.size;
+      m_HeapPayload.clear();
+    } else {
+      m_HeapPayload = fmt::vformat(lFormat, lArgs);
+      m_Size = m_HeapPayload.size();
+    }
+  }
+
+  /**
+   * @brief Fill the payload with the raw arguments, formatting is done when
+   * the record is written
+   * @details The record keeps the interned copy of the format string, which
+   * may be built at runtime (fmt::runtime) and freed before the record is
+   * written.
+   *
+   * @tparam Args Type, every type must satisfy IsDeferrableArg
+   * @param pFormat Message format
+   * @param pArgs Extra args to capture
+   * @return false if the arguments do not fit inline or the format can not
+   * be interned, the record is unchanged
+   */
+  template <typename... Args>
+  inline bool Capture(const spdlog::format_string_t<Args...> &pFormat,
+                      const Args &...pArgs) {
+    DeferredArgWriter lWriter{m_InlinePayload.data(), m_InlinePayload.size()};
+    const fmt::string_view lFormat{pFormat};
+    const std::string_view lInterned{
+        (lWriter.Write(pArgs) && ...)
+            ? InternFormat(std::string_view{lFormat.data(), lFormat.size()})
+            : std::string_view{}};
+    const bool lRet{lInterned.data() != nullptr};
+    if (lRet) {
+      m_Format = lInterned;
+      m_Size = lWriter.Size();
+      m_HeapPayload.clear();
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Check if the payload holds captured arguments instead of text
+   *
+   * @return true if the record still has to be formatted
+   */
+  inline bool IsDeferred() const { return m_Format.data() != nullptr; }
+
+  /**
+   * @brief Get the formatted payload, or the captured arguments of a deferred
+   * record
+   *
+   * @return A view on the payload
+   */
+  inline std::string_view Payload() const {
+    return m_HeapPayload.empty()
+               ? std::string_view(m_InlinePayload.data(), m_Size)
+               : std::string_view(m_HeapPayload);
+  }
+
+  /**
+   * @brief Logger owning the sinks the record is written to
+   */
+  spdlog::logger *m_Logger{nullptr};
+
+  /**
+   * @brief Counters of the module which produced the record, charged if the
+   * record is evicted from the queue
+   */
+  ModuleCounters *m_Counters{nullptr};
+
+  /**
+   * @brief Level of the record
+   */
+  spdlog::level::level_enum m_Level{spdlog::level::off};
+
+  /**
+   * @brief Time at which the record has been produced
+   */
+  spdlog::log_clock::time_point m_Time{};
+
+  /**
+   * @brief Id of the thread which produced the record
+   */
+  std::size_t m_ThreadId{0};
+
+  /**
+   * @brief Interned format string of a deferred record (InternFormat), null
+   * once formatted
+   */
+  std::string_view m_Format{};
+
+  /**
+   * @brief The payload is formatted text followed by structured fields
+   */
+  bool m_Structured{false};
+
+  /**
+   * @brief Size of the inline payload
+   */
+  std::size_t m_Size{0};
+
+  /**
+   * @brief Payload storage used when the message fits inline
+   */
+  std::array<char, c_InlinePayloadSize> m_InlinePayload{};
+
+  /**
+   * @brief Payload storage used when the message is too long to fit inline
+   */
+  std::string m_HeapPayload{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGRECORD_H_
@@ -0,0 +1,378 @@
+/**
+ * @file        LogRetention.h
+ * @author      ALLOGHO
+ * @brief       Background enforcement of the disk quotas of the log files
+ * @details     A thread periodically lists the daily files of every module
+ *              and frees space, oldest day first, until the age limit, the
+ *              quota of each module, the quota of all the modules and the
+ *              free disk space watermark are met. Files over a quota are
+ *              compressed first, then removed. Each file compressed or
+ *              removed is paced by the I/O rate so a burst of deletions
+ *              does not compete with the sinks for the disk. The files of
+ *              the current day, or written recently, are counted but never
+ *              touched.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGRETENTION_H_
+#define STROALGO_LOGGER_HEADERS_LOGRETENTION_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LogArchive.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Retention of the files of a module
+ * @struct ModuleRetention
+ */
+struct ModuleRetention {
+  /**
+   * @brief Bytes of files kept for the module, 0 disables the quota
+   */
+  std::uint64_t m_MaxBytes{0};
+
+  /**
+   * @brief Daily files kept for the module, 0 keeps them
+   */
+  std::uint16_t m_MaxDays{31};
+};
+
+/**
+ * @brief Quotas enforced by the retention thread
+ * @struct RetentionOptions
+ */
+struct RetentionOptions {
+  /**
+   * @brief Time between two retention rounds
+   */
+  std::chrono::milliseconds m_Interval{std::chrono::minutes{1}};
+
+  /**
+   * @brief Time without write before a file of a previous day is touched,
+   * data still buffered by a sink after midnight must not be lost
+   */
+  std::chrono::milliseconds m_MinAge{std::chrono::hours{1}};
+
+  /**
+   * @brief Daily files kept for the modules without their own retention, 0
+   * keeps them
+   */
+  std::uint16_t m_MaxDays{31};
+
+  /**
+   * @brief Bytes of files kept for all the modules, 0 disables the quota
+   */
+  std::uint64_t m_MaxBytes{0};
+
+  /**
+   * @brief Retention of the modules, by name of their directory
+   */
+  std::map<std::string, ModuleRetention> m_Modules{};
+
+  /**
+   * @brief Oldest files are removed while the disk has less free space, 0
+   * disables the watermark
+   */
+  std::uint64_t m_MinFreeBytes{0};
+
+  /**
+   * @brief Free space restored once below m_MinFreeBytes, avoids removing a
+   * file at every round, 0 restores m_MinFreeBytes
+   */
+  std::uint64_t m_TargetFreeBytes{0};
+
+  /**
+   * @brief Files over a quota are compressed before the oldest are removed
+   */
+  bool m_Compress{true};
+
+  /**
+   * @brief Bytes of the original files compressed or removed per second, 0
+   * does not pace the rounds
+   */
+  std::uint64_t m_IoRate{0};
+
+  /**
+   * @brief Bytes of the log files per compressed block
+   */
+  std::size_t m_BlockSize{c_DefaultArchiveBlockSize};
+};
+
+/**
+ * @brief Work done by the retention thread since it started
+ * @struct RetentionCounters
+ */
+struct RetentionCounters {
+  /**
+   * @brief Files replaced by their archive
+   */
+  std::uint64_t m_Compressed{0};
+
+  /**
+   * @brief Files and archives removed
+   */
+  std::uint64_t m_Removed{0};
+
+  /**
+   * @brief Disk space given back, in bytes
+   */
+  std::uint64_t m_FreedBytes{0};
+
+  /**
+   * @brief Rounds run
+   */
+  std::uint64_t m_Rounds{0};
+};
+
+/**
+ * @class LogRetention
+ * @brief Thread keeping the log files within their quotas
+ *
+ */
+class LogRetention {
+ public:
+  /**
+   * @brief Construct a new Log Retention object and start its thread
+   *
+   * @param pDirectory Directory holding a sub directory per module
+   * @param pOptions Quotas to enforce
+   */
+  LogRetention(std::string pDirectory, const RetentionOptions &pOptions);
+
+  /**
+   * @brief Destroy the Log Retention object, the file being compressed is
+   * finished
+   *
+   */
+  ~LogRetention();
+
+  LogRetention(const LogRetention &) = delete;
+  LogRetention &operator=(const LogRetention &) = delete;
+
+  /**
+   * @brief Change the quotas, applied from the next round
+   *
+   * @param pOptions New quotas
+   */
+  void SetOptions(const RetentionOptions &pOptions);
+
+  /**
+   * @brief Get the quotas
+   *
+   * @return The quotas of the next round
+   */
+  RetentionOptions GetOptions() const;
+
+  /**
+   * @brief Get the work done since the thread started
+   *
+   * @return The counters
+   */
+  RetentionCounters GetCounters() const;
+
+  /**
+   * @brief Start a retention round without waiting for the interval
+   *
+   */
+  void Wake();
+
+  /**
+   * @brief Stop the thread, a paced round is interrupted
+   *
+   */
+  void Stop();
+
+  /**
+   * @brief Run a retention round on the calling thread
+   *
+   * @return Number of files compressed or removed
+   */
+  std::size_t EnforcePending();
+
+ private:
+  /**
+   * @brief Daily file, or archive of one, of a previous day or of today
+   * @struct Segment
+   */
+  struct Segment {
+    /**
+     * @brief Path of the file or archive
+     */
+    std::string m_Path{};
+
+    /**
+     * @brief Name of the module directory
+     */
+    std::string m_Module{};
+
+    /**
+     * @brief Day of the file "yyyy-mm-dd"
+     */
+    std::string m_Date{};
+
+    /**
+     * @brief Bytes of the file with its index and tombstones
+     */
+    std::uint64_t m_Size{0};
+
+    /**
+     * @brief The file has been replaced by its archive
+     */
+    bool m_Archived{false};
+
+    /**
+     * @brief The file may still be written by its sink
+     */
+    bool m_Active{false};
+
+    /**
+     * @brief The file has been removed during the round
+     */
+    bool m_Removed{false};
+  };
+
+  /**
+   * @brief List the daily files and archives, oldest day first
+   *
+   * @param pMinAge Time without write before a file is not active anymore
+   * @return The files
+   */
+  std::vector<Segment> ListSegments(std::chrono::milliseconds pMinAge) const;
+
+  /**
+   * @brief Bring files under a quota, compressing then removing the oldest
+   *
+   * @param pSegments Every file of the round
+   * @param pModule Module concerned, empty for all the modules
+   * @param pMaxBytes Bytes kept
+   * @param pCompress Compress the files before removing any
+   * @param pIoRate Pacing of the work, in bytes per second
+   * @param pBlockSize Bytes of the log files per compressed block
+   * @return Number of files compressed or removed
+   */
+  std::size_t EnforceQuota(std::vector<Segment> &pSegments,
+                           const std::string &pModule,
+                           std::uint64_t pMaxBytes, bool pCompress,
+                           std::uint64_t pIoRate, std::size_t pBlockSize);
+
+  /**
+   * @brief Remove a file and account the space given back
+   *
+   * @param pSegment The file, marked as removed
+   * @param pIoRate Pacing of the work, in bytes per second
+   */
+  void Remove(Segment &pSegment, std::uint64_t pIoRate);
+
+  /**
+   * @brief Replace a file by its archive and account the space given back
+   *
+   * @param pSegment The file, updated to its archive
+   * @param pIoRate Pacing of the work, in bytes per second
+   * @param pBlockSize Bytes of the log files per compressed block
+   * @return false if the archive could not be written
+   */
+  bool Compress(Segment &pSegment, std::uint64_t pIoRate,
+                std::size_t pBlockSize);
+
+  /**
+   * @brief Wait for the time the I/O rate gives to a piece of work
+   *
+   * @param pBytes Bytes read or removed by the work
+   * @param pIoRate Bytes per second, 0 does not wait
+   * @return false if the thread is stopping
+   */
+  bool Pace(std::uint64_t pBytes, std::uint64_t pIoRate);
+
+  /**
+   * @brief Check if the thread is stopping
+   *
+   * @return true once Stop has been called
+   */
+  bool IsStopping();
+
+  /**
+   * @brief Thread loop
+   *
+   */
+  void Run();
+
+  /**
+   * @brief Directory holding a sub directory per module
+   * @private
+   * @memberof LogRetention
+   */
+  const std::string m_Directory;
+
+  /**
+   * @brief Quotas of the next round, protected by m_Mutex
+   * @private
+   * @memberof LogRetention
+   */
+  RetentionOptions m_Options;
+
+  /**
+   * @brief Work done, protected by m_Mutex
+   * @private
+   * @memberof LogRetention
+   */
+  RetentionCounters m_Counters{};
+
+  /**
+   * @brief Serializes the rounds of the thread and of EnforcePending
+   * @private
+   * @memberof LogRetention
+   */
+  std::mutex m_RoundMutex{};
+
+  /**
+   * @brief Protects the options, the counters and the flags
+   * @private
+   * @memberof LogRetention
+   */
+  mutable std::mutex m_Mutex{};
+
+  /**
+   * @brief Signaled by Wake and Stop
+   * @private
+   * @memberof LogRetention
+   */
+  std::condition_variable m_Condition{};
+
+  /**
+   * @brief A round has been requested
+   * @private
+   * @memberof LogRetention
+   */
+  bool m_Woken{false};
+
+  /**
+   * @brief The thread must return
+   * @private
+   * @memberof LogRetention
+   */
+  bool m_Stop{false};
+
+  /**
+   * @brief Retention thread
+   * @private
+   * @memberof LogRetention
+   */
+  std::thread m_Thread{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGRETENTION_H_
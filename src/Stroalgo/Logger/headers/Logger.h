@@ -1,307 +1,796 @@
-// /**
-//  * @file        Logger.h
-//  * @author      ALLOGHO
-//  * @brief       A logger class to write every event action
-//  * @details     Uses spdlog library to speed up logging
-//  * @version     1.0
-//  * @date        2025-02-19
-//  * @copyright   Copyright (c) 2025 stroalgo.corp
-//  *
-//  */
-
-// #ifndef LOGGER_HPP
-// #define LOGGER_HPP
-
-// #include "Constants.h"
-// #include "Exceptions.h"
-// #include "GenericSingleton.h"
-
-// #include <map>
-// #include <memory>
-// #include <spdlog/common.h>
-// #include <spdlog/spdlog.h>
-// #include <string>
-// namespace Utilities::Log {
-
-// /**
-//  * @brief Class to Monitor activities by logging
-//  *
-//  */
-// class Logger : public Utilities::Common::GenericSingleton<Logger> {
-// public:
-//   /**
-//    * @brief
-//    *
-//    */
-//   // TODO : if not necessary remove it
-//   enum class LogLevel { Trace = 0, Debug, Info, Warn, Error, Fatal };
-
-//   /**
-//    * @brief Destroy the Logger object
-//    *
-//    */
-//   virtual ~Logger() = default;
-
-//   /**
-//    * @brief Shutdown the logger
-//    *
-//    */
-//   void ShutDown();
-
-//   /**
-//    * @brief Register a logger for a moduleor library
-//    *
-//    * @param pModuleName Name of the module or library to register
-//    */
-//   // TODO : Use setting module to load logs folder path and logger default
-//   level void RegisterModule(const std::string &pModuleName);
-
-//   /**
-//    * @brief Set the Module Log Level
-//    *
-//    * @param pModuleName Name of the module or library
-//    * @param pLogLevel Log level for the module or library
-//    */
-//   void SetModuleLogLevel(const std::string &pModuleName,
-//                          const spdlog::level::level_enum pLogLevel);
-
-//   /**
-//    * @brief Get the Module Log Level
-//    *
-//    * @param pModuleName Name of the module
-//    * @return The level of module logger
-//    */
-//   const std::string GetModuleLevel(const std::string &pModuleName);
-
-//   /**
-//    * @brief Retrieve levels for all registered modules
-//    *
-//    * @return A map  containing module as key and level as value
-//    */
-//   const std::map<std::string, std::string> GetLogLevels();
-
-//   /**
-//    * @brief Delete all logs for all registered module
-//    *
-//    */
-//   void DeleteAllLogs();
-
-//   /**
-//    * @brief Delete all logs for the given module
-//    * @param pModuleName Name of the module or library
-//    *
-//    */
-//   void DeleteAllModuleLogs(const std::string &pModuleName);
-
-//   /**
-//    * @brief Get Current date as string in a "yyyy-mm-dd" format
-//    *
-//    * @return std::string Date as string
-//    */
-//   // TODO :  will moved in common modules if needed in many place
-//   std::string CurrentDateToString();
-
-//   /**
-//    * @brief Write a trace message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Trace(const std::string &pModuleName,
-//                     const spdlog::format_string_t<Args...> pFormat,
-//                     Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::trace, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   /**
-//    * @brief Write a Debug message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Debug(const std::string &pModuleName,
-//                     const spdlog::format_string_t<Args...> pFormat,
-//                     Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::debug, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   /**
-//    * @brief Write a Info message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Info(const std::string &pModuleName,
-//                    const spdlog::format_string_t<Args...> pFormat,
-//                    Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::info, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   /**
-//    * @brief Write a Warning message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Warning(const std::string &pModuleName,
-//                       const spdlog::format_string_t<Args...> pFormat,
-//                       Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::warn, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   /**
-//    * @brief Write a Error message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Error(const std::string &pModuleName,
-//                     const spdlog::format_string_t<Args...> pFormat,
-//                     Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::err, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   /**
-//    * @brief Write a critical message
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module name concerned
-//    * @param pFormat Message format
-//    * @param pArgs Messages
-//    */
-//   template <typename... Args>
-//   inline void Critical(const std::string &pModuleName,
-//                        const spdlog::format_string_t<Args...> pFormat,
-//                        Args &&...pArgs) {
-
-//     WriteLog(spdlog::level::critical, pModuleName, pFormat,
-//              std::forward<Args>(pArgs)...);
-//   }
-
-//   friend class Utilities::Common::GenericSingleton<Logger>;
-
-// private:
-//   /**
-//    * @brief Construct a new Logger object
-//    *
-//    */
-//   Logger();
-
-//   /**
-//    * @brief Write log in console, in file .txt and .json
-//    *
-//    * @tparam Args Type
-//    * @param pLogLevel the log level
-//    * @param pModuleName The module name concerned by the log
-//    * @param pFormat Message format to use
-//    * @param pArgs Extra args to incorporate
-//    */
-//   template <typename... Args>
-//   inline void WriteLog(const spdlog::level::level_enum &pLogLevel,
-//                        const std::string &pModuleName,
-//                        const spdlog::format_string_t<Args...> &pFormat,
-//                        Args &&...pArgs) {
-
-//     // Find the logger related to module
-//     auto lLogger = m_Loggers->find(pModuleName);
-
-//     // Write log if Module is registered
-//     if (lLogger != m_Loggers->end()) {
-//       if (lLogger->second != nullptr) {
-//         lLogger->second->log(pLogLevel, pFormat,
-//         std::forward<Args>(pArgs)...);
-//       } else {
-//         HandleWriteFailure("Unable to write Log : Logger for Module {} is
-//         null",
-//                            pModuleName);
-//       }
-//     } else {
-
-//       HandleWriteFailure("Unable to write Log : Module {} not registered",
-//                          pModuleName);
-//     }
-//   }
-
-//   /**
-//    * @brief Write any failure using the module LOGGER registered at
-//    construction
-//    *
-//    * @tparam Args Type
-//    * @param pModuleName Module Concerned by the failure
-//    * @param pFormat Message format to use when writing
-//    */
-//   template <typename... Args>
-//   void HandleWriteFailure(const spdlog::format_string_t<Args...> &pFormat,
-//                           const std::string &pModuleName) {
-//     auto lLogger =
-//         m_Loggers->find(std::string(Utilities::Constants::c_LoggerModuleName));
-
-//     if (lLogger != m_Loggers->end()) {
-//       if (lLogger->second != nullptr) {
-//         lLogger->second->error(pFormat, pModuleName);
-//       } else {
-//         spdlog::critical(
-//             "The logger for {} module is null : Logs are not saved into
-//             files", Utilities::Constants::c_LoggerModuleName);
-//       }
-//     } else {
-//       spdlog::critical(
-//           "The {} module is not registered : Logs are not saved into files",
-//           Utilities::Constants::c_LoggerModuleName);
-//     }
-//   }
-
-//   /**
-//    * @brief Convert spdlog level into string
-//    *
-//    * @param pLogLevel The log level
-//    * @return Log level as string
-//    */
-//   const std::string LogLevelTostring(const spdlog::level::level_enum
-//   pLogLevel);
-
-//   /**
-//    * @brief Registered loggers container
-//    * @private
-//    * @memberof Logger
-//    */
-//   std::unique_ptr<std::map<std::string, std::shared_ptr<spdlog::logger>>>
-//       m_Loggers = std::make_unique<
-//           std::map<std::string, std::shared_ptr<spdlog::logger>>>();
-
-//   /**
-//    * @brief Empty the current logfile and delete previous logfiles for the
-//    * module
-//    *
-//    * @param pModuleName Module concerned by the deletion
-//    */
-//   void DeleteLogs(const std::string &pModuleName);
-// };
-
-// } // namespace Utilities::Log
-// #endif
+/**
+ * @file        Logger.h
+ * @author      ALLOGHO
+ * @brief       A logger class to write every event action
+ * @details     Uses spdlog library to speed up logging
+ * @version     1.0
+ * @date        2025-02-19
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGGER_H_
+#define STROALGO_LOGGER_HEADERS_LOGGER_H_
+
+#include <spdlog/common.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "AsyncBackend.h"
+#include "BinaryLogTombstones.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include "FieldFormatter.h"
+#include "FlightRecorder.h"
+#include "FlushSink.h"
+#include "GenericSingleton.h"
+#include "LogArchive.h"
+#include "LogClock.h"
+#include "LogCompactor.h"
+#include "LogMacros.h"
+#include "LogRetention.h"
+#include "LoggerStats.h"
+#include "MappedFileSink.h"
+#include "ModuleLevels.h"
+#include "ModuleLogger.h"
+#include "ModuleThrottle.h"
+#include "SharedLogTransport.h"
+
+namespace Stroalgo::Configuration {
+class Settings;
+}  // namespace Stroalgo::Configuration
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief How the text and JSON files of a module are written
+ */
+enum class FileWriter {
+  /**
+   * @brief spdlog daily file sink, buffered stdio
+   */
+  Stdio,
+
+  /**
+   * @brief MappedFileSink, memory mapped preallocated segments
+   */
+  Mapped,
+
+  /**
+   * @brief UringFileSink, io_uring writes, Stdio if io_uring is not supported
+   */
+  IoUring
+};
+
+/**
+ * @brief Files written for a module, each one is a daily file in
+ * "Logs/<Module>/"
+ * @struct LogFileFormats
+ */
+struct LogFileFormats {
+  /**
+   * @brief Records written on the console, a collector writing the records
+   * of other processes disables it
+   */
+  bool m_Console{true};
+
+  /**
+   * @brief Text file "<Module>_YYYY-MM-DD.txt"
+   */
+  bool m_Text{true};
+
+  /**
+   * @brief JSON file "<Module>_YYYY-MM-DD.json"
+   */
+  bool m_Json{true};
+
+  /**
+   * @brief Binary file "<Module>_YYYY-MM-DD.slog", read with stroalgo-logcat
+   */
+  bool m_Binary{false};
+
+  /**
+   * @brief Writer of the text and JSON files, the FileWriter settings of the
+   * module are used when left to Stdio
+   */
+  FileWriter m_Writer{FileWriter::Stdio};
+
+  /**
+   * @brief Size of the memory mapped segments of the Mapped writer
+   */
+  std::size_t m_MappedSegmentSize{c_DefaultSegmentSize};
+
+  /**
+   * @brief Fields written on the console
+   */
+  LogFields m_ConsoleFields{};
+
+  /**
+   * @brief Fields written in the text file
+   */
+  LogFields m_TextFields{};
+
+  /**
+   * @brief Fields written in the JSON file
+   */
+  LogFields m_JsonFields{true, true, true, true, true};
+
+  /**
+   * @brief Ring keeping the records below the module level, dumped to
+   * "<Module>_flight_YYYY-MM-DD.fdump" on errors, the FlightRecorder settings
+   * of the module are used when its size is left to 0
+   */
+  FlightRecorderOptions m_FlightRecorder{};
+};
+
+/**
+ * @brief Class to Monitor activities by logging
+ *
+ */
+class Logger : public Stroalgo::Common::GenericSingleton<Logger> {
+ public:
+  /**
+   * @brief
+   *
+   */
+  // TODO(stroalgo) : if not necessary remove it
+  enum class LogLevel { Trace = 0, Debug, Info, Warn, Error, Fatal };
+
+  /**
+   * @brief Destroy the Logger object, pending asynchronous records are written
+   *
+   */
+  ~Logger() override;
+
+  Logger(const Logger &) = delete;
+  Logger &operator=(const Logger &) = delete;
+
+  /**
+   * @brief Shutdown the logger
+   *
+   */
+  void ShutDown();
+
+  /**
+   * @brief Register a logger for a moduleor library
+   *
+   * @param pModuleName Name of the module or library to register
+   * @param pFileFormats Files written for the module
+   * @return Handle to write the module logs without looking it up, invalid if
+   * the name is rejected
+   */
+  // TODO(stroalgo) : Use setting module to load logs folder path and logger
+  // default level
+  ModuleLogger RegisterModule(
+      const std::string &pModuleName,
+      const LogFileFormats &pFileFormats = LogFileFormats{});
+
+  /**
+   * @brief Get the handle of an already registered module
+   *
+   * @param pModuleName Name of the module or library
+   * @return Handle on the module logger, invalid if the module is not
+   * registered
+   */
+  ModuleLogger GetModuleLogger(std::string_view pModuleName);
+
+  /**
+   * @brief Apply the settings to every registered module, to modules
+   * registered later, and again after every reload of the settings
+   * @note The settings must outlive the Logger, or be detached first
+   *
+   * @param pSettings Loaded settings, usually the SettingsManager instance
+   */
+  void ApplySettings(const Stroalgo::Configuration::Settings &pSettings);
+
+  /**
+   * @brief Stop following the settings, modules keep their current levels
+   * and policies
+   *
+   */
+  void DetachSettings();
+
+  /**
+   * @brief Set when the module records are flushed to disk
+   *
+   * @param pModuleName Name of the module or library
+   * @param pPolicy Flush policy of the module
+   */
+  void SetModuleFlushPolicy(const std::string &pModuleName,
+                            const FlushPolicy &pPolicy);
+
+  /**
+   * @brief Set which module records are dropped during log storms, the
+   * repeats not reported yet are written first
+   *
+   * @param pModuleName Name of the module or library
+   * @param pPolicy Throttle policy of the module
+   */
+  void SetModuleThrottlePolicy(const std::string &pModuleName,
+                               const ThrottlePolicy &pPolicy);
+
+  /**
+   * @brief Get the records dropped by the throttle of a module
+   *
+   * @param pModuleName Name of the module or library
+   * @return The counters, zero if the module is not registered
+   */
+  ThrottleCounters GetModuleThrottleCounters(const std::string &pModuleName);
+
+  /**
+   * @brief Get the health metrics of a module
+   *
+   * @param pModuleName Name of the module or library
+   * @return The metrics, zero if the module is not registered
+   */
+  ModuleStats GetModuleStats(const std::string &pModuleName);
+
+  /**
+   * @brief Get the health metrics of every module and of the asynchronous
+   * queue
+   *
+   * @return The metrics
+   */
+  LoggerStats GetStats();
+
+  /**
+   * @brief Write the records kept by the flight recorder of a module and not
+   * dumped yet to "<Module>_flight_YYYY-MM-DD.fdump"
+   *
+   * @param pModuleName Name of the module or library
+   * @return Number of records dumped, zero if the module has no recorder
+   */
+  std::size_t DumpFlightRecorder(const std::string &pModuleName);
+
+  /**
+   * @brief Set the Module Log Level, effective immediately on every thread
+   *
+   * @param pModuleName Name of the module or library
+   * @param pLogLevel Log level for the module or library
+   */
+  void SetModuleLogLevel(const std::string &pModuleName,
+                         const spdlog::level::level_enum pLogLevel);
+
+  /**
+   * @brief Enable or disable the logs of a module, keeping its level
+   *
+   * @param pModuleName Name of the module or library
+   * @param pEnabled false to drop every record of the module
+   */
+  void SetModuleEnabled(const std::string &pModuleName, bool pEnabled);
+
+  /**
+   * @brief Check if the logs of a module are enabled
+   *
+   * @param pModuleName Name of the module or library
+   * @return true if the module writes its records, false if it is disabled
+   * or not registered
+   */
+  bool IsModuleEnabled(const std::string &pModuleName);
+
+  /**
+   * @brief Check if a level is written by at least one module, used by the
+   * logging macros to skip the arguments of calls filtered everywhere
+   *
+   * @param pLogLevel Level of the log call
+   * @return true if the call may be written
+   */
+  inline bool ShouldLog(const spdlog::level::level_enum pLogLevel) const {
+    return m_Levels.IsAnyAdmitting(pLogLevel);
+  }
+
+  /**
+   * @brief Get the Module Log Level
+   *
+   * @param pModuleName Name of the module
+   * @return The level of module logger
+   */
+  const std::string GetModuleLevel(const std::string &pModuleName);
+
+  /**
+   * @brief Retrieve levels for all registered modules
+   *
+   * @return A map  containing module as key and level as value
+   */
+  const std::map<std::string, std::string> GetLogLevels();
+
+  /**
+   * @brief Delete all logs for all registered module
+   *
+   */
+  void DeleteAllLogs();
+
+  /**
+   * @brief Delete all logs for the given module
+   * @param pModuleName Name of the module or library
+   *
+   */
+  void DeleteAllModuleLogs(const std::string &pModuleName);
+
+  /**
+   * @brief Delete the records of a time range for all registered modules
+   * @details Records of the binary files are hidden at once and their space
+   * is reclaimed by a background compaction. Text and JSON files only support
+   * the deletion of whole days at every level, except the current day.
+   *
+   * @param pStart Oldest time deleted
+   * @param pEnd Newest time deleted
+   * @param pLevels Levels deleted, see GetLevelMask
+   */
+  void DeleteLogsInRange(spdlog::log_clock::time_point pStart,
+                         spdlog::log_clock::time_point pEnd,
+                         std::uint8_t pLevels = c_AllLevelsMask);
+
+  /**
+   * @brief Delete the records of a time range for the given module
+   * @see DeleteLogsInRange
+   *
+   * @param pModuleName Name of the module or library
+   * @param pStart Oldest time deleted
+   * @param pEnd Newest time deleted
+   * @param pLevels Levels deleted, see GetLevelMask
+   */
+  void DeleteModuleLogsInRange(const std::string &pModuleName,
+                               spdlog::log_clock::time_point pStart,
+                               spdlog::log_clock::time_point pEnd,
+                               std::uint8_t pLevels = c_AllLevelsMask);
+
+  /**
+   * @brief Get Current date as string in a "yyyy-mm-dd" format
+   *
+   * @return std::string Date as string
+   */
+  // TODO(stroalgo) :  will moved in common modules if needed in many place
+  std::string CurrentDateToString();
+
+  /**
+   * @brief Switch to asynchronous mode : callers only queue records, a
+   * backend thread writes them into the sinks
+   * @note Must not be called while other threads are logging
+   *
+   * @param pOptions Queue capacity and overflow policy
+   */
+  void EnableAsyncMode(const AsyncOptions &pOptions = AsyncOptions{});
+
+  /**
+   * @brief Write pending records and go back to synchronous mode
+   * @note Must not be called while other threads are logging
+   *
+   */
+  void DisableAsyncMode();
+
+  /**
+   * @brief Start replacing the files of the previous days by block
+   * compressed archives, which the log queries still read
+   *
+   * @param pOptions Archiving interval, block size and retention
+   */
+  void EnableArchiving(const ArchiveOptions &pOptions = ArchiveOptions{});
+
+  /**
+   * @brief Stop archiving, the file being archived is finished
+   *
+   */
+  void DisableArchiving();
+
+  /**
+   * @brief Start enforcing the age, byte quotas and free disk space of the
+   * log files on a background thread, or change the quotas if started
+   * @note Started by ApplySettings when the settings define a quota
+   *
+   * @param pOptions Quotas and pacing of the retention
+   */
+  void EnableRetention(const RetentionOptions &pOptions = RetentionOptions{});
+
+  /**
+   * @brief Stop the retention thread, the file being compressed is finished
+   *
+   */
+  void DisableRetention();
+
+  /**
+   * @brief Get the work done by the retention thread
+   *
+   * @return Files compressed and removed, zero if disabled
+   */
+  RetentionCounters GetRetentionCounters() const;
+
+  /**
+   * @brief Send the records of every module to the collector of the host
+   * through a shared memory ring, the files of the registered modules are
+   * closed and the next modules do not open theirs
+   * @note Must not be called while other threads are logging, the transport
+   * stays enabled until the process exits
+   *
+   * @param pOptions Name shared with the collector and size of the ring
+   */
+  void EnableSharedTransport(
+      const SharedTransportOptions &pOptions = SharedTransportOptions{});
+
+  /**
+   * @brief Check if the records are sent to a collector
+   *
+   * @return true if the shared memory transport is enabled
+   */
+  inline bool IsSharedTransportEnabled() const {
+    return m_SharedSink != nullptr;
+  }
+
+  /**
+   * @brief Write a record read from the ring of another process to the
+   * sinks of its module, used by the collector
+   *
+   * @param pRecord The record, its module must be registered
+   */
+  void WriteForwardedRecord(const SharedLogRecord &pRecord);
+
+  /**
+   * @brief Check if the asynchronous mode is enabled
+   *
+   * @return true if records are written by the backend thread
+   */
+  inline bool IsAsyncModeEnabled() const {
+    return m_ActiveBackend.load(std::memory_order_acquire) != nullptr;
+  }
+
+  /**
+   * @brief Get the records lost by the asynchronous mode
+   *
+   * @return Drop counters of the last enabled asynchronous mode
+   */
+  AsyncCounters GetAsyncCounters() const;
+
+  /**
+   * @brief Wait for pending asynchronous records then flush every sink
+   *
+   */
+  void Flush();
+
+  /**
+   * @brief Write a trace message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Trace(std::string_view pModuleName,
+                    const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) {
+    WriteLog(spdlog::level::trace, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Debug message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Debug(std::string_view pModuleName,
+                    const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) {
+    WriteLog(spdlog::level::debug, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Info message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Info(std::string_view pModuleName,
+                   const spdlog::format_string_t<Args...> pFormat,
+                   Args &&...pArgs) {
+    WriteLog(spdlog::level::info, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Warning message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Warning(std::string_view pModuleName,
+                      const spdlog::format_string_t<Args...> pFormat,
+                      Args &&...pArgs) {
+    WriteLog(spdlog::level::warn, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Error message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Error(std::string_view pModuleName,
+                    const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) {
+    WriteLog(spdlog::level::err, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a critical message
+   *
+   * @tparam Args Type
+   * @param pModuleName Module name concerned
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Critical(std::string_view pModuleName,
+                       const spdlog::format_string_t<Args...> pFormat,
+                       Args &&...pArgs) {
+    WriteLog(spdlog::level::critical, pModuleName, pFormat,
+             std::forward<Args>(pArgs)...);
+  }
+
+  friend class Stroalgo::Common::GenericSingleton<Logger>;
+
+ private:
+  /**
+   * @brief Construct a new Logger object
+   *
+   */
+  Logger();
+
+  /**
+   * @brief Write log in console, in file .txt and .json
+   * @note Slow path looking the module up by name, hot code should keep the
+   * ModuleLogger handle returned by RegisterModule
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pModuleName The module name concerned by the log
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void WriteLog(const spdlog::level::level_enum &pLogLevel,
+                       std::string_view pModuleName,
+                       const spdlog::format_string_t<Args...> &pFormat,
+                       Args &&...pArgs) {
+    // Find the logger related to module
+    auto lModule = m_ModulesByName.find(pModuleName);
+
+    // Write log if Module is registered
+    if (lModule != m_ModulesByName.end()) {
+      lModule->second->Write(pLogLevel, pFormat, std::forward<Args>(pArgs)...);
+    } else {
+      HandleWriteFailure("Unable to write Log : Module {} not registered",
+                         pModuleName);
+    }
+  }
+
+  /**
+   * @brief Write any failure using the module LOGGER registered at
+   * construction
+   *
+   * @param pFormat Message format to use when writing
+   * @param pModuleName Module Concerned by the failure
+   * @param pLogLevel Level of the failure message
+   */
+  void HandleWriteFailure(
+      const spdlog::format_string_t<std::string_view> &pFormat,
+      std::string_view pModuleName,
+      spdlog::level::level_enum pLogLevel = spdlog::level::err);
+
+  /**
+   * @brief Write a failure concerning the whole Logger using the module
+   * LOGGER registered at construction
+   *
+   * @param pMessage Message to write
+   * @param pLogLevel Level of the failure message
+   */
+  void HandleWriteFailure(
+      std::string_view pMessage,
+      spdlog::level::level_enum pLogLevel = spdlog::level::err);
+
+  /**
+   * @brief Convert spdlog level into string
+   *
+   * @param pLogLevel The log level
+   * @return Log level as string
+   */
+  const std::string LogLevelTostring(const spdlog::level::level_enum pLogLevel);
+
+  /**
+   * @brief Start, update or stop the retention thread from the settings
+   *
+   * @param pSettings Settings to apply
+   */
+  void ApplyRetentionSettings(
+      const Stroalgo::Configuration::Settings &pSettings);
+
+  /**
+   * @brief Apply the settings of a module
+   *
+   * @param pContext Context of the module
+   * @param pSettings Settings to apply
+   */
+  void ApplyModuleSettings(ModuleContext &pContext,
+                           const Stroalgo::Configuration::Settings &pSettings);
+
+  /**
+   * @brief Runtime level of every module, by registration id
+   * @private
+   * @memberof Logger
+   */
+  ModuleLevelTable m_Levels{};
+
+  /**
+   * @brief Registered modules, indexed by registration id
+   * @private
+   * @memberof Logger
+   */
+  std::vector<std::unique_ptr<ModuleContext>> m_Modules{};
+
+  /**
+   * @brief Registered modules by name, used by the string keyed API
+   * @private
+   * @memberof Logger
+   */
+  std::map<std::string, ModuleContext *, std::less<>> m_ModulesByName{};
+
+  /**
+   * @brief Backend of the asynchronous mode, kept after being disabled to
+   * report its counters
+   * @private
+   * @memberof Logger
+   */
+  std::unique_ptr<AsyncBackend> m_AsyncBackend{nullptr};
+
+  /**
+   * @brief Backend used by callers, null in synchronous mode
+   * @private
+   * @memberof Logger
+   */
+  std::atomic<AsyncBackend *> m_ActiveBackend{nullptr};
+
+  /**
+   * @brief Settings applied to the modules, null if none
+   * @private
+   * @memberof Logger
+   */
+  const Stroalgo::Configuration::Settings *m_Settings{nullptr};
+
+  /**
+   * @brief Id of the reload listener registered on m_Settings
+   * @private
+   * @memberof Logger
+   */
+  std::size_t m_SettingsListener{0};
+
+  /**
+   * @brief Protect m_Modules against the flush thread
+   * @private
+   * @memberof Logger
+   */
+  std::mutex m_FlushMutex{};
+
+  /**
+   * @brief Wake up the flush thread to stop it
+   * @private
+   * @memberof Logger
+   */
+  std::condition_variable m_FlushCondition{};
+
+  /**
+   * @brief Flag stopping the flush thread
+   * @private
+   * @memberof Logger
+   */
+  bool m_FlushThreadStop{false};
+
+  /**
+   * @brief Thread flushing modules with a flush interval, started by the
+   * first policy using one
+   * @private
+   * @memberof Logger
+   */
+  std::thread m_FlushThread{};
+
+  /**
+   * @brief Archiving of the files of the previous days, null if disabled
+   * @private
+   * @memberof Logger
+   */
+  std::unique_ptr<LogArchiver> m_Archiver{nullptr};
+
+  /**
+   * @brief Enforcement of the quotas of the log files, null if disabled
+   * @private
+   * @memberof Logger
+   */
+  std::unique_ptr<LogRetention> m_Retention{nullptr};
+
+  /**
+   * @brief Compaction of the binary files having deleted records, started by
+   * the first deletion of a time range
+   * @private
+   * @memberof Logger
+   */
+  std::unique_ptr<LogCompactor> m_Compactor{nullptr};
+
+  /**
+   * @brief Ring shared with the collector, null if the modules write their
+   * files
+   * @private
+   * @memberof Logger
+   */
+  std::shared_ptr<SharedLogSink> m_SharedSink{nullptr};
+
+  /**
+   * @brief Flush thread loop
+   *
+   */
+  void RunFlushThread();
+
+  /**
+   * @brief Stop the flush thread if started
+   *
+   */
+  void StopFlushThread();
+
+  /**
+   * @brief Empty the current logfile and delete previous logfiles for the
+   * module
+   *
+   * @param pModule Module concerned by the deletion
+   */
+  void DeleteLogs(const ModuleContext &pModule);
+
+  /**
+   * @brief Read the metrics of a module
+   *
+   * @param pModule Module concerned
+   * @return The metrics
+   */
+  ModuleStats CollectStats(const ModuleContext &pModule) const;
+
+  /**
+   * @brief Delete the records of a time range for the module
+   *
+   * @param pModule Module concerned by the deletion
+   * @param pStart Oldest time deleted
+   * @param pEnd Newest time deleted
+   * @param pLevels Levels deleted, see GetLevelMask
+   */
+  void DeleteLogsInRange(const ModuleContext &pModule,
+                         spdlog::log_clock::time_point pStart,
+                         spdlog::log_clock::time_point pEnd,
+                         std::uint8_t pLevels);
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGGER_H_
@@ -0,0 +1,142 @@
+/**
+ * @file        LoggerStats.h
+ * @author      ALLOGHO
+ * @brief       Health metrics of the logging pipeline
+ * @details     Counters are updated with relaxed atomics while logging and
+ *              read into plain snapshots by Logger::GetStats, so a slow
+ *              service can be checked for logging backpressure (queue
+ *              high-water mark, blocked producers, drops, slow flushes)
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_LOGGERSTATS_H_
+#define STROALGO_LOGGER_HEADERS_LOGGERSTATS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "AsyncBackend.h"
+#include "DurationHistogram.h"
+#include "ModuleThrottle.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Counters updated by the callers of a module
+ * @details Kept on their own cache line, away from the fields read by every
+ * log call
+ * @struct ModuleCounters
+ */
+struct alignas(64) ModuleCounters {
+  /**
+   * @brief Records admitted by the module level and its throttle
+   */
+  std::atomic<std::uint64_t> m_Accepted{0};
+
+  /**
+   * @brief Records dropped or evicted because the asynchronous queue was full
+   */
+  std::atomic<std::uint64_t> m_QueueDropped{0};
+};
+
+/**
+ * @brief Metrics of a module
+ * @struct ModuleStats
+ */
+struct ModuleStats {
+  /**
+   * @brief Records admitted by the module level and its throttle
+   */
+  std::uint64_t m_Accepted{0};
+
+  /**
+   * @brief Records dropped by the throttle or the asynchronous queue
+   */
+  std::uint64_t m_Dropped{0};
+
+  /**
+   * @brief Records dropped by the throttle, by reason
+   */
+  ThrottleCounters m_Throttle{};
+
+  /**
+   * @brief Records dropped or evicted because the asynchronous queue was full
+   */
+  std::uint64_t m_QueueDropped{0};
+
+  /**
+   * @brief Records handed to the sinks
+   */
+  std::uint64_t m_Written{0};
+
+  /**
+   * @brief Flushes of the module files
+   */
+  std::uint64_t m_Flushes{0};
+
+  /**
+   * @brief Durations of the flushes, fdatasync included
+   */
+  HistogramSnapshot m_FlushDurations{};
+
+  /**
+   * @brief Bytes written by each sink, "console", "text", "json" and
+   * "binary" when enabled
+   */
+  std::map<std::string, std::uint64_t> m_BytesWritten{};
+
+  /**
+   * @brief Records kept by the flight recorder, zero without recorder
+   */
+  std::uint64_t m_Recorded{0};
+
+  /**
+   * @brief Dumps of the flight recorder to disk
+   */
+  std::uint64_t m_RecorderDumps{0};
+};
+
+/**
+ * @brief Metrics of the Logger
+ * @struct LoggerStats
+ */
+struct LoggerStats {
+  /**
+   * @brief Metrics of every registered module, by name
+   */
+  std::map<std::string, ModuleStats> m_Modules{};
+
+  /**
+   * @brief The asynchronous mode is enabled
+   */
+  bool m_AsyncEnabled{false};
+
+  /**
+   * @brief Queue metrics of the last enabled asynchronous mode
+   */
+  AsyncCounters m_Async{};
+
+  /**
+   * @brief The records are sent to a collector
+   */
+  bool m_SharedTransportEnabled{false};
+
+  /**
+   * @brief Records written into the shared memory ring
+   */
+  std::uint64_t m_SharedWritten{0};
+
+  /**
+   * @brief Records dropped because the ring was full
+   */
+  std::uint64_t m_SharedDropped{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_LOGGERSTATS_H_
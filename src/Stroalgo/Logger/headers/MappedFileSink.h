@@ -0,0 +1,218 @@
+/**
+ * @file        MappedFileSink.h
+ * @author      ALLOGHO
+ * @brief       spdlog sink writing daily log files through memory mapped
+ *              segments
+ * @details     The file grows by preallocated segments, messages are copied
+ *              into the mapped segment without any system call. Copied
+ *              messages are in the page cache and survive a crash of the
+ *              process. The unused end of the last segment is cut when the
+ *              file is closed, or skipped when a file left by a crash is
+ *              opened again.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_MAPPEDFILESINK_H_
+#define STROALGO_LOGGER_HEADERS_MAPPEDFILESINK_H_
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Default size of a mapped segment
+ */
+constexpr std::size_t c_DefaultSegmentSize{4 * 1024 * 1024};
+
+/**
+ * @class MappedFileSink
+ * @brief Write messages in a new file every day at 00:00, with the naming of
+ * spdlog daily files
+ *
+ */
+class MappedFileSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  /**
+   * @brief Construct a new Mapped File Sink object and open today's file
+   *
+   * @param pBaseFilename Path without date, "Logs/M/M.txt" writes
+   * "Logs/M/M_YYYY-MM-DD.txt"
+   * @param pSegmentSize Size of a segment, rounded up to the page size
+   * @param pMaxFiles Number of daily files kept, 0 keeps all of them
+   */
+  explicit MappedFileSink(const std::string &pBaseFilename,
+                          std::size_t pSegmentSize = c_DefaultSegmentSize,
+                          std::uint16_t pMaxFiles = 0);
+
+  /**
+   * @brief Destroy the Mapped File Sink object, the file is cut to its
+   * written size
+   *
+   */
+  ~MappedFileSink() override;
+
+  MappedFileSink(const MappedFileSink &) = delete;
+  MappedFileSink &operator=(const MappedFileSink &) = delete;
+
+  /**
+   * @brief Empty the current file
+   *
+   */
+  void Truncate();
+
+  /**
+   * @brief Get the path of the file currently written
+   *
+   * @return Path of today's file
+   */
+  std::string GetFilename();
+
+  /**
+   * @brief Get the size of the segments
+   *
+   * @return Segment size in bytes
+   */
+  inline std::size_t GetSegmentSize() const { return m_SegmentSize; }
+
+ protected:
+  /**
+   * @brief Format a message and copy it into the mapped segment
+   *
+   * @param pMsg The message
+   */
+  void sink_it_(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Nothing to do, copied messages are already in the page cache
+   *
+   */
+  void flush_() override {}
+
+ private:
+  /**
+   * @brief Copy bytes at the end of the file, the mutex must be held
+   *
+   * @param pData First byte
+   * @param pSize Number of bytes
+   */
+  void Write(const char *pData, std::size_t pSize);
+
+  /**
+   * @brief Open the file of the message day when needed, the mutex must be
+   * held
+   *
+   * @param pTime Time of the message about to be written
+   */
+  void RotateIfNeeded(spdlog::log_clock::time_point pTime);
+
+  /**
+   * @brief Open a file and map the segment holding its end
+   *
+   * @param pFilename Path of the file
+   */
+  void Open(const std::string &pFilename);
+
+  /**
+   * @brief Unmap the segment, cut the file to its written size and close it
+   *
+   */
+  void Close();
+
+  /**
+   * @brief Preallocate and map a segment of the file
+   *
+   * @param pSegment Index of the segment
+   */
+  void MapSegment(std::size_t pSegment);
+
+  /**
+   * @brief Size written in the current file
+   *
+   * @return Offset of the end of the data
+   */
+  inline std::size_t WrittenSize() const {
+    return m_Segment * m_SegmentSize + m_Offset;
+  }
+
+  /**
+   * @brief Path without date
+   * @private
+   * @memberof MappedFileSink
+   */
+  const std::string m_BaseFilename;
+
+  /**
+   * @brief Size of a segment, multiple of the page size
+   * @private
+   * @memberof MappedFileSink
+   */
+  const std::size_t m_SegmentSize;
+
+  /**
+   * @brief Number of daily files kept
+   * @private
+   * @memberof MappedFileSink
+   */
+  const std::uint16_t m_MaxFiles;
+
+  /**
+   * @brief Time at which the next file is opened
+   * @private
+   * @memberof MappedFileSink
+   */
+  spdlog::log_clock::time_point m_NextRotation{};
+
+  /**
+   * @brief Path of the file currently written
+   * @private
+   * @memberof MappedFileSink
+   */
+  std::string m_Filename{};
+
+  /**
+   * @brief Descriptor of the file currently written, -1 if none
+   * @private
+   * @memberof MappedFileSink
+   */
+  int m_File{-1};
+
+  /**
+   * @brief Mapped segment, null if none
+   * @private
+   * @memberof MappedFileSink
+   */
+  char *m_Mapping{nullptr};
+
+  /**
+   * @brief Index of the mapped segment
+   * @private
+   * @memberof MappedFileSink
+   */
+  std::size_t m_Segment{0};
+
+  /**
+   * @brief Offset of the end of the data in the mapped segment
+   * @private
+   * @memberof MappedFileSink
+   */
+  std::size_t m_Offset{0};
+
+  /**
+   * @brief Buffer reused to format messages
+   * @private
+   * @memberof MappedFileSink
+   */
+  spdlog::memory_buf_t m_Buffer{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_MAPPEDFILESINK_H_
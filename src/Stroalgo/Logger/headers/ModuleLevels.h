@@ -0,0 +1,258 @@
+/**
+ * @file        ModuleLevels.h
+ * @author      ALLOGHO
+ * @brief       Runtime levels of the registered modules
+ * @details     One byte per module, indexed by registration id, holds the
+ *              lowest level written with a flag disabling the module. Writers
+ *              compare the level of a call with a relaxed load of that byte,
+ *              before formatting or evaluating anything, so levels can be
+ *              raised on a live process without slowing filtered calls.
+ *              A module with a flight recorder admits the lower of its level
+ *              and of the recorder level, the records below its level are
+ *              then only kept by the recorder.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_MODULELEVELS_H_
+#define STROALGO_LOGGER_HEADERS_MODULELEVELS_H_
+
+#include <spdlog/common.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Threshold of a module, the lowest level admitted, with
+ * c_ModuleDisabled set while the module is disabled
+ */
+using ModuleThreshold = std::atomic<std::uint8_t>;
+
+/**
+ * @brief Flag of a disabled module, greater than every level so a single
+ * comparison filters the module out
+ */
+constexpr std::uint8_t c_ModuleDisabled{0x80};
+
+/**
+ * @brief Check if a module writes a level
+ *
+ * @param pThreshold Threshold of the module
+ * @param pLogLevel Level of the log call
+ * @return true if the call must be written
+ */
+inline bool IsLevelAdmitted(const ModuleThreshold &pThreshold,
+                            const spdlog::level::level_enum pLogLevel) {
+  return static_cast<std::uint8_t>(pLogLevel) >=
+         pThreshold.load(std::memory_order_relaxed);
+}
+
+/**
+ * @class ModuleLevelTable
+ * @brief Dense table of the module thresholds, every module starts enabled at
+ * trace
+ */
+class ModuleLevelTable {
+ public:
+  /**
+   * @brief Maximum number of registered modules
+   */
+  static constexpr std::size_t c_Capacity{1024};
+
+  /**
+   * @brief Get the threshold of a module
+   *
+   * @param pId Registration id of the module, below c_Capacity
+   * @return The threshold, its address never changes
+   */
+  inline ModuleThreshold &Threshold(std::size_t pId) {
+    return m_Thresholds[pId];
+  }
+
+  /**
+   * @brief Get the lowest level written to the sinks of a module, without
+   * enable flag
+   *
+   * @param pId Registration id of the module, below c_Capacity
+   * @return The level, its address never changes
+   */
+  inline ModuleThreshold &Level(std::size_t pId) { return m_Levels[pId]; }
+
+  /**
+   * @brief Reset the threshold of a newly registered module to trace,
+   * without flight recorder
+   *
+   * @param pId Registration id of the module
+   */
+  void Register(std::size_t pId) {
+    std::lock_guard<std::mutex> lLock(m_ChangeMutex);
+    m_Thresholds[pId].store(0, std::memory_order_relaxed);
+    m_Levels[pId].store(0, std::memory_order_relaxed);
+    m_RecorderLevels[pId] = static_cast<std::uint8_t>(spdlog::level::off);
+    m_Registered = std::max(m_Registered, pId + 1);
+    m_Lowest.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Set the lowest level written by a module, keeping its enable flag
+   *
+   * @param pId Registration id of the module
+   * @param pLogLevel The level, off writes nothing
+   */
+  void SetLevel(std::size_t pId, const spdlog::level::level_enum pLogLevel) {
+    std::lock_guard<std::mutex> lLock(m_ChangeMutex);
+    m_Levels[pId].store(static_cast<std::uint8_t>(pLogLevel),
+                        std::memory_order_relaxed);
+    UpdateThreshold(pId);
+  }
+
+  /**
+   * @brief Get the lowest level written by a module once enabled
+   *
+   * @param pId Registration id of the module
+   * @return The level
+   */
+  inline spdlog::level::level_enum GetLevel(std::size_t pId) const {
+    return static_cast<spdlog::level::level_enum>(
+        m_Levels[pId].load(std::memory_order_relaxed));
+  }
+
+  /**
+   * @brief Set the lowest level kept by the flight recorder of a module
+   *
+   * @param pId Registration id of the module
+   * @param pLogLevel The level, off for a module without recorder
+   */
+  void SetRecorderLevel(std::size_t pId,
+                        const spdlog::level::level_enum pLogLevel) {
+    std::lock_guard<std::mutex> lLock(m_ChangeMutex);
+    m_RecorderLevels[pId] = static_cast<std::uint8_t>(pLogLevel);
+    UpdateThreshold(pId);
+  }
+
+  /**
+   * @brief Enable or disable a module, keeping its level
+   *
+   * @param pId Registration id of the module
+   * @param pEnabled false to write nothing
+   */
+  void SetEnabled(std::size_t pId, bool pEnabled) {
+    std::lock_guard<std::mutex> lLock(m_ChangeMutex);
+    const std::uint8_t lCurrent{
+        m_Thresholds[pId].load(std::memory_order_relaxed)};
+    m_Thresholds[pId].store(
+        pEnabled ? static_cast<std::uint8_t>(lCurrent & ~c_ModuleDisabled)
+                 : static_cast<std::uint8_t>(lCurrent | c_ModuleDisabled),
+        std::memory_order_relaxed);
+    UpdateLowest();
+  }
+
+  /**
+   * @brief Check if a module is enabled
+   *
+   * @param pId Registration id of the module
+   * @return true if the module writes its levels
+   */
+  inline bool IsEnabled(std::size_t pId) const {
+    return (m_Thresholds[pId].load(std::memory_order_relaxed) &
+            c_ModuleDisabled) == 0;
+  }
+
+  /**
+   * @brief Check if at least one module writes a level
+   *
+   * @param pLogLevel Level of the log call
+   * @return true if the call may be written
+   */
+  inline bool IsAnyAdmitting(const spdlog::level::level_enum pLogLevel) const {
+    return IsLevelAdmitted(m_Lowest, pLogLevel);
+  }
+
+ private:
+  /**
+   * @brief Recompute the threshold of a module after a level change, keeping
+   * its enable flag, the caller holds m_ChangeMutex
+   *
+   * @param pId Registration id of the module
+   */
+  void UpdateThreshold(std::size_t pId) {
+    const std::uint8_t lCurrent{
+        m_Thresholds[pId].load(std::memory_order_relaxed)};
+    const std::uint8_t lLevel{std::min(
+        m_Levels[pId].load(std::memory_order_relaxed), m_RecorderLevels[pId])};
+    m_Thresholds[pId].store(
+        static_cast<std::uint8_t>((lCurrent & c_ModuleDisabled) | lLevel),
+        std::memory_order_relaxed);
+    UpdateLowest();
+  }
+
+  /**
+   * @brief Recompute the lowest threshold after a module change, the caller
+   * holds m_ChangeMutex
+   *
+   */
+  void UpdateLowest() {
+    std::uint8_t lLowest{c_ModuleDisabled};
+    for (std::size_t lId = 0; lId < m_Registered; ++lId) {
+      lLowest = std::min(lLowest,
+                         m_Thresholds[lId].load(std::memory_order_relaxed));
+    }
+    m_Lowest.store(lLowest, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Threshold of every module, by registration id
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  std::array<ModuleThreshold, c_Capacity> m_Thresholds{};
+
+  /**
+   * @brief Lowest level written to the sinks of every module, by
+   * registration id
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  std::array<ModuleThreshold, c_Capacity> m_Levels{};
+
+  /**
+   * @brief Lowest level kept by the flight recorder of every module, off
+   * without recorder, protected by m_ChangeMutex
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  std::array<std::uint8_t, c_Capacity> m_RecorderLevels{};
+
+  /**
+   * @brief Lowest threshold of the registered modules
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  ModuleThreshold m_Lowest{0};
+
+  /**
+   * @brief Serialize the changes, writers never take it
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  std::mutex m_ChangeMutex{};
+
+  /**
+   * @brief One past the highest registration id
+   * @private
+   * @memberof ModuleLevelTable
+   */
+  std::size_t m_Registered{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_MODULELEVELS_H_
@@ -0,0 +1,506 @@
+/**
+ * @file        ModuleLogger.h
+ * @author      ALLOGHO
+ * @brief       Pre-resolved handle on a registered module logger
+ * @details     Avoids the module name lookup done on every log call
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_MODULELOGGER_H_
+#define STROALGO_LOGGER_HEADERS_MODULELOGGER_H_
+
+#include <spdlog/common.h>
+#include <spdlog/details/os.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/logger.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "AsyncBackend.h"
+#include "FieldFormatter.h"
+#include "FlightRecorder.h"
+#include "LogClock.h"
+#include "LoggerStats.h"
+#include "ModuleLevels.h"
+#include "ModuleThrottle.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+class BinaryFileSink;
+class FlushSink;
+
+/**
+ * @brief Everything needed to write the logs of a registered module
+ * @details Owned by the Logger, its address never changes once registered
+ * @struct ModuleContext
+ */
+struct ModuleContext {
+  /**
+   * @brief Write a message synchronously or through the asynchronous
+   * backend, unless the module level or the throttle drops it. Arguments all
+   * built by Kv are written as structured fields.
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void Write(const spdlog::level::level_enum pLogLevel,
+                    const spdlog::format_string_t<Args...> &pFormat,
+                    Args &&...pArgs) {
+    // Filtered levels must not consume the rate limit nor be formatted
+    if (!ShouldLog(pLogLevel)) {
+      return;
+    }
+#ifdef STROALGO_LOG_MAPPED_FILES
+    if (m_Recorder != nullptr && !IsLevelAdmitted(*m_Level, pLogLevel)) {
+      Record(pLogLevel, fmt::string_view{pFormat}, pArgs...);
+      return;
+    }
+#endif
+    if constexpr (IsStructuredMessage<Args...>()) {
+      WriteFields(pLogLevel, fmt::string_view{pFormat}, pArgs...);
+    } else {
+      WriteText(pLogLevel, pFormat, std::forward<Args>(pArgs)...);
+    }
+  }
+
+  /**
+   * @brief Check if the module writes a level, one relaxed load
+   *
+   * @param pLogLevel Level of the log call
+   * @return true if the module is enabled and the level is high enough
+   */
+  inline bool ShouldLog(const spdlog::level::level_enum pLogLevel) const {
+    return IsLevelAdmitted(*m_Threshold, pLogLevel);
+  }
+
+  /**
+   * @brief Keep a message below the module level in the flight recorder
+   * only, the throttle protecting the disks does not apply
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void Record(const spdlog::level::level_enum pLogLevel,
+                     fmt::string_view pFormat, const Args &...pArgs) {
+    spdlog::memory_buf_t lPayload{};
+    fmt::vformat_to(std::back_inserter(lPayload), pFormat,
+                    fmt::make_format_args(pArgs...));
+    if constexpr (IsStructuredMessage<Args...>()) {
+      lPayload.push_back(c_FieldsSeparator);
+      AppendJsonMembers(lPayload, pArgs...);
+    }
+    m_Recorder->Record(pLogLevel, LogClockNow(),
+                       spdlog::details::os::thread_id(),
+                       std::string_view{lPayload.data(), lPayload.size()},
+                       IsStructuredMessage<Args...>());
+  }
+
+  /**
+   * @brief Write a message without fields, its level is admitted
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void WriteText(const spdlog::level::level_enum pLogLevel,
+                        const spdlog::format_string_t<Args...> &pFormat,
+                        Args &&...pArgs) {
+    if (m_Throttle.IsEnabled()) {
+      if (!m_Throttle.Admit(pLogLevel)) {
+        return;
+      }
+      if (m_Throttle.IsSuppressingDuplicates()) {
+        spdlog::memory_buf_t lMessage{};
+        fmt::format_to(std::back_inserter(lMessage), pFormat,
+                       std::forward<Args>(pArgs)...);
+        WriteUnique(pLogLevel,
+                    std::string_view{lMessage.data(), lMessage.size()},
+                    false);
+        return;
+      }
+    }
+    WriteAdmitted(pLogLevel, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a message followed by its fields encoded as JSON members,
+   * its level is admitted
+   *
+   * @tparam Fields Types of the field values
+   * @param pLogLevel the log level
+   * @param pFormat Message format, placeholders are filled by key=value
+   * @param pFields Fields of the message
+   */
+  template <typename... Fields>
+  inline void WriteFields(const spdlog::level::level_enum pLogLevel,
+                          fmt::string_view pFormat,
+                          const KeyValue<Fields> &...pFields) {
+    // Fields are only encoded for records being written
+    if (m_Throttle.IsEnabled() && !m_Throttle.Admit(pLogLevel)) {
+      return;
+    }
+    spdlog::memory_buf_t lPayload{};
+    fmt::vformat_to(std::back_inserter(lPayload), pFormat,
+                    fmt::make_format_args(pFields...));
+    lPayload.push_back(c_FieldsSeparator);
+    AppendJsonMembers(lPayload, pFields...);
+    const std::string_view lView{lPayload.data(), lPayload.size()};
+    if (m_Throttle.IsSuppressingDuplicates()) {
+      WriteUnique(pLogLevel, lView, true);
+    } else {
+      WriteStructured(pLogLevel, lView);
+    }
+  }
+
+  /**
+   * @brief Write a formatted message unless it repeats the previous one,
+   * the repeats of the previous one are reported first
+   *
+   * @param pLogLevel the log level
+   * @param pMessage Formatted message
+   * @param pStructured The message is followed by structured fields
+   */
+  inline void WriteUnique(const spdlog::level::level_enum pLogLevel,
+                          std::string_view pMessage, bool pStructured) {
+    std::uint64_t lRepeats{0};
+    spdlog::level::level_enum lRepeatLevel{spdlog::level::off};
+    if (m_Throttle.AdmitMessage(pLogLevel, pMessage, lRepeats,
+                                lRepeatLevel)) {
+      WriteRepeats(lRepeatLevel, lRepeats);
+      if (pStructured) {
+        WriteStructured(pLogLevel, pMessage);
+      } else {
+        WriteAdmitted<std::string_view>(pLogLevel, "{}",
+                                        std::string_view{pMessage});
+      }
+    }
+  }
+
+  /**
+   * @brief Report the repeats of the last message not reported yet
+   *
+   */
+  inline void FlushRepeats() {
+    spdlog::level::level_enum lRepeatLevel{spdlog::level::off};
+    const std::uint64_t lRepeats{m_Throttle.TakeRepeats(lRepeatLevel)};
+    WriteRepeats(lRepeatLevel, lRepeats);
+  }
+
+  /**
+   * @brief Report the repeats of a message
+   *
+   * @param pLogLevel Level of the repeated message
+   * @param pRepeats Times it was repeated, nothing is written for 0 or if
+   * the level is not written anymore
+   */
+  inline void WriteRepeats(const spdlog::level::level_enum pLogLevel,
+                           std::uint64_t pRepeats) {
+    if (pRepeats > 0 && ShouldLog(pLogLevel)) {
+      WriteAdmitted<std::uint64_t>(pLogLevel,
+                                   "Previous message repeated {} times",
+                                   std::uint64_t{pRepeats});
+    }
+  }
+
+  /**
+   * @brief Write a message kept by the throttle
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void WriteAdmitted(const spdlog::level::level_enum pLogLevel,
+                            const spdlog::format_string_t<Args...> &pFormat,
+                            Args &&...pArgs) {
+    m_Counters.m_Accepted.fetch_add(1, std::memory_order_relaxed);
+    AsyncBackend *lBackend{m_ActiveBackend->load(std::memory_order_acquire)};
+    if (lBackend == nullptr && GetLogClockSource() == ClockSource::Precise) {
+      m_Logger->log(pLogLevel, pFormat, std::forward<Args>(pArgs)...);
+    } else if (lBackend == nullptr) {
+      // spdlog only stamps with the precise clock
+      if (m_Logger->should_log(pLogLevel)) {
+        spdlog::memory_buf_t lMessage{};
+        fmt::format_to(std::back_inserter(lMessage), pFormat,
+                       std::forward<Args>(pArgs)...);
+        m_Logger->log(LogClockNow(), spdlog::source_loc{}, pLogLevel,
+                      spdlog::string_view_t{lMessage.data(), lMessage.size()});
+      }
+    } else if (m_Logger->should_log(pLogLevel)) {
+      // Only the formatting is done on the caller thread
+      if (!lBackend->Submit(m_Logger.get(), &m_Counters, pLogLevel, pFormat,
+                            std::forward<Args>(pArgs)...)) {
+        m_Counters.m_QueueDropped.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Write a message followed by its fields, kept by the throttle,
+   * marked as structured out of band
+   *
+   * @param pLogLevel the log level
+   * @param pPayload Formatted message and encoded fields
+   */
+  inline void WriteStructured(const spdlog::level::level_enum pLogLevel,
+                              std::string_view pPayload) {
+    m_Counters.m_Accepted.fetch_add(1, std::memory_order_relaxed);
+    AsyncBackend *lBackend{m_ActiveBackend->load(std::memory_order_acquire)};
+    const spdlog::string_view_t lPayload{pPayload.data(), pPayload.size()};
+    if (lBackend == nullptr && GetLogClockSource() == ClockSource::Precise) {
+      m_Logger->log(StructuredSource(), pLogLevel, lPayload);
+    } else if (lBackend == nullptr) {
+      m_Logger->log(LogClockNow(), StructuredSource(), pLogLevel, lPayload);
+    } else if (m_Logger->should_log(pLogLevel) &&
+               !lBackend->SubmitStructured(m_Logger.get(), &m_Counters,
+                                           pLogLevel, pPayload)) {
+      m_Counters.m_QueueDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Name of the module
+   */
+  std::string m_Name{};
+
+  /**
+   * @brief Registration index of the module
+   */
+  std::size_t m_Id{0};
+
+  /**
+   * @brief Runtime level of the module, in the level table of the Logger
+   */
+  const ModuleThreshold *m_Threshold{nullptr};
+
+  /**
+   * @brief Lowest level written to the sinks, in the level table of the
+   * Logger, below m_Threshold records only go to the flight recorder
+   */
+  const ModuleThreshold *m_Level{nullptr};
+
+  /**
+   * @brief spdlog logger owning the module sinks
+   */
+  std::shared_ptr<spdlog::logger> m_Logger{nullptr};
+
+  /**
+   * @brief Binary file sink of the module, null if not enabled
+   */
+  std::shared_ptr<BinaryFileSink> m_BinarySink{nullptr};
+
+  /**
+   * @brief Sinks of the text, JSON and binary files, replaced by the shared
+   * memory sink when records are sent to a collector
+   */
+  std::vector<spdlog::sink_ptr> m_FileSinks{};
+
+  /**
+   * @brief Flight recorder of the module, null if not enabled
+   */
+  std::shared_ptr<FlightRecorder> m_Recorder{nullptr};
+
+  /**
+   * @brief Flush policy of the module
+   */
+  std::shared_ptr<FlushSink> m_FlushSink{nullptr};
+
+  /**
+   * @brief Records dropped before being written
+   */
+  ModuleThrottle m_Throttle{};
+
+  /**
+   * @brief Backend used in asynchronous mode, owned by the Logger
+   */
+  const std::atomic<AsyncBackend *> *m_ActiveBackend{nullptr};
+
+  /**
+   * @brief Bytes formatted by the console, text and JSON sinks, by sink
+   */
+  std::vector<std::pair<std::string, std::shared_ptr<ByteCounter>>>
+      m_SinkBytes{};
+
+  /**
+   * @brief Records accepted and dropped by the queue
+   */
+  ModuleCounters m_Counters{};
+};
+
+/**
+ * @class ModuleLogger
+ * @brief Cheap copyable handle returned by Logger::RegisterModule
+ * @details Writing through a handle involves no string comparison, no
+ * allocation and no map lookup. Writing through an invalid handle does
+ * nothing, the registration failure has already been reported.
+ *
+ */
+class ModuleLogger {
+ public:
+  /**
+   * @brief Construct an invalid handle
+   *
+   */
+  ModuleLogger() = default;
+
+  /**
+   * @brief Construct a handle on a registered module
+   *
+   * @param pContext Context of the module
+   */
+  explicit ModuleLogger(ModuleContext *pContext) : m_Context(pContext) {}
+
+  /**
+   * @brief Check if the handle refers to a registered module
+   *
+   * @return true if the handle can be used to write logs
+   */
+  inline bool IsValid() const { return m_Context != nullptr; }
+
+  /**
+   * @brief Get the module name
+   *
+   * @return Name of the module, empty for an invalid handle
+   */
+  inline std::string GetModuleName() const {
+    return m_Context != nullptr ? m_Context->m_Name : std::string{};
+  }
+
+  /**
+   * @brief Check if a level is written, before building the message
+   *
+   * @param pLogLevel Level of the log call
+   * @return true if the handle is valid and its module writes the level
+   */
+  inline bool ShouldLog(const spdlog::level::level_enum pLogLevel) const {
+    return m_Context != nullptr && m_Context->ShouldLog(pLogLevel);
+  }
+
+  /**
+   * @brief Write a trace message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Trace(const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) const {
+    Write(spdlog::level::trace, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Debug message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Debug(const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) const {
+    Write(spdlog::level::debug, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Info message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Info(const spdlog::format_string_t<Args...> pFormat,
+                   Args &&...pArgs) const {
+    Write(spdlog::level::info, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Warning message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Warning(const spdlog::format_string_t<Args...> pFormat,
+                      Args &&...pArgs) const {
+    Write(spdlog::level::warn, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a Error message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Error(const spdlog::format_string_t<Args...> pFormat,
+                    Args &&...pArgs) const {
+    Write(spdlog::level::err, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+  /**
+   * @brief Write a critical message
+   *
+   * @tparam Args Type
+   * @param pFormat Message format
+   * @param pArgs Messages
+   */
+  template <typename... Args>
+  inline void Critical(const spdlog::format_string_t<Args...> pFormat,
+                       Args &&...pArgs) const {
+    Write(spdlog::level::critical, pFormat, std::forward<Args>(pArgs)...);
+  }
+
+ private:
+  /**
+   * @brief Write a message if the handle is valid
+   *
+   * @tparam Args Type
+   * @param pLogLevel the log level
+   * @param pFormat Message format to use
+   * @param pArgs Extra args to incorporate
+   */
+  template <typename... Args>
+  inline void Write(const spdlog::level::level_enum pLogLevel,
+                    const spdlog::format_string_t<Args...> &pFormat,
+                    Args &&...pArgs) const {
+    if (m_Context != nullptr) {
+      m_Context->Write(pLogLevel, pFormat, std::forward<Args>(pArgs)...);
+    }
+  }
+
+  /**
+   * @brief Context of the module, null for an invalid handle
+   * @private
+   * @memberof ModuleLogger
+   */
+  ModuleContext *m_Context{nullptr};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_MODULELOGGER_H_
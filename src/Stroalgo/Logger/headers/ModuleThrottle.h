@@ -0,0 +1,255 @@
+/**
+ * @file        ModuleThrottle.h
+ * @author      ALLOGHO
+ * @brief       Rate limit, sampling and duplicate suppression of a module
+ * @details     Checked on the caller thread before a record is formatted or
+ *              queued. A disabled throttle costs a relaxed load. The rate
+ *              limit is a token bucket stored as its theoretical arrival
+ *              time (GCRA), updated by a single compare and swap. Sampling
+ *              draws from a per thread xorshift generator. Only duplicate
+ *              suppression compares formatted messages and takes a lock.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_MODULETHROTTLE_H_
+#define STROALGO_LOGGER_HEADERS_MODULETHROTTLE_H_
+
+#include <spdlog/common.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Records of a module dropped before being written
+ * @details The default policy keeps every record
+ * @struct ThrottlePolicy
+ */
+struct ThrottlePolicy {
+  /**
+   * @brief Records admitted per second, 0 disables the rate limit
+   */
+  double m_RatePerSecond{0};
+
+  /**
+   * @brief Records admitted at once after an idle period, 0 for one second
+   * of records
+   */
+  std::uint32_t m_Burst{0};
+
+  /**
+   * @brief Fraction of the trace and debug records kept, 1 keeps them all
+   */
+  double m_SampleRate{1};
+
+  /**
+   * @brief Collapse identical consecutive records into a "repeated N times"
+   * record
+   */
+  bool m_SuppressDuplicates{false};
+};
+
+/**
+ * @brief Records dropped by a throttle since its creation
+ * @struct ThrottleCounters
+ */
+struct ThrottleCounters {
+  /**
+   * @brief Records over the rate limit
+   */
+  std::uint64_t m_RateLimited{0};
+
+  /**
+   * @brief Trace and debug records not sampled
+   */
+  std::uint64_t m_Sampled{0};
+
+  /**
+   * @brief Records identical to the previous one
+   */
+  std::uint64_t m_Duplicates{0};
+};
+
+/**
+ * @class ModuleThrottle
+ * @brief Applies a ThrottlePolicy to the records of a module
+ * @details Thread safe, the policy can be changed while logging
+ *
+ */
+class ModuleThrottle {
+ public:
+  /**
+   * @brief Change the policy, the rate limit starts with a full burst
+   *
+   * @param pPolicy New policy
+   */
+  void SetPolicy(const ThrottlePolicy &pPolicy);
+
+  /**
+   * @brief Get the current policy
+   *
+   * @return The policy
+   */
+  ThrottlePolicy GetPolicy() const;
+
+  /**
+   * @brief Get the records dropped so far
+   *
+   * @return The counters
+   */
+  ThrottleCounters GetCounters() const;
+
+  /**
+   * @brief Check if the policy drops any record
+   *
+   * @return false if every record is kept
+   */
+  inline bool IsEnabled() const {
+    return m_Enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Check if identical consecutive records are collapsed
+   *
+   * @return true if messages must be formatted and given to AdmitMessage
+   */
+  inline bool IsSuppressingDuplicates() const {
+    return m_SuppressDuplicates.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Apply the sampling then the rate limit to a record
+   *
+   * @param pLogLevel Level of the record
+   * @return true if the record must be written
+   */
+  inline bool Admit(spdlog::level::level_enum pLogLevel) {
+    const std::uint64_t lThreshold{
+        m_SampleThreshold.load(std::memory_order_relaxed)};
+    if (pLogLevel <= spdlog::level::debug &&
+        lThreshold != std::numeric_limits<std::uint64_t>::max() &&
+        NextRandom() > lThreshold) {
+      m_Sampled.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    const std::int64_t lInterval{m_IntervalNs.load(std::memory_order_relaxed)};
+    if (lInterval > 0 && !AdmitRate(lInterval)) {
+      m_RateLimited.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Compare a formatted record to the previous one
+   *
+   * @param pLogLevel Level of the record
+   * @param pMessage Formatted message
+   * @param pRepeats Times the previous record was repeated, to be reported
+   * before writing this one
+   * @param pRepeatLevel Level of the repeated record
+   * @return false if the record is a duplicate and must not be written
+   */
+  bool AdmitMessage(spdlog::level::level_enum pLogLevel,
+                    std::string_view pMessage, std::uint64_t &pRepeats,
+                    spdlog::level::level_enum &pRepeatLevel);
+
+  /**
+   * @brief Take the repeats not reported yet, the next duplicates are still
+   * collapsed
+   *
+   * @param pRepeatLevel Level of the repeated record
+   * @return Times the last record was repeated since the last report
+   */
+  std::uint64_t TakeRepeats(spdlog::level::level_enum &pRepeatLevel);
+
+ private:
+  /**
+   * @brief Consume a token of the bucket
+   *
+   * @param pInterval Time between two records at the rate limit, ns
+   * @return false if the bucket is empty
+   */
+  bool AdmitRate(std::int64_t pInterval);
+
+  /**
+   * @brief Draw from the generator of the calling thread
+   *
+   * @return Uniformly distributed value
+   */
+  static std::uint64_t NextRandom();
+
+  /**
+   * @brief Some record may be dropped
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::atomic<bool> m_Enabled{false};
+
+  /**
+   * @brief Policy fields, stored separately to be updated without lock
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::atomic<std::uint64_t> m_SampleThreshold{
+      std::numeric_limits<std::uint64_t>::max()};
+  std::atomic<std::int64_t> m_IntervalNs{0};
+  std::atomic<std::int64_t> m_ToleranceNs{0};
+  std::atomic<bool> m_SuppressDuplicates{false};
+
+  /**
+   * @brief Steady time at which the bucket is full again, ns
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::atomic<std::int64_t> m_TheoreticalArrival{0};
+
+  /**
+   * @brief Drop counters
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::atomic<std::uint64_t> m_RateLimited{0};
+  std::atomic<std::uint64_t> m_Sampled{0};
+  std::atomic<std::uint64_t> m_Duplicates{0};
+
+  /**
+   * @brief Protects the previous record
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::mutex m_DuplicateMutex{};
+
+  /**
+   * @brief Message of the previous record
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::string m_LastMessage{};
+
+  /**
+   * @brief Level of the previous record, off if none
+   * @private
+   * @memberof ModuleThrottle
+   */
+  spdlog::level::level_enum m_LastLevel{spdlog::level::off};
+
+  /**
+   * @brief Repeats of the previous record not reported yet
+   * @private
+   * @memberof ModuleThrottle
+   */
+  std::uint64_t m_Repeats{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_MODULETHROTTLE_H_
@@ -0,0 +1,269 @@
+/**
+ * @file        MpscRingBuffer.h
+ * @author      ALLOGHO
+ * @brief       A bounded lock-free multi-producer ring buffer
+ * @details     Sequence-numbered slots (Vyukov bounded queue): producers
+ *              claim a slot with a single CAS, the consumer never locks
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_MPSCRINGBUFFER_H_
+#define STROALGO_LOGGER_HEADERS_MPSCRINGBUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Behaviour of a producer when the ring buffer is full
+ *
+ */
+enum class OverflowPolicy {
+  Block,       ///< Spin/yield until the consumer frees a slot
+  DropNewest,  ///< Discard the record being pushed
+  DropOldest   ///< Evict the oldest queued record to make room
+};
+
+/**
+ * @brief Outcome of a push operation
+ *
+ */
+enum class PushResult {
+  Pushed,               ///< Value queued without loss
+  DroppedNewest,        ///< Value discarded because the buffer was full
+  PushedDroppedOldest,  ///< Value queued after evicting the oldest one
+};
+
+/**
+ * @class MpscRingBuffer
+ * @brief Bounded lock-free ring buffer safe for many producers and one
+ * consumer
+ *
+ * @tparam T Type of queued values, must be default constructible and movable
+ */
+template <typename T>
+class MpscRingBuffer {
+ public:
+  /**
+   * @brief Construct a new ring buffer
+   *
+   * @param pCapacity Requested capacity, rounded up to a power of two
+   */
+  explicit MpscRingBuffer(std::size_t pCapacity)
+      : m_Capacity(RoundUpToPowerOfTwo(pCapacity)),
+        m_Mask(m_Capacity - 1),
+        m_Slots(std::make_unique<Slot[]>(m_Capacity)) {
+    for (std::size_t lIndex = 0; lIndex < m_Capacity; ++lIndex) {
+      m_Slots[lIndex].m_Sequence.store(lIndex, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRingBuffer(const MpscRingBuffer &) = delete;
+  MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+  /**
+   * @brief Try to queue a value without waiting
+   *
+   * @param pValue Value to queue, moved from only on success
+   * @return true if the value has been queued, false if the buffer is full
+   */
+  bool TryPush(T &&pValue) {
+    Slot *lSlot{nullptr};
+    std::size_t lPos{m_EnqueuePos.load(std::memory_order_relaxed)};
+    for (;;) {
+      lSlot = &m_Slots[lPos & m_Mask];
+      const std::size_t lSequence{
+          lSlot->m_Sequence.load(std::memory_order_acquire)};
+      const auto lDiff{static_cast<std::ptrdiff_t>(lSequence) -
+                       static_cast<std::ptrdiff_t>(lPos)};
+      if (lDiff == 0) {
+        if (m_EnqueuePos.compare_exchange_weak(lPos, lPos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (lDiff < 0) {
+        return false;
+      } else {
+        lPos = m_EnqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    lSlot->m_Value = std::move(pValue);
+    lSlot->m_Sequence.store(lPos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Try to dequeue the oldest value without waiting
+   * @note Producers may call it too (drop-oldest eviction)
+   *
+   * @param pValue Receives the dequeued value
+   * @return true if a value has been dequeued, false if the buffer is empty
+   */
+  bool TryPop(T &pValue) {
+    Slot *lSlot{nullptr};
+    std::size_t lPos{m_DequeuePos.load(std::memory_order_relaxed)};
+    for (;;) {
+      lSlot = &m_Slots[lPos & m_Mask];
+      const std::size_t lSequence{
+          lSlot->m_Sequence.load(std::memory_order_acquire)};
+      const auto lDiff{static_cast<std::ptrdiff_t>(lSequence) -
+                       static_cast<std::ptrdiff_t>(lPos + 1)};
+      if (lDiff == 0) {
+        if (m_DequeuePos.compare_exchange_weak(lPos, lPos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (lDiff < 0) {
+        return false;
+      } else {
+        lPos = m_DequeuePos.load(std::memory_order_relaxed);
+      }
+    }
+    pValue = std::move(lSlot->m_Value);
+    lSlot->m_Sequence.store(lPos + m_Mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Queue a value applying an overflow policy when the buffer is full
+   *
+   * @param pValue Value to queue
+   * @param pPolicy Policy to apply on overflow
+   * @return What happened to the value
+   */
+  PushResult Push(T &&pValue, OverflowPolicy pPolicy) {
+    return Push(std::move(pValue), pPolicy, [](const T &) {});
+  }
+
+  /**
+   * @brief Queue a value applying an overflow policy when the buffer is full,
+   * each value evicted by the drop-oldest policy is handed to a callback
+   *
+   * @tparam OnEvicted Callable taking a const T &
+   * @param pValue Value to queue
+   * @param pPolicy Policy to apply on overflow
+   * @param pOnEvicted Called once per evicted value
+   * @return What happened to the value
+   */
+  template <typename OnEvicted>
+  PushResult Push(T &&pValue, OverflowPolicy pPolicy, OnEvicted &&pOnEvicted) {
+    PushResult lResult{PushResult::Pushed};
+    while (!TryPush(std::move(pValue))) {
+      switch (pPolicy) {
+        case OverflowPolicy::DropNewest:
+          return PushResult::DroppedNewest;
+        case OverflowPolicy::DropOldest: {
+          T lEvicted{};
+          if (TryPop(lEvicted)) {
+            pOnEvicted(lEvicted);
+            lResult = PushResult::PushedDroppedOldest;
+          }
+          break;
+        }
+        case OverflowPolicy::Block:
+        default:
+          std::this_thread::yield();
+          break;
+      }
+    }
+    return lResult;
+  }
+
+  /**
+   * @brief Get the capacity of the ring buffer
+   *
+   * @return Number of slots
+   */
+  inline std::size_t Capacity() const { return m_Capacity; }
+
+  /**
+   * @brief Get the number of slots claimed by producers since construction
+   *
+   * @return Monotonic enqueue counter
+   */
+  inline std::size_t EnqueuedCount() const {
+    return m_EnqueuePos.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Get an approximation of the number of queued values
+   *
+   * @return Number of values waiting to be dequeued
+   */
+  inline std::size_t SizeApprox() const {
+    const std::size_t lDequeued{m_DequeuePos.load(std::memory_order_relaxed)};
+    const std::size_t lEnqueued{m_EnqueuePos.load(std::memory_order_relaxed)};
+    return lEnqueued > lDequeued ? lEnqueued - lDequeued : 0;
+  }
+
+ private:
+  /**
+   * @brief Size of a cache line, used to avoid false sharing
+   */
+  static constexpr std::size_t c_CacheLineSize{64};
+
+  /**
+   * @brief A slot of the ring, its sequence tells who may use it next
+   * @private
+   * @struct Slot
+   */
+  struct alignas(c_CacheLineSize) Slot {
+    std::atomic<std::size_t> m_Sequence{0};
+    T m_Value{};
+  };
+
+  /**
+   * @brief Round a capacity up to the next power of two (minimum 2)
+   *
+   * @param pValue Requested capacity
+   * @return Rounded capacity
+   */
+  static std::size_t RoundUpToPowerOfTwo(std::size_t pValue) {
+    std::size_t lRet{2};
+    while (lRet < pValue) {
+      lRet <<= 1U;
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Number of slots
+   * @private
+   */
+  const std::size_t m_Capacity;
+
+  /**
+   * @brief Mask used to map a position to a slot index
+   * @private
+   */
+  const std::size_t m_Mask;
+
+  /**
+   * @brief Slots storage
+   * @private
+   */
+  std::unique_ptr<Slot[]> m_Slots;
+
+  /**
+   * @brief Next position claimed by producers
+   * @private
+   */
+  alignas(c_CacheLineSize) std::atomic<std::size_t> m_EnqueuePos{0};
+
+  /**
+   * @brief Next position read by the consumer
+   * @private
+   */
+  alignas(c_CacheLineSize) std::atomic<std::size_t> m_DequeuePos{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_MPSCRINGBUFFER_H_
@@ -0,0 +1,43 @@
+/**
+ * @file        ProcessIdentity.h
+ * @author      ALLOGHO
+ * @brief       Identity of the processes owning shared rings and images
+ * @details     A process id is reused once its process is gone, the start
+ *              time of the process tells a later process with the same id
+ *              apart. Both go in the names of the shared memory segments and
+ *              of the flight recorder images so a process never takes over
+ *              the ones of another live process.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_PROCESSIDENTITY_H_
+#define STROALGO_LOGGER_HEADERS_PROCESSIDENTITY_H_
+
+#include <cstdint>
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Get the start time of a process
+ *
+ * @param pProcessId The process
+ * @return Clock ticks since boot (/proc/<pid>/stat), 0 if unknown
+ */
+std::uint64_t GetProcessStartTime(std::uint32_t pProcessId);
+
+/**
+ * @brief Check if a process has exited
+ *
+ * @param pProcessId Id of the process
+ * @param pStartTime Its start time, 0 if unknown
+ * @return true if no process has the id, or if the process having it
+ * started at another time
+ */
+bool IsProcessGone(std::uint32_t pProcessId, std::uint64_t pStartTime);
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_PROCESSIDENTITY_H_
@@ -0,0 +1,43 @@
+/**
+ * @file        RecordSink.h
+ * @author      ALLOGHO
+ * @brief       Interface of the sinks storing records without formatting them
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_RECORDSINK_H_
+#define STROALGO_LOGGER_HEADERS_RECORDSINK_H_
+
+#include "LogRecord.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @class RecordSink
+ * @brief Implemented by spdlog sinks able to store a LogRecord as is
+ * @details The asynchronous backend hands deferred records to such sinks
+ * directly, their arguments are then formatted only when read back.
+ *
+ */
+class RecordSink {
+ public:
+  /**
+   * @brief Destroy the Record Sink object
+   *
+   */
+  virtual ~RecordSink() = default;
+
+  /**
+   * @brief Store a record, formatted or deferred
+   *
+   * @param pRecord The record to store
+   */
+  virtual void WriteRecord(const LogRecord &pRecord) = 0;
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_RECORDSINK_H_
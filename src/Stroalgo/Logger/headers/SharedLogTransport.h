@@ -0,0 +1,383 @@
+/**
+ * @file        SharedLogTransport.h
+ * @author      ALLOGHO
+ * @brief       Shared memory rings carrying records from the processes to a
+ *              collector
+ * @details     Every producer process owns a POSIX shared memory segment
+ *              "/<name>.<pid>.<start>.<n>" holding a single producer, single
+ *              consumer ring, <start> being the start time of the process
+ *              and <n> the rank of the ring in the process. A process never
+ *              replaces the ring of another one, even one with the same id.
+ *              Its modules hand their records to a SharedLogSink instead of
+ *              opening their files, and a collector process (LogCollector)
+ *              drains every ring into the file sinks. The image holds, in
+ *              host byte order :
+ *
+ *              Header : magic "SLSM", u16 version, u32 process id,
+ *                       u64 process start time, u64 capacity, u64 head,
+ *                       u64 dropped, u64 tail,
+ *                       padded to c_SharedLogHeaderSize bytes
+ *              Data   : capacity bytes of entries, the entry at position p
+ *                       is at offset p % capacity and never wraps
+ *              Entry  : u32 entry size, u16 module name length, name,
+ *                       binary record (BinaryLogFormat.h)
+ *
+ *              head, tail and dropped are counted since the segment was
+ *              created. head is written by the producer once an entry is
+ *              complete and tail by the collector once the entries are
+ *              written, so a producer crash never exposes a partial entry
+ *              and a restarted collector goes on where the last one
+ *              stopped. An entry not fitting before the end of the data
+ *              skips it, a 0 entry size marks the skipped bytes.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_SHAREDLOGTRANSPORT_H_
+#define STROALGO_LOGGER_HEADERS_SHAREDLOGTRANSPORT_H_
+
+#include <spdlog/common.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "ProcessIdentity.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Magic bytes starting every shared memory segment
+ */
+constexpr std::string_view c_SharedLogMagic{"SLSM"};
+
+/**
+ * @brief Version of the shared memory segment layout
+ */
+constexpr std::uint16_t c_SharedLogVersion{2};
+
+/**
+ * @brief Size of the segment header, the data follows
+ */
+constexpr std::size_t c_SharedLogHeaderSize{256};
+
+/**
+ * @brief Smallest ring, smaller sizes are rounded up
+ */
+constexpr std::size_t c_MinSharedLogSize{4096};
+
+/**
+ * @brief Default name of the transport, segments are
+ * "/stroalgo-log.<pid>.<start>.<n>"
+ */
+constexpr std::string_view c_DefaultSharedLogName{"stroalgo-log"};
+
+/**
+ * @brief Shared memory transport of a producer process
+ * @struct SharedTransportOptions
+ */
+struct SharedTransportOptions {
+  /**
+   * @brief Name shared by the producers and their collector
+   */
+  std::string m_Name{c_DefaultSharedLogName};
+
+  /**
+   * @brief Bytes of entries the ring holds while the collector is late,
+   * records not fitting are dropped
+   */
+  std::size_t m_Size{4 * 1024 * 1024};
+};
+
+/**
+ * @brief A record read from a shared memory ring, its views point into the
+ * ring and are valid until the entry is released
+ * @struct SharedLogRecord
+ */
+struct SharedLogRecord {
+  /**
+   * @brief Name of the module
+   */
+  std::string_view m_ModuleName{};
+
+  /**
+   * @brief Time of the record
+   */
+  spdlog::log_clock::time_point m_Time{};
+
+  /**
+   * @brief Level of the record
+   */
+  spdlog::level::level_enum m_Level{spdlog::level::off};
+
+  /**
+   * @brief Thread of the producer which wrote the record
+   */
+  std::uint64_t m_ThreadId{0};
+
+  /**
+   * @brief Formatted message, with its fields
+   */
+  std::string_view m_Payload{};
+
+  /**
+   * @brief The message is followed by structured fields
+   */
+  bool m_Structured{false};
+};
+
+struct SharedLogHeader;
+
+/**
+ * @brief Get the name of a segment of a producer
+ *
+ * @param pName Name of the transport
+ * @param pProcessId Producer process
+ * @param pStartTime Start time of the producer process
+ * @param pRank Rank of the segment among those of the process
+ * @return "/<name>.<pid>.<start>.<n>"
+ */
+std::string GetSharedLogSegmentName(const std::string &pName,
+                                    std::uint32_t pProcessId,
+                                    std::uint64_t pStartTime,
+                                    std::uint32_t pRank);
+
+/**
+ * @class SharedLogSink
+ * @brief spdlog sink writing the records of every module of the process into
+ * its shared memory ring
+ * @details The sink never waits for the collector, records not fitting in
+ * the ring are dropped and counted in the segment.
+ *
+ */
+class SharedLogSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  /**
+   * @brief Construct a new Shared Log Sink object and create a segment of
+   * the process, the segments left by other processes are kept for the
+   * collector
+   * @throw spdlog::spdlog_ex if the segment can not be created
+   *
+   * @param pOptions Name and size of the ring
+   */
+  explicit SharedLogSink(const SharedTransportOptions &pOptions);
+
+  /**
+   * @brief Destroy the Shared Log Sink object, the segment is kept until the
+   * collector has drained it
+   *
+   */
+  ~SharedLogSink() override;
+
+  SharedLogSink(const SharedLogSink &) = delete;
+  SharedLogSink &operator=(const SharedLogSink &) = delete;
+
+  /**
+   * @brief Get the name of the segment
+   *
+   * @return "/<name>.<pid>.<start>.<n>"
+   */
+  inline const std::string &GetSegmentName() const { return m_SegmentName; }
+
+  /**
+   * @brief Get the options of the transport
+   *
+   * @return The options, the size rounded up
+   */
+  inline const SharedTransportOptions &GetOptions() const { return m_Options; }
+
+  /**
+   * @brief Get the number of records written into the ring
+   *
+   * @return Records written since construction
+   */
+  inline std::uint64_t GetWrittenRecords() const {
+    return m_Written.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the number of records dropped because the ring was full
+   *
+   * @return Records dropped since construction
+   */
+  std::uint64_t GetDroppedRecords() const;
+
+ protected:
+  /**
+   * @brief Copy a record into the ring, or drop it if the ring is full
+   *
+   * @param pMsg The message
+   */
+  void sink_it_(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Nothing to flush, the collector writes the files
+   *
+   */
+  void flush_() override {}
+
+ private:
+  /**
+   * @brief Options, the size rounded up
+   * @private
+   * @memberof SharedLogSink
+   */
+  SharedTransportOptions m_Options;
+
+  /**
+   * @brief Name of the segment
+   * @private
+   * @memberof SharedLogSink
+   */
+  std::string m_SegmentName{};
+
+  /**
+   * @brief Header and data of the ring
+   * @private
+   * @memberof SharedLogSink
+   */
+  char *m_Mapping{nullptr};
+
+  /**
+   * @brief Header of the ring, at the start of m_Mapping
+   * @private
+   * @memberof SharedLogSink
+   */
+  SharedLogHeader *m_Header{nullptr};
+
+  /**
+   * @brief Records written into the ring
+   * @private
+   * @memberof SharedLogSink
+   */
+  std::atomic<std::uint64_t> m_Written{0};
+
+  /**
+   * @brief Buffer reused to encode records
+   * @private
+   * @memberof SharedLogSink
+   */
+  spdlog::memory_buf_t m_Buffer{};
+};
+
+/**
+ * @class SharedLogSegment
+ * @brief Collector side of the ring of a producer
+ * @details Used by a single collector thread.
+ *
+ */
+class SharedLogSegment {
+ public:
+  /**
+   * @brief Construct a new Shared Log Segment object, mapping the segment
+   * @throw spdlog::spdlog_ex if the segment does not exist or is not
+   * initialized yet
+   *
+   * @param pSegmentName Name of the segment "/<name>.<pid>.<start>.<n>"
+   */
+  explicit SharedLogSegment(std::string pSegmentName);
+
+  /**
+   * @brief Destroy the Shared Log Segment object, the segment is unmapped
+   * but not removed
+   *
+   */
+  ~SharedLogSegment();
+
+  SharedLogSegment(const SharedLogSegment &) = delete;
+  SharedLogSegment &operator=(const SharedLogSegment &) = delete;
+
+  /**
+   * @brief Hand the pending records to a function then release them to the
+   * producer
+   *
+   * @param pWrite Function writing a record
+   * @param pMaxRecords Records handed at most
+   * @return Number of records handed
+   */
+  std::size_t Drain(const std::function<void(const SharedLogRecord &)> &pWrite,
+                    std::size_t pMaxRecords);
+
+  /**
+   * @brief Get the records dropped by the producer since the last call
+   *
+   * @return Records dropped because the ring was full
+   */
+  std::uint64_t TakeDroppedRecords();
+
+  /**
+   * @brief Check if the producer process has exited, its pending records
+   * are the last ones
+   *
+   * @return true if the process does not exist anymore, or its id is used
+   * by a process started later
+   */
+  bool IsProducerGone() const;
+
+  /**
+   * @brief Remove the segment, the mapping stays valid
+   *
+   */
+  void Remove();
+
+  /**
+   * @brief Get the name of the segment
+   *
+   * @return "/<name>.<pid>.<start>.<n>"
+   */
+  inline const std::string &GetSegmentName() const { return m_SegmentName; }
+
+  /**
+   * @brief Get the producer process
+   *
+   * @return Process id written by the producer
+   */
+  std::uint32_t GetProcessId() const;
+
+ private:
+  /**
+   * @brief Name of the segment
+   * @private
+   * @memberof SharedLogSegment
+   */
+  const std::string m_SegmentName;
+
+  /**
+   * @brief Bytes mapped
+   * @private
+   * @memberof SharedLogSegment
+   */
+  std::size_t m_Size{0};
+
+  /**
+   * @brief Header and data of the ring
+   * @private
+   * @memberof SharedLogSegment
+   */
+  char *m_Mapping{nullptr};
+
+  /**
+   * @brief Header of the ring, at the start of m_Mapping
+   * @private
+   * @memberof SharedLogSegment
+   */
+  SharedLogHeader *m_Header{nullptr};
+
+  /**
+   * @brief Records dropped by the producer already reported
+   * @private
+   * @memberof SharedLogSegment
+   */
+  std::uint64_t m_ReportedDrops{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_SHAREDLOGTRANSPORT_H_
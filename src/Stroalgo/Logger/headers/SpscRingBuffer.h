@@ -0,0 +1,173 @@
+/**
+ * @file        SpscRingBuffer.h
+ * @author      ALLOGHO
+ * @brief       A bounded lock-free single-producer ring buffer
+ * @details     The producer only writes the tail and the consumer only writes
+ *              the head, each keeps a cached copy of the other index so the
+ *              shared cache lines are read only when the ring looks full or
+ *              empty
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_SPSCRINGBUFFER_H_
+#define STROALGO_LOGGER_HEADERS_SPSCRINGBUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Stroalgo::Log {
+
+/**
+ * @class SpscRingBuffer
+ * @brief Bounded lock-free ring buffer safe for one producer and one consumer
+ *
+ * @tparam T Type of queued values, must be default constructible and movable
+ */
+template <typename T>
+class SpscRingBuffer {
+ public:
+  /**
+   * @brief Construct a new ring buffer
+   *
+   * @param pCapacity Requested capacity, rounded up to a power of two
+   */
+  explicit SpscRingBuffer(std::size_t pCapacity)
+      : m_Capacity(RoundUpToPowerOfTwo(pCapacity)),
+        m_Mask(m_Capacity - 1),
+        m_Values(std::make_unique<T[]>(m_Capacity)) {}
+
+  SpscRingBuffer(const SpscRingBuffer &) = delete;
+  SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+  /**
+   * @brief Try to queue a value without waiting, producer only
+   *
+   * @param pValue Value to queue, moved from only on success
+   * @return true if the value has been queued, false if the buffer is full
+   */
+  bool TryPush(T &&pValue) {
+    const std::size_t lTail{m_Tail.load(std::memory_order_relaxed)};
+    if (lTail - m_CachedHead == m_Capacity) {
+      m_CachedHead = m_Head.load(std::memory_order_acquire);
+      if (lTail - m_CachedHead == m_Capacity) {
+        return false;
+      }
+    }
+    m_Values[lTail & m_Mask] = std::move(pValue);
+    m_Tail.store(lTail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Get the oldest value without dequeuing it, consumer only
+   *
+   * @return The value, nullptr if the buffer is empty
+   */
+  T *Front() {
+    const std::size_t lHead{m_Head.load(std::memory_order_relaxed)};
+    if (lHead == m_CachedTail) {
+      m_CachedTail = m_Tail.load(std::memory_order_acquire);
+      if (lHead == m_CachedTail) {
+        return nullptr;
+      }
+    }
+    return &m_Values[lHead & m_Mask];
+  }
+
+  /**
+   * @brief Dequeue the value returned by Front, consumer only
+   * @note The slot keeps its value until it is overwritten, its storage is
+   * reused by the next push
+   *
+   */
+  void PopFront() {
+    m_Head.store(m_Head.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_release);
+  }
+
+  /**
+   * @brief Get the capacity of the ring buffer
+   *
+   * @return Number of slots
+   */
+  inline std::size_t Capacity() const { return m_Capacity; }
+
+  /**
+   * @brief Get the number of values queued since construction
+   *
+   * @return Monotonic enqueue counter
+   */
+  inline std::size_t EnqueuedCount() const {
+    return m_Tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Get the number of values dequeued since construction
+   *
+   * @return Monotonic dequeue counter
+   */
+  inline std::size_t DequeuedCount() const {
+    return m_Head.load(std::memory_order_acquire);
+  }
+
+ private:
+  /**
+   * @brief Size of a cache line, used to avoid false sharing
+   */
+  static constexpr std::size_t c_CacheLineSize{64};
+
+  /**
+   * @brief Round a capacity up to the next power of two (minimum 2)
+   *
+   * @param pValue Requested capacity
+   * @return Rounded capacity
+   */
+  static std::size_t RoundUpToPowerOfTwo(std::size_t pValue) {
+    std::size_t lRet{2};
+    while (lRet < pValue) {
+      lRet <<= 1U;
+    }
+    return lRet;
+  }
+
+  /**
+   * @brief Number of slots
+   * @private
+   */
+  const std::size_t m_Capacity;
+
+  /**
+   * @brief Mask used to map a position to a slot index
+   * @private
+   */
+  const std::size_t m_Mask;
+
+  /**
+   * @brief Slots storage
+   * @private
+   */
+  std::unique_ptr<T[]> m_Values;
+
+  /**
+   * @brief Next position written by the producer, with its copy of the head
+   * @private
+   */
+  alignas(c_CacheLineSize) std::atomic<std::size_t> m_Tail{0};
+  std::size_t m_CachedHead{0};
+
+  /**
+   * @brief Next position read by the consumer, with its copy of the tail
+   * @private
+   */
+  alignas(c_CacheLineSize) std::atomic<std::size_t> m_Head{0};
+  std::size_t m_CachedTail{0};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_SPSCRINGBUFFER_H_
@@ -0,0 +1,275 @@
+/**
+ * @file        StructuredFields.h
+ * @author      ALLOGHO
+ * @brief       Typed key-value fields attached to a log message
+ * @details     Info(module, "Login", Kv("user", lId), Kv("latency_us", lTime))
+ *              encodes the fields once, on the caller thread, as JSON members
+ *              appended to the message after a record separator. JSON sinks
+ *              write them as members of the record object, text sinks as a
+ *              JSON object following the message.
+ *
+ *              Records carrying fields are marked out of band, by the source
+ *              of their spdlog message, the flag of their queued record or
+ *              the format id of their binary record. The payload of any other
+ *              record is only text, whatever bytes it holds.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_STRUCTUREDFIELDS_H_
+#define STROALGO_LOGGER_HEADERS_STRUCTUREDFIELDS_H_
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/fmt/fmt.h>
+
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "JsonEscape.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Separates the message from the encoded fields in a payload
+ */
+constexpr char c_FieldsSeparator{'\x1e'};
+
+/**
+ * @brief Function name of the source of the spdlog messages carrying fields
+ */
+constexpr std::string_view c_StructuredSourceTag{"<fields>"};
+
+/**
+ * @brief Get the source of the spdlog messages carrying fields
+ *
+ * @return Source without file nor line, never printed by spdlog
+ */
+inline spdlog::source_loc StructuredSource() {
+  return spdlog::source_loc{"", 0, c_StructuredSourceTag.data()};
+}
+
+/**
+ * @brief Check if a spdlog message carries fields after its text
+ *
+ * @param pMsg The message
+ * @return true if its source is StructuredSource
+ */
+inline bool HasStructuredFields(const spdlog::details::log_msg &pMsg) {
+  return pMsg.source.funcname != nullptr &&
+         std::string_view{pMsg.source.funcname} == c_StructuredSourceTag;
+}
+
+/**
+ * @brief Named value of a structured message
+ * @note Strings are viewed, a field must not outlive the log call
+ * @struct KeyValue
+ *
+ * @tparam T Type of the value
+ */
+template <typename T>
+struct KeyValue {
+  /**
+   * @brief Name of the JSON member, must differ from the record fields
+   * (time, name, level, process, thread, message)
+   */
+  std::string_view m_Key;
+
+  /**
+   * @brief Value, written as a JSON number, boolean or string
+   */
+  T m_Value;
+};
+
+/**
+ * @brief Type stored by a field for a value type, strings are viewed
+ *
+ * @tparam T Type of the value
+ */
+template <typename T>
+using FieldValueType =
+    std::conditional_t<std::is_convertible_v<const std::decay_t<T> &,
+                                             std::string_view>,
+                       std::string_view, std::decay_t<T>>;
+
+/**
+ * @brief Build a field of a structured message
+ *
+ * @tparam T Type of the value
+ * @param pKey Name of the JSON member
+ * @param pValue Value of the member
+ * @return The field
+ */
+template <typename T>
+inline KeyValue<FieldValueType<T>> Kv(std::string_view pKey, T &&pValue) {
+  return KeyValue<FieldValueType<T>>{pKey,
+                                     FieldValueType<T>(std::forward<T>(pValue))};
+}
+
+/**
+ * @brief Check if a type is a field
+ *
+ * @tparam T Type to check
+ */
+template <typename T>
+struct IsKeyValue : std::false_type {};
+
+template <typename T>
+struct IsKeyValue<KeyValue<T>> : std::true_type {};
+
+/**
+ * @brief Check if the arguments of a log call are all fields
+ *
+ * @tparam Args Types of the arguments
+ * @return true if the message is structured
+ */
+template <typename... Args>
+constexpr bool IsStructuredMessage() {
+  return sizeof...(Args) > 0 && (IsKeyValue<std::decay_t<Args>>::value && ...);
+}
+
+/**
+ * @brief Write a value as JSON
+ *
+ * @tparam T Type of the value
+ * @param pOut Destination buffer
+ * @param pValue Value to write
+ */
+template <typename T>
+inline void AppendJsonValue(spdlog::memory_buf_t &pOut, const T &pValue) {
+  if constexpr (std::is_same_v<T, bool>) {
+    pOut.append(pValue ? std::string_view{"true"} : std::string_view{"false"});
+  } else if constexpr (std::is_same_v<T, char>) {
+    AppendJsonString(pOut, std::string_view{&pValue, 1});
+  } else if constexpr (std::is_integral_v<T>) {
+    const fmt::format_int lNumber{pValue};
+    pOut.append(lNumber.data(), lNumber.data() + lNumber.size());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // JSON has no infinity nor NaN
+    if (std::isfinite(pValue)) {
+      fmt::format_to(std::back_inserter(pOut), "{}", pValue);
+    } else {
+      pOut.append(std::string_view{"null"});
+    }
+  } else if constexpr (std::is_same_v<T, std::string_view>) {
+    AppendJsonString(pOut, pValue);
+  } else if constexpr (std::is_enum_v<T> &&
+                       !fmt::has_formatter<T, fmt::format_context>::value) {
+    AppendJsonValue(pOut, static_cast<std::underlying_type_t<T>>(pValue));
+  } else {
+    AppendJsonString(pOut, fmt::to_string(pValue));
+  }
+}
+
+/**
+ * @brief Write fields as the members of a JSON object, without braces
+ *
+ * @tparam Fields Types of the values
+ * @param pOut Destination buffer
+ * @param pFields Fields to write
+ */
+template <typename... Fields>
+inline void AppendJsonMembers(spdlog::memory_buf_t &pOut,
+                              const KeyValue<Fields> &...pFields) {
+  bool lFirst{true};
+  const auto lAppend{[&pOut, &lFirst](const auto &pField) {
+    if (!lFirst) {
+      pOut.append(std::string_view{", "});
+    }
+    lFirst = false;
+    AppendJsonString(pOut, pField.m_Key);
+    pOut.append(std::string_view{": "});
+    AppendJsonValue(pOut, pField.m_Value);
+  }};
+  (lAppend(pFields), ...);
+}
+
+/**
+ * @brief Split the payload of a record carrying fields into its message and
+ * its encoded fields
+ * @details The members escape every control character, the last separator
+ * ends the message whatever the message holds.
+ *
+ * @param pPayload Payload of a record carrying fields
+ * @return The message and the JSON members, empty if there is no separator
+ */
+inline std::pair<std::string_view, std::string_view> SplitStructuredPayload(
+    std::string_view pPayload) {
+  const std::size_t lSeparator{pPayload.rfind(c_FieldsSeparator)};
+  if (lSeparator == std::string_view::npos) {
+    return {pPayload, std::string_view{}};
+  }
+  return {pPayload.substr(0, lSeparator), pPayload.substr(lSeparator + 1)};
+}
+
+/**
+ * @brief Write a payload in a JSON record, "message": "..." followed by the
+ * fields as members
+ *
+ * @param pOut Destination buffer
+ * @param pPayload Payload of a record
+ * @param pStructured The record carries fields
+ */
+inline void AppendJsonPayload(spdlog::memory_buf_t &pOut,
+                              std::string_view pPayload, bool pStructured) {
+  const auto [lMessage, lMembers]{
+      pStructured ? SplitStructuredPayload(pPayload)
+                  : std::pair{pPayload, std::string_view{}}};
+  pOut.append(std::string_view{"\"message\": "});
+  AppendJsonString(pOut, lMessage);
+  if (!lMembers.empty()) {
+    pOut.append(std::string_view{", "});
+    pOut.append(lMembers.data(), lMembers.data() + lMembers.size());
+  }
+}
+
+/**
+ * @brief Write a payload in a text line, the message followed by the fields
+ * as a JSON object
+ *
+ * @param pOut Destination buffer
+ * @param pPayload Payload of a record
+ * @param pStructured The record carries fields
+ */
+inline void AppendTextPayload(spdlog::memory_buf_t &pOut,
+                              std::string_view pPayload, bool pStructured) {
+  const auto [lMessage, lMembers]{
+      pStructured ? SplitStructuredPayload(pPayload)
+                  : std::pair{pPayload, std::string_view{}}};
+  pOut.append(lMessage.data(), lMessage.data() + lMessage.size());
+  if (!lMembers.empty()) {
+    pOut.append(std::string_view{" {"});
+    pOut.append(lMembers.data(), lMembers.data() + lMembers.size());
+    pOut.push_back('}');
+  }
+}
+
+}  // namespace Stroalgo::Log
+
+/**
+ * @brief Format a field as key=value when it fills a placeholder of the
+ * message
+ *
+ * @tparam T Type of the value
+ */
+template <typename T>
+struct fmt::formatter<Stroalgo::Log::KeyValue<T>> {
+  constexpr auto parse(fmt::format_parse_context &pContext) {
+    return pContext.begin();
+  }
+
+  template <typename FormatContext>
+  auto format(const Stroalgo::Log::KeyValue<T> &pField,
+              FormatContext &pContext) const {
+    return fmt::format_to(pContext.out(), "{}={}", pField.m_Key,
+                          pField.m_Value);
+  }
+};
+
+#endif  // STROALGO_LOGGER_HEADERS_STRUCTUREDFIELDS_H_
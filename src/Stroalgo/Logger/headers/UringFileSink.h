@@ -0,0 +1,274 @@
+/**
+ * @file        UringFileSink.h
+ * @author      ALLOGHO
+ * @brief       spdlog sink writing daily log files with io_uring
+ * @details     Messages are gathered in registered buffers, a full buffer is
+ *              submitted as one fixed buffer write and the next buffer is
+ *              filled while the kernel writes it. Only a flush waits for the
+ *              writes. Falls back to pwrite when io_uring cannot be used.
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_HEADERS_URINGFILESINK_H_
+#define STROALGO_LOGGER_HEADERS_URINGFILESINK_H_
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "IoUring.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Size of a registered buffer
+ */
+constexpr std::size_t c_UringBufferSize{256 * 1024};
+
+/**
+ * @brief Number of registered buffers, one filled while the others are
+ * written
+ */
+constexpr std::size_t c_UringBufferCount{2};
+
+/**
+ * @class UringFileSink
+ * @brief Write messages in a new file every day at 00:00, with the naming of
+ * spdlog daily files
+ *
+ */
+class UringFileSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  /**
+   * @brief Construct a new Uring File Sink object and open today's file
+   *
+   * @param pBaseFilename Path without date, "Logs/M/M.txt" writes
+   * "Logs/M/M_YYYY-MM-DD.txt"
+   * @param pMaxFiles Number of daily files kept, 0 keeps all of them
+   */
+  explicit UringFileSink(const std::string &pBaseFilename,
+                         std::uint16_t pMaxFiles = 0);
+
+  /**
+   * @brief Destroy the Uring File Sink object, buffered messages are written
+   *
+   */
+  ~UringFileSink() override;
+
+  UringFileSink(const UringFileSink &) = delete;
+  UringFileSink &operator=(const UringFileSink &) = delete;
+
+  /**
+   * @brief Write buffered messages then run fdatasync through the ring
+   *
+   */
+  void Sync();
+
+  /**
+   * @brief Empty the current file, buffered messages are dropped
+   *
+   */
+  void Truncate();
+
+  /**
+   * @brief Get the path of the file currently written
+   *
+   * @return Path of today's file
+   */
+  std::string GetFilename();
+
+  /**
+   * @brief Check if the messages are written through io_uring
+   *
+   * @return false if the sink fell back to pwrite
+   */
+  bool IsUsingRing();
+
+ protected:
+  /**
+   * @brief Format a message and copy it in the current buffer
+   *
+   * @param pMsg The message
+   */
+  void sink_it_(const spdlog::details::log_msg &pMsg) override;
+
+  /**
+   * @brief Submit the current buffer and wait for every write
+   *
+   */
+  void flush_() override;
+
+ private:
+  /**
+   * @brief Copy bytes in the buffers, full buffers are submitted
+   *
+   * @param pData First byte
+   * @param pSize Number of bytes
+   */
+  void Append(const char *pData, std::size_t pSize);
+
+  /**
+   * @brief Submit the current buffer and switch to the next one
+   *
+   */
+  void SubmitCurrent();
+
+  /**
+   * @brief Wait until a buffer is written
+   *
+   * @param pBuffer Index of the buffer
+   */
+  void WaitBuffer(std::size_t pBuffer);
+
+  /**
+   * @brief Process the available completions
+   *
+   * @param pWait Wait for at least one completion
+   */
+  void Reap(bool pWait);
+
+  /**
+   * @brief Write the end of a buffer with pwrite
+   *
+   * @param pBuffer Index of the buffer
+   * @param pWritten Bytes of the buffer already written
+   */
+  void WriteBlocking(std::size_t pBuffer, std::size_t pWritten);
+
+  /**
+   * @brief Open the file of the message day when needed
+   *
+   * @param pTime Time of the message about to be written
+   */
+  void RotateIfNeeded(spdlog::log_clock::time_point pTime);
+
+  /**
+   * @brief Write the buffered messages then close the file
+   *
+   */
+  void Close();
+
+  /**
+   * @brief Path without date
+   * @private
+   * @memberof UringFileSink
+   */
+  const std::string m_BaseFilename;
+
+  /**
+   * @brief Number of daily files kept
+   * @private
+   * @memberof UringFileSink
+   */
+  const std::uint16_t m_MaxFiles;
+
+  /**
+   * @brief Time at which the next file is opened
+   * @private
+   * @memberof UringFileSink
+   */
+  spdlog::log_clock::time_point m_NextRotation{};
+
+  /**
+   * @brief Path of the file currently written
+   * @private
+   * @memberof UringFileSink
+   */
+  std::string m_Filename{};
+
+  /**
+   * @brief Descriptor of the file currently written, -1 if none
+   * @private
+   * @memberof UringFileSink
+   */
+  int m_File{-1};
+
+  /**
+   * @brief Offset of the next write in the file
+   * @private
+   * @memberof UringFileSink
+   */
+  std::uint64_t m_FileOffset{0};
+
+  /**
+   * @brief Registered buffers, declared before the ring to outlive it
+   * @private
+   * @memberof UringFileSink
+   */
+  std::array<std::vector<char>, c_UringBufferCount> m_Buffers{};
+
+  /**
+   * @brief Bytes filled in each buffer
+   * @private
+   * @memberof UringFileSink
+   */
+  std::array<std::size_t, c_UringBufferCount> m_Used{};
+
+  /**
+   * @brief File offset of the submitted write of each buffer
+   * @private
+   * @memberof UringFileSink
+   */
+  std::array<std::uint64_t, c_UringBufferCount> m_WriteOffset{};
+
+  /**
+   * @brief Buffers written by the kernel
+   * @private
+   * @memberof UringFileSink
+   */
+  std::array<bool, c_UringBufferCount> m_InFlight{};
+
+  /**
+   * @brief Index of the buffer filled
+   * @private
+   * @memberof UringFileSink
+   */
+  std::size_t m_Current{0};
+
+  /**
+   * @brief A fdatasync has been submitted and is not completed
+   * @private
+   * @memberof UringFileSink
+   */
+  bool m_SyncInFlight{false};
+
+  /**
+   * @brief Result of the last fdatasync
+   * @private
+   * @memberof UringFileSink
+   */
+  std::int32_t m_SyncResult{0};
+
+  /**
+   * @brief Ring used for the writes
+   * @private
+   * @memberof UringFileSink
+   */
+  IoUring m_Ring;
+
+  /**
+   * @brief Buffers are registered, false when falling back to pwrite
+   * @private
+   * @memberof UringFileSink
+   */
+  bool m_UseRing{false};
+
+  /**
+   * @brief Buffer reused to format messages
+   * @private
+   * @memberof UringFileSink
+   */
+  spdlog::memory_buf_t m_Formatted{};
+};
+
+}  // namespace Stroalgo::Log
+
+#endif  // STROALGO_LOGGER_HEADERS_URINGFILESINK_H_
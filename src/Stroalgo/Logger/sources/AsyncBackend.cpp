@@ -0,0 +1,325 @@
+/**
+ * @file AsyncBackend.cpp
+ * @brief Asynchronous front-end for the Logger
+ * @details Uses spdlog sinks
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "AsyncBackend.h"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string_view>
+
+#include "LoggerStats.h"
+#include "RecordSink.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Queue of the calling thread, closed when the thread exits
+ */
+struct ThreadBufferCache {
+  ThreadBufferCache() = default;
+  ThreadBufferCache(const ThreadBufferCache &) = delete;
+  ThreadBufferCache &operator=(const ThreadBufferCache &) = delete;
+  ~ThreadBufferCache() { Close(); }
+
+  /**
+   * @brief Let the backend release the queue once empty
+   *
+   */
+  void Close() {
+    if (m_Buffer != nullptr) {
+      m_Buffer->m_Closed.store(true, std::memory_order_release);
+      m_Buffer.reset();
+    }
+  }
+
+  /**
+   * @brief Identifier of the backend owning the queue, 0 if none
+   */
+  std::uint64_t m_Owner{0};
+
+  /**
+   * @brief Queue shared with the backend
+   */
+  std::shared_ptr<ThreadStagingBuffer> m_Buffer{nullptr};
+};
+
+thread_local ThreadBufferCache tThreadBuffer{};
+
+/**
+ * @brief Get a new backend identifier
+ *
+ * @return Identifier never returned before, never 0
+ */
+std::uint64_t NextBackendId() {
+  static std::atomic<std::uint64_t> lNextId{0};
+  return lNextId.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+}  // namespace
+
+AsyncBackend::AsyncBackend(const AsyncOptions &pOptions)
+    : m_Options(pOptions),
+      m_Id(NextBackendId()),
+      m_Queue(pOptions.m_QueueCapacity),
+      m_Thread([this]() { Run(); }) {}
+
+AsyncBackend::~AsyncBackend() { Stop(); }
+
+bool AsyncBackend::Submit(LogRecord &&pRecord) {
+  if (m_Options.m_ThreadLocalBuffers) {
+    // Only the queue of this thread is touched unless it is full
+    SpscRingBuffer<LogRecord> &lRecords{GetThreadBuffer().m_Records};
+    if (lRecords.TryPush(std::move(pRecord))) {
+      return true;
+    }
+    if (m_Options.m_OverflowPolicy != OverflowPolicy::Block) {
+      m_DroppedNewest.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    m_Blocked.fetch_add(1, std::memory_order_relaxed);
+    while (!lRecords.TryPush(std::move(pRecord))) {
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  if (m_Options.m_OverflowPolicy == OverflowPolicy::Block) {
+    if (m_Queue.TryPush(std::move(pRecord))) {
+      return true;
+    }
+    m_Blocked.fetch_add(1, std::memory_order_relaxed);
+  }
+  const auto lOnEvicted{[this](const LogRecord &pEvicted) {
+    m_DroppedOldest.fetch_add(1, std::memory_order_relaxed);
+    if (pEvicted.m_Counters != nullptr) {
+      pEvicted.m_Counters->m_QueueDropped.fetch_add(1,
+                                                    std::memory_order_relaxed);
+    }
+    // The evicted record will never be written by the backend
+    m_Completed.fetch_add(1, std::memory_order_release);
+  }};
+  const PushResult lResult{m_Queue.Push(
+      std::move(pRecord), m_Options.m_OverflowPolicy, lOnEvicted)};
+  if (lResult == PushResult::DroppedNewest) {
+    m_DroppedNewest.fetch_add(1, std::memory_order_relaxed);
+  }
+  return lResult != PushResult::DroppedNewest;
+}
+
+void AsyncBackend::Drain() {
+  std::vector<std::pair<std::shared_ptr<ThreadStagingBuffer>, std::size_t>>
+      lBuffers{};
+  {
+    std::lock_guard<std::mutex> lLock(m_BuffersMutex);
+    for (const auto &lBuffer : m_Buffers) {
+      lBuffers.emplace_back(lBuffer, lBuffer->m_Records.EnqueuedCount());
+    }
+  }
+  const std::size_t lTarget{m_Queue.EnqueuedCount()};
+  while (m_Completed.load(std::memory_order_acquire) < lTarget &&
+         m_Thread.joinable()) {
+    std::this_thread::sleep_for(m_Options.m_IdleSleep);
+  }
+  for (const auto &lBuffer : lBuffers) {
+    while (lBuffer.first->m_Records.DequeuedCount() < lBuffer.second &&
+           m_Thread.joinable()) {
+      std::this_thread::sleep_for(m_Options.m_IdleSleep);
+    }
+  }
+}
+
+void AsyncBackend::Stop() {
+  m_Running.store(false, std::memory_order_release);
+  if (m_Thread.joinable()) {
+    m_Thread.join();
+  }
+}
+
+AsyncCounters AsyncBackend::GetCounters() const {
+  AsyncCounters lRet{};
+  lRet.m_DroppedNewest = m_DroppedNewest.load(std::memory_order_relaxed);
+  lRet.m_DroppedOldest = m_DroppedOldest.load(std::memory_order_relaxed);
+  lRet.m_Blocked = m_Blocked.load(std::memory_order_relaxed);
+  lRet.m_QueueHighWater = m_QueueHighWater.load(std::memory_order_relaxed);
+  return lRet;
+}
+
+ThreadStagingBuffer &AsyncBackend::GetThreadBuffer() {
+  if (tThreadBuffer.m_Owner != m_Id) {
+    // Queue of a previous backend is released by it
+    tThreadBuffer.Close();
+    tThreadBuffer.m_Buffer =
+        std::make_shared<ThreadStagingBuffer>(m_Options.m_ThreadBufferCapacity);
+    tThreadBuffer.m_Owner = m_Id;
+    std::lock_guard<std::mutex> lLock(m_BuffersMutex);
+    m_Buffers.push_back(tThreadBuffer.m_Buffer);
+    m_BuffersVersion.fetch_add(1, std::memory_order_release);
+  }
+  return *tThreadBuffer.m_Buffer;
+}
+
+std::size_t AsyncBackend::MergeThreadBuffers(
+    const std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers) {
+  std::size_t lRet{0};
+  while (lRet < c_MaxBatchSize) {
+    // Oldest record at the front of a queue
+    SpscRingBuffer<LogRecord> *lOldest{nullptr};
+    const LogRecord *lOldestRecord{nullptr};
+    for (const auto &lBuffer : pBuffers) {
+      const LogRecord *lRecord{lBuffer->m_Records.Front()};
+      if (lRecord != nullptr &&
+          (lOldestRecord == nullptr ||
+           lRecord->m_Time < lOldestRecord->m_Time)) {
+        lOldest = &lBuffer->m_Records;
+        lOldestRecord = lRecord;
+      }
+    }
+    if (lOldest == nullptr) {
+      break;
+    }
+    Dispatch(*lOldestRecord);
+    lOldest->PopFront();
+    ++lRet;
+  }
+  return lRet;
+}
+
+void AsyncBackend::ReleaseThreadBuffers(
+    std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers) {
+  // Records pushed before the thread exited are visible once it is closed
+  const auto lReleased{std::partition(
+      pBuffers.begin(), pBuffers.end(), [](const auto &pBuffer) {
+        return !pBuffer->m_Closed.load(std::memory_order_acquire) ||
+               pBuffer->m_Records.Front() != nullptr;
+      })};
+  if (lReleased == pBuffers.end()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lLock(m_BuffersMutex);
+  for (auto lIt = lReleased; lIt != pBuffers.end(); ++lIt) {
+    m_Buffers.erase(std::find(m_Buffers.begin(), m_Buffers.end(), *lIt));
+  }
+  pBuffers.erase(lReleased, pBuffers.end());
+  m_BuffersVersion.fetch_add(1, std::memory_order_release);
+}
+
+void AsyncBackend::UpdateQueueHighWater(
+    const std::vector<std::shared_ptr<ThreadStagingBuffer>> &pBuffers) {
+  std::size_t lWaiting{m_Queue.SizeApprox()};
+  for (const auto &lBuffer : pBuffers) {
+    lWaiting += lBuffer->m_Records.EnqueuedCount() -
+                lBuffer->m_Records.DequeuedCount();
+  }
+  if (lWaiting > m_QueueHighWater.load(std::memory_order_relaxed)) {
+    m_QueueHighWater.store(lWaiting, std::memory_order_relaxed);
+  }
+}
+
+void AsyncBackend::Run() {
+  // Number of empty polls answered by a yield before sleeping
+  constexpr std::size_t lSpinRounds{64};
+
+  LogRecord lRecord;
+  std::vector<std::shared_ptr<ThreadStagingBuffer>> lBuffers{};
+  std::size_t lBuffersVersion{0};
+  std::size_t lIdleRounds{0};
+  for (;;) {
+    // Thread queues are copied only when one is registered or released
+    const std::size_t lVersion{
+        m_BuffersVersion.load(std::memory_order_acquire)};
+    if (lVersion != lBuffersVersion) {
+      std::lock_guard<std::mutex> lLock(m_BuffersMutex);
+      lBuffers = m_Buffers;
+      lBuffersVersion = m_BuffersVersion.load(std::memory_order_relaxed);
+    }
+    UpdateQueueHighWater(lBuffers);
+
+    std::size_t lWritten{0};
+    while (lWritten < c_MaxBatchSize && m_Queue.TryPop(lRecord)) {
+      Dispatch(lRecord);
+      ++lWritten;
+    }
+    if (lWritten > 0) {
+      m_Completed.fetch_add(lWritten, std::memory_order_release);
+    }
+    if (!lBuffers.empty()) {
+      lWritten += MergeThreadBuffers(lBuffers);
+      ReleaseThreadBuffers(lBuffers);
+    }
+
+    if (lWritten > 0) {
+      lIdleRounds = 0;
+    } else if (!m_Running.load(std::memory_order_acquire) &&
+               m_Queue.SizeApprox() == 0) {
+      break;
+    } else if (lIdleRounds < lSpinRounds) {
+      ++lIdleRounds;
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(m_Options.m_IdleSleep);
+    }
+  }
+}
+
+void AsyncBackend::Dispatch(const LogRecord &pRecord) {
+  if (pRecord.m_Logger == nullptr) {
+    return;
+  }
+
+  try {
+    std::string_view lPayload{pRecord.Payload()};
+    bool lFormatted{!pRecord.IsDeferred()};
+    spdlog::details::log_msg lMsg{
+        pRecord.m_Time,
+        pRecord.m_Structured ? StructuredSource() : spdlog::source_loc{},
+        pRecord.m_Logger->name(), pRecord.m_Level,
+        spdlog::string_view_t{lPayload.data(), lPayload.size()}};
+    lMsg.thread_id = pRecord.m_ThreadId;
+
+    for (const auto &lSink : pRecord.m_Logger->sinks()) {
+      if (!lSink->should_log(lMsg.level)) {
+        continue;
+      }
+
+      // Record sinks store deferred arguments without formatting them
+      auto *lRecordSink{dynamic_cast<RecordSink *>(lSink.get())};
+      if (lRecordSink != nullptr) {
+        lRecordSink->WriteRecord(pRecord);
+        continue;
+      }
+
+      // Other sinks share a message formatted once
+      if (!lFormatted) {
+        m_DeferredPayload.clear();
+        if (!FormatDeferredArgs(pRecord.m_Format, lPayload,
+                                m_DeferredPayload)) {
+          throw std::runtime_error("corrupted deferred arguments");
+        }
+        lMsg.payload = spdlog::string_view_t{m_DeferredPayload.data(),
+                                             m_DeferredPayload.size()};
+        lFormatted = true;
+      }
+      lSink->log(lMsg);
+    }
+    if (lMsg.level >= pRecord.m_Logger->flush_level()) {
+      pRecord.m_Logger->flush();
+    }
+  } catch (const std::exception &lException) {
+    spdlog::critical("Unable to write Log asynchronously for {} : {}",
+                     pRecord.m_Logger->name(), lException.what());
+  }
+}
+
+}  // namespace Stroalgo::Log
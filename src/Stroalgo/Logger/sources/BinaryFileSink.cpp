@@ -0,0 +1,159 @@
+/**
+ * @file BinaryFileSink.cpp
+ * @brief spdlog sink writing daily binary log files
+ * @details Uses spdlog file helper
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "BinaryFileSink.h"
+
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/daily_file_sink.h>
+
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+
+#include "BinaryLogFormat.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Append bytes to an entry
+ *
+ * @param pOut Entry being encoded
+ * @param pData Bytes to append
+ */
+void AppendBytes(spdlog::memory_buf_t &pOut, std::string_view pData) {
+  pOut.append(pData.data(), pData.data() + pData.size());
+}
+
+}  // namespace
+
+BinaryFileSink::BinaryFileSink(const std::string &pBaseFilename,
+                               const std::string &pModuleName,
+                               std::uint32_t pModuleId,
+                               std::uint16_t pMaxFiles)
+    : m_BaseFilename(pBaseFilename),
+      m_ModuleName(pModuleName),
+      m_ModuleId(pModuleId),
+      m_MaxFiles(pMaxFiles) {
+  RotateIfNeeded(spdlog::log_clock::now());
+}
+
+void BinaryFileSink::WriteRecord(const LogRecord &pRecord) {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  WriteEntry(pRecord.m_Time, pRecord.m_Level, pRecord.m_ThreadId,
+             pRecord.m_Format, pRecord.Payload(), pRecord.m_Structured);
+}
+
+void BinaryFileSink::Truncate() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  m_File.reopen(true);
+  m_Formats.clear();
+  WriteHeaderIfEmpty();
+  m_Offset = m_File.size();
+  m_Index.Truncate(m_Offset);
+}
+
+std::string BinaryFileSink::GetFilename() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  return m_File.filename();
+}
+
+void BinaryFileSink::sink_it_(const spdlog::details::log_msg &pMsg) {
+  WriteEntry(pMsg.time, pMsg.level, pMsg.thread_id, std::string_view{},
+             std::string_view{pMsg.payload.data(), pMsg.payload.size()},
+             HasStructuredFields(pMsg));
+}
+
+void BinaryFileSink::flush_() {
+  // Index flushed after the data, it never describes bytes not written yet
+  m_File.flush();
+  m_Index.Flush();
+}
+
+void BinaryFileSink::WriteEntry(spdlog::log_clock::time_point pTime,
+                                spdlog::level::level_enum pLevel,
+                                std::size_t pThreadId, std::string_view pFormat,
+                                std::string_view pPayload, bool pStructured) {
+  RotateIfNeeded(pTime);
+  m_Buffer.clear();
+
+  // Format strings are written once per file, before their first record
+  std::uint32_t lFormatId{GetTextFormatId(pStructured)};
+  if (pFormat.data() != nullptr) {
+    auto [lFormat, lInserted] = m_Formats.try_emplace(
+        pFormat.data(), static_cast<std::uint32_t>(m_Formats.size() + 1));
+    lFormatId = lFormat->second;
+    if (lInserted) {
+      m_Index.AddFormat(m_Offset);
+      m_Buffer.push_back(static_cast<char>(BinaryEntryKind::Format));
+      AppendLittleEndian(m_Buffer, lFormatId);
+      AppendLittleEndian(m_Buffer, static_cast<std::uint32_t>(pFormat.size()));
+      AppendBytes(m_Buffer, pFormat);
+    }
+  }
+
+  const std::int64_t lTime{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               pTime.time_since_epoch())
+                               .count()};
+  AppendBinaryRecord(m_Buffer, lTime, pLevel, m_ModuleId, pThreadId, lFormatId,
+                     pPayload);
+  m_File.write(m_Buffer);
+  m_Offset += m_Buffer.size();
+  m_WrittenBytes.fetch_add(m_Buffer.size(), std::memory_order_relaxed);
+  m_Index.AddRecord(m_Offset, lTime, pLevel);
+}
+
+void BinaryFileSink::RotateIfNeeded(spdlog::log_clock::time_point pTime) {
+  if (pTime < m_NextRotation) {
+    return;
+  }
+
+  const std::time_t lTime{spdlog::log_clock::to_time_t(pTime)};
+  std::tm lDate{spdlog::details::os::localtime(lTime)};
+  m_File.open(
+      spdlog::sinks::daily_filename_calculator::calc_filename(m_BaseFilename,
+                                                              lDate),
+      false);
+  m_Formats.clear();
+  const bool lNewFile{m_File.size() == 0};
+  WriteHeaderIfEmpty();
+  m_Offset = m_File.size();
+  m_Index.Open(m_File.filename(), m_Offset, lNewFile);
+
+  // Remove the file leaving the retention window
+  if (m_MaxFiles > 0) {
+    std::tm lExpired{lDate};
+    lExpired.tm_mday -= m_MaxFiles;
+    std::mktime(&lExpired);
+    const std::string lExpiredFile{
+        spdlog::sinks::daily_filename_calculator::calc_filename(m_BaseFilename,
+                                                                lExpired)};
+    std::error_code lError{};
+    std::filesystem::remove(lExpiredFile, lError);
+    std::filesystem::remove(GetBinaryIndexFilename(lExpiredFile), lError);
+  }
+
+  // Next file is opened at 00:00
+  lDate.tm_hour = 0;
+  lDate.tm_min = 0;
+  lDate.tm_sec = 0;
+  lDate.tm_mday += 1;
+  m_NextRotation = spdlog::log_clock::from_time_t(std::mktime(&lDate));
+}
+
+void BinaryFileSink::WriteHeaderIfEmpty() {
+  if (m_File.size() == 0) {
+    m_Buffer.clear();
+    AppendBinaryHeader(m_Buffer, m_ModuleId, m_ModuleName);
+    m_File.write(m_Buffer);
+    m_File.flush();
+  }
+}
+
+}  // namespace Stroalgo::Log
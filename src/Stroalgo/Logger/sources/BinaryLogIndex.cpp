@@ -0,0 +1,212 @@
+/**
+ * @file BinaryLogIndex.cpp
+ * @brief Sparse time index of the binary log files
+ * @details Uses spdlog file helper
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "BinaryLogIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <limits>
+
+namespace Stroalgo::Log {
+
+void BinaryLogIndexWriter::Open(const std::string &pFilePath,
+                                std::uint64_t pFileSize, bool pNewFile) {
+  m_File.open(GetBinaryIndexFilename(pFilePath), pNewFile);
+  WriteHeaderIfEmpty();
+
+  // Records already in the file and not indexed are read by every query
+  m_Block = BinaryLogBlock{pFileSize, pFileSize, 0, 0, 0};
+  m_BlockUsed = false;
+}
+
+void BinaryLogIndexWriter::Truncate(std::uint64_t pFileSize) {
+  m_File.reopen(true);
+  WriteHeaderIfEmpty();
+  m_Block = BinaryLogBlock{pFileSize, pFileSize, 0, 0, 0};
+  m_BlockUsed = false;
+}
+
+void BinaryLogIndexWriter::AddFormat(std::uint64_t pOffset) {
+  m_Buffer.clear();
+  m_Buffer.push_back(static_cast<char>(BinaryIndexKind::Format));
+  AppendLittleEndian(m_Buffer, pOffset);
+  m_File.write(m_Buffer);
+}
+
+void BinaryLogIndexWriter::AddRecord(std::uint64_t pEnd, std::int64_t pTime,
+                                     spdlog::level::level_enum pLevel) {
+  m_Block.m_End = pEnd;
+  m_Block.m_Levels |= GetLevelMask(pLevel);
+  m_Block.m_MinTime = m_BlockUsed ? std::min(m_Block.m_MinTime, pTime) : pTime;
+  m_Block.m_MaxTime = m_BlockUsed ? std::max(m_Block.m_MaxTime, pTime) : pTime;
+  m_BlockUsed = true;
+  if (m_Block.m_End - m_Block.m_Begin < c_BinaryIndexBlockSize) {
+    return;
+  }
+
+  m_Buffer.clear();
+  m_Buffer.push_back(static_cast<char>(BinaryIndexKind::Block));
+  AppendLittleEndian(m_Buffer, m_Block.m_Begin);
+  AppendLittleEndian(m_Buffer, m_Block.m_End);
+  AppendLittleEndian(m_Buffer, m_Block.m_MinTime);
+  AppendLittleEndian(m_Buffer, m_Block.m_MaxTime);
+  AppendLittleEndian(m_Buffer, m_Block.m_Levels);
+  m_File.write(m_Buffer);
+  m_Block = BinaryLogBlock{pEnd, pEnd, 0, 0, 0};
+  m_BlockUsed = false;
+}
+
+void BinaryLogIndexWriter::Flush() { m_File.flush(); }
+
+void BinaryLogIndexWriter::WriteHeaderIfEmpty() {
+  if (m_File.size() == 0) {
+    m_Buffer.clear();
+    m_Buffer.append(c_BinaryIndexMagic.data(),
+                    c_BinaryIndexMagic.data() + c_BinaryIndexMagic.size());
+    AppendLittleEndian(m_Buffer, c_BinaryIndexVersion);
+    m_File.write(m_Buffer);
+    m_File.flush();
+  }
+}
+
+BinaryLogIndex::BinaryLogIndex(const std::string &pFilePath) {
+  std::ifstream lFile{GetBinaryIndexFilename(pFilePath), std::ios::binary};
+  std::array<char, 4 + 2> lHeader{};
+  lFile.read(lHeader.data(), lHeader.size());
+  m_Valid = lFile.gcount() == static_cast<std::streamsize>(lHeader.size()) &&
+            std::string_view(lHeader.data(), 4) == c_BinaryIndexMagic &&
+            ReadLittleEndian<std::uint16_t>(lHeader.data() + 4) ==
+                c_BinaryIndexVersion;
+
+  // A truncated last entry is ignored, its bytes are read as not indexed
+  std::array<char, 1 + 8 + 8 + 8 + 8 + 1> lEntry{};
+  while (m_Valid && lFile.read(lEntry.data(), 1)) {
+    if (lEntry[0] == static_cast<char>(BinaryIndexKind::Block)) {
+      if (!lFile.read(lEntry.data() + 1, 33)) {
+        break;
+      }
+      BinaryLogBlock lBlock{};
+      lBlock.m_Begin = ReadLittleEndian<std::uint64_t>(lEntry.data() + 1);
+      lBlock.m_End = ReadLittleEndian<std::uint64_t>(lEntry.data() + 9);
+      lBlock.m_MinTime = ReadLittleEndian<std::int64_t>(lEntry.data() + 17);
+      lBlock.m_MaxTime = ReadLittleEndian<std::int64_t>(lEntry.data() + 25);
+      lBlock.m_Levels = ReadLittleEndian<std::uint8_t>(lEntry.data() + 33);
+      m_Blocks.push_back(lBlock);
+    } else if (lEntry[0] == static_cast<char>(BinaryIndexKind::Format)) {
+      if (!lFile.read(lEntry.data() + 1, 8)) {
+        break;
+      }
+      m_Formats.push_back(ReadLittleEndian<std::uint64_t>(lEntry.data() + 1));
+    } else {
+      break;
+    }
+  }
+}
+
+BinaryLogRangeReader::BinaryLogRangeReader(const std::string &pFilePath,
+                                           spdlog::log_clock::time_point pStart,
+                                           spdlog::log_clock::time_point pEnd,
+                                           std::uint8_t pLevels)
+    : m_Reader(pFilePath),
+      m_Index(pFilePath),
+      m_Start(ToBinaryTime(pStart)),
+      m_End(ToBinaryTime(pEnd)),
+      m_Levels(pLevels),
+      m_Tombstones(LoadBinaryTombstones(pFilePath)) {
+  if (!m_Reader.IsValid()) {
+    return;
+  }
+
+  // Bytes between indexed blocks are read, indexed blocks only if they
+  // overlap the time range, hold a level read and are not entirely deleted
+  const auto lDeleted{[this](const BinaryLogBlock &pBlock) {
+    return std::any_of(m_Tombstones.begin(), m_Tombstones.end(),
+                       [&pBlock](const BinaryLogTombstone &pTombstone) {
+                         return pTombstone.m_Start <= pBlock.m_MinTime &&
+                                pBlock.m_MaxTime <= pTombstone.m_End &&
+                                (pBlock.m_Levels & ~pTombstone.m_Levels) == 0;
+                       });
+  }};
+  std::uint64_t lCursor{m_Reader.GetDataOffset()};
+  for (const auto &lBlock : m_Index.GetBlocks()) {
+    if (lBlock.m_Begin < lCursor) {
+      continue;
+    }
+    if (lBlock.m_Begin > lCursor) {
+      m_Ranges.emplace_back(lCursor, lBlock.m_Begin);
+    }
+    if (lBlock.m_MaxTime >= m_Start && lBlock.m_MinTime <= m_End &&
+        (lBlock.m_Levels & m_Levels) != 0 && !lDeleted(lBlock)) {
+      if (!m_Ranges.empty() && m_Ranges.back().second == lBlock.m_Begin) {
+        m_Ranges.back().second = lBlock.m_End;
+      } else {
+        m_Ranges.emplace_back(lBlock.m_Begin, lBlock.m_End);
+      }
+    }
+    lCursor = lBlock.m_End;
+  }
+  if (!m_Ranges.empty() && m_Ranges.back().second == lCursor) {
+    m_Ranges.back().second = std::numeric_limits<std::uint64_t>::max();
+  } else {
+    m_Ranges.emplace_back(lCursor, std::numeric_limits<std::uint64_t>::max());
+  }
+}
+
+void BinaryLogRangeReader::SetStartOffset(std::uint64_t pOffset) {
+  const auto lFirst{std::find_if(
+      m_Ranges.begin(), m_Ranges.end(),
+      [pOffset](const auto &pRange) { return pRange.second > pOffset; })};
+  m_Ranges.erase(m_Ranges.begin(), lFirst);
+  if (!m_Ranges.empty() && m_Ranges.front().first < pOffset) {
+    m_Ranges.front().first = pOffset;
+  }
+}
+
+bool BinaryLogRangeReader::Next(BinaryLogEntry &pEntry) {
+  while (m_Reader.IsValid()) {
+    if (m_RangeEnd == 0 || m_Reader.GetOffset() >= m_RangeEnd) {
+      if (m_NextRange == m_Ranges.size()) {
+        return false;
+      }
+      const auto [lBegin, lEnd] = m_Ranges[m_NextRange++];
+
+      // Formats written before the range, the last definition of an id wins
+      const auto &lFormats{m_Index.GetFormats()};
+      while (m_NextFormat < lFormats.size() &&
+             lFormats[m_NextFormat] < lBegin) {
+        m_Reader.ReadFormatAt(lFormats[m_NextFormat++]);
+      }
+      m_Reader.Seek(lBegin);
+      m_RangeEnd = lEnd;
+    }
+
+    m_EntryOffset = m_Reader.GetOffset();
+    if (!m_Reader.Next(pEntry)) {
+      // End of the file, or of the data really written for a block indexed
+      // before a crash
+      m_RangeEnd = 0;
+      if (m_NextRange == m_Ranges.size()) {
+        return false;
+      }
+      continue;
+    }
+    const std::int64_t lTime{ToBinaryTime(pEntry.m_Time)};
+    if (lTime >= m_Start && lTime <= m_End &&
+        (GetLevelMask(pEntry.m_Level) & m_Levels) != 0 &&
+        std::none_of(m_Tombstones.begin(), m_Tombstones.end(),
+                     [lTime, &pEntry](const BinaryLogTombstone &pTombstone) {
+                       return pTombstone.Matches(lTime, pEntry.m_Level);
+                     })) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace Stroalgo::Log
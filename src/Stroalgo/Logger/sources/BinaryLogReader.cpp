@@ -0,0 +1,136 @@
+/**
+ * @file BinaryLogReader.cpp
+ * @brief Read the records of a binary log file
+ * @details Deferred records are formatted with fmt, archives are read
+ *          through LogArchiveBuffer
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "BinaryLogFormat.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <chrono>
+
+#include "DeferredArgs.h"
+#include "LogArchive.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+BinaryLogReader::BinaryLogReader(const std::string &pFilePath)
+    : m_Buffer(OpenLogFileBuffer(pFilePath)), m_File(m_Buffer.get()) {
+  std::array<char, 4 + 2 + 4 + 4> lHeader{};
+  if (Read(lHeader.data(), lHeader.size()) &&
+      std::string_view(lHeader.data(), 4) == c_BinaryLogMagic) {
+    m_Version = ReadLittleEndian<std::uint16_t>(lHeader.data() + 4);
+  }
+  if (m_Version == c_BinaryLogVersion ||
+      m_Version == c_BinaryLogInBandVersion) {
+    m_ModuleName.resize(ReadLittleEndian<std::uint32_t>(lHeader.data() + 10));
+    m_Valid = Read(m_ModuleName.data(), m_ModuleName.size());
+    m_ModuleId = ReadLittleEndian<std::uint32_t>(lHeader.data() + 6);
+    m_DataOffset = lHeader.size() + m_ModuleName.size();
+  }
+  if (!m_Valid) {
+    m_ModuleName.clear();
+    m_ModuleId = 0;
+  }
+}
+
+bool BinaryLogReader::Next(BinaryLogEntry &pEntry) {
+  bool lRet{false};
+  char lKind{0};
+  while (m_Valid && !lRet && Read(&lKind, 1)) {
+    if (lKind == static_cast<char>(BinaryEntryKind::Format)) {
+      if (!ReadFormat()) {
+        break;
+      }
+    } else if (lKind == static_cast<char>(BinaryEntryKind::Record)) {
+      std::array<char, c_BinaryRecordHeaderSize - 1> lRecordHeader{};
+      if (!Read(lRecordHeader.data(), lRecordHeader.size())) {
+        break;
+      }
+      const char *lData{lRecordHeader.data()};
+      pEntry.m_Time = spdlog::log_clock::time_point{
+          std::chrono::duration_cast<spdlog::log_clock::duration>(
+              std::chrono::nanoseconds{ReadLittleEndian<std::int64_t>(lData)})};
+      pEntry.m_Level =
+          static_cast<spdlog::level::level_enum>(ReadLittleEndian<std::uint8_t>(
+              lData + 8));
+      pEntry.m_ModuleId = ReadLittleEndian<std::uint32_t>(lData + 9);
+      pEntry.m_ThreadId = ReadLittleEndian<std::uint64_t>(lData + 13);
+      const auto lFormatId{ReadLittleEndian<std::uint32_t>(lData + 21)};
+      m_Payload.resize(ReadLittleEndian<std::uint32_t>(lData + 25));
+      if (!Read(m_Payload.data(), m_Payload.size())) {
+        break;
+      }
+
+      // Records appended by this version to a version 1 file of the day use
+      // the reserved id too, never allocated by version 1 writers
+      pEntry.m_Structured =
+          lFormatId == c_StructuredFormatId ||
+          (m_Version == c_BinaryLogInBandVersion &&
+           lFormatId == c_TextFormatId &&
+           m_Payload.find(c_FieldsSeparator) != std::string::npos);
+      if (lFormatId == c_TextFormatId || pEntry.m_Structured) {
+        pEntry.m_Message = m_Payload;
+        lRet = true;
+      } else {
+        const auto lFormat{m_Formats.find(lFormatId)};
+        fmt::memory_buffer lMessage{};
+        lRet = lFormat != m_Formats.end() &&
+               FormatDeferredArgs(lFormat->second, m_Payload, lMessage);
+        if (!lRet) {
+          break;
+        }
+        pEntry.m_Message.assign(lMessage.data(), lMessage.size());
+      }
+    } else {
+      // Unknown entry, the rest of the file can not be parsed
+      break;
+    }
+  }
+  return lRet;
+}
+
+std::uint64_t BinaryLogReader::GetOffset() {
+  const auto lOffset{m_File.tellg()};
+  return lOffset < 0 ? 0 : static_cast<std::uint64_t>(lOffset);
+}
+
+void BinaryLogReader::Seek(std::uint64_t pOffset) {
+  // A read past the end leaves the stream failed
+  m_File.clear();
+  m_File.seekg(static_cast<std::streamoff>(pOffset));
+}
+
+bool BinaryLogReader::ReadFormatAt(std::uint64_t pOffset) {
+  char lKind{0};
+  Seek(pOffset);
+  return m_Valid && Read(&lKind, 1) &&
+         lKind == static_cast<char>(BinaryEntryKind::Format) && ReadFormat();
+}
+
+bool BinaryLogReader::ReadFormat() {
+  std::array<char, 8> lFormatHeader{};
+  std::string lFormat{};
+  if (!Read(lFormatHeader.data(), lFormatHeader.size())) {
+    return false;
+  }
+  lFormat.resize(ReadLittleEndian<std::uint32_t>(lFormatHeader.data() + 4));
+  if (!Read(lFormat.data(), lFormat.size())) {
+    return false;
+  }
+  m_Formats[ReadLittleEndian<std::uint32_t>(lFormatHeader.data())] =
+      std::move(lFormat);
+  return true;
+}
+
+bool BinaryLogReader::Read(char *pData, std::size_t pSize) {
+  m_File.read(pData, static_cast<std::streamsize>(pSize));
+  return static_cast<std::size_t>(m_File.gcount()) == pSize;
+}
+
+}  // namespace Stroalgo::Log
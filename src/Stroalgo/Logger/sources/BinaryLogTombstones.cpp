@@ -0,0 +1,137 @@
+/**
+ * @file BinaryLogTombstones.cpp
+ * @brief Deletion marks of the records of a binary log file
+ * @details Uses std::fstream
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "BinaryLogTombstones.h"
+
+#include <array>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+#include "BinaryLogFormat.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Size of the header of a tombstone file
+ */
+constexpr std::size_t c_TombstoneHeaderSize{4 + 2};
+
+/**
+ * @brief Size of a tombstone
+ */
+constexpr std::size_t c_TombstoneSize{8 + 8 + 1};
+
+/**
+ * @brief Serializes the updates of the tombstone files of the process, a
+ * compaction must not drop a tombstone being added
+ *
+ * @return The mutex
+ */
+std::mutex &GetTombstonesMutex() {
+  static std::mutex lMutex{};
+  return lMutex;
+}
+
+/**
+ * @brief Write a tombstone file
+ *
+ * @param pFilePath Path of the binary log file
+ * @param pTombstones Tombstones written
+ * @param pAppend Append to the existing tombstones
+ */
+void WriteTombstones(const std::string &pFilePath,
+                     const std::vector<BinaryLogTombstone> &pTombstones,
+                     bool pAppend) {
+  const std::string lFilename{GetBinaryTombstoneFilename(pFilePath)};
+  std::error_code lError{};
+  const bool lEmpty{!pAppend || !std::filesystem::exists(lFilename, lError) ||
+                    std::filesystem::file_size(lFilename, lError) == 0};
+  std::ofstream lFile{lFilename, std::ios::binary | (pAppend
+                                                         ? std::ios::app
+                                                         : std::ios::trunc)};
+  if (!lFile) {
+    spdlog::throw_spdlog_ex("Failed opening file " + lFilename, errno);
+  }
+
+  spdlog::memory_buf_t lBuffer{};
+  if (lEmpty) {
+    lBuffer.append(c_BinaryTombstoneMagic.data(),
+                   c_BinaryTombstoneMagic.data() +
+                       c_BinaryTombstoneMagic.size());
+    AppendLittleEndian(lBuffer, c_BinaryTombstoneVersion);
+  }
+  for (const auto &lTombstone : pTombstones) {
+    AppendLittleEndian(lBuffer, lTombstone.m_Start);
+    AppendLittleEndian(lBuffer, lTombstone.m_End);
+    AppendLittleEndian(lBuffer, lTombstone.m_Levels);
+  }
+  lFile.write(lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+  lFile.flush();
+  if (!lFile) {
+    spdlog::throw_spdlog_ex("Failed writing to file " + lFilename, errno);
+  }
+}
+
+}  // namespace
+
+void AddBinaryTombstone(const std::string &pFilePath,
+                        const BinaryLogTombstone &pTombstone) {
+  std::lock_guard<std::mutex> lLock(GetTombstonesMutex());
+  WriteTombstones(pFilePath, {pTombstone}, true);
+}
+
+std::vector<BinaryLogTombstone> LoadBinaryTombstones(
+    const std::string &pFilePath) {
+  std::vector<BinaryLogTombstone> lRet{};
+  std::ifstream lFile{GetBinaryTombstoneFilename(pFilePath), std::ios::binary};
+  std::array<char, c_TombstoneHeaderSize> lHeader{};
+  if (!lFile.read(lHeader.data(), lHeader.size()) ||
+      std::string_view(lHeader.data(), 4) != c_BinaryTombstoneMagic ||
+      ReadLittleEndian<std::uint16_t>(lHeader.data() + 4) !=
+          c_BinaryTombstoneVersion) {
+    return lRet;
+  }
+
+  // A truncated last tombstone is ignored
+  std::array<char, c_TombstoneSize> lEntry{};
+  while (lFile.read(lEntry.data(), lEntry.size())) {
+    BinaryLogTombstone lTombstone{};
+    lTombstone.m_Start = ReadLittleEndian<std::int64_t>(lEntry.data());
+    lTombstone.m_End = ReadLittleEndian<std::int64_t>(lEntry.data() + 8);
+    lTombstone.m_Levels = ReadLittleEndian<std::uint8_t>(lEntry.data() + 16);
+    lRet.push_back(lTombstone);
+  }
+  return lRet;
+}
+
+void RemoveBinaryTombstones(const std::string &pFilePath, std::size_t pCount) {
+  std::lock_guard<std::mutex> lLock(GetTombstonesMutex());
+  auto lTombstones{LoadBinaryTombstones(pFilePath)};
+  if (lTombstones.size() <= pCount) {
+    std::error_code lError{};
+    std::filesystem::remove(GetBinaryTombstoneFilename(pFilePath), lError);
+  } else {
+    lTombstones.erase(lTombstones.begin(),
+                      lTombstones.begin() +
+                          static_cast<std::ptrdiff_t>(pCount));
+    WriteTombstones(pFilePath, lTombstones, false);
+  }
+}
+
+void RenameBinaryTombstones(const std::string &pFilePath,
+                            const std::string &pNewFilePath) {
+  std::lock_guard<std::mutex> lLock(GetTombstonesMutex());
+  std::error_code lError{};
+  std::filesystem::rename(GetBinaryTombstoneFilename(pFilePath),
+                          GetBinaryTombstoneFilename(pNewFilePath), lError);
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,188 @@
+/**
+ * @file DeferredArgs.cpp
+ * @brief Binary capture of log arguments formatted later
+ * @details Uses fmt dynamic argument store, interned formats are kept in a
+ * node based set so that their address never changes
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "DeferredArgs.h"
+
+#include <fmt/args.h>
+
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Read a fixed size value stored in little-endian order from the
+ * captured arguments
+ *
+ * @tparam T Type of the value
+ * @param pArgs Captured arguments
+ * @param pOffset Read position, moved after the value
+ * @param pValue Value read
+ * @return false if the arguments are truncated
+ */
+template <typename T>
+bool ReadValue(std::string_view pArgs, std::size_t &pOffset, T &pValue) {
+  using Bits = DeferredArgBits<sizeof(T)>;
+  bool lRet{false};
+  if (pOffset + sizeof(T) <= pArgs.size()) {
+    Bits lBits{0};
+    for (std::size_t lByte = sizeof(T); lByte > 0; --lByte) {
+      lBits = static_cast<Bits>(
+          (lBits << 8U) |
+          static_cast<unsigned char>(pArgs[pOffset + lByte - 1]));
+    }
+    std::memcpy(&pValue, &lBits, sizeof(T));
+    pOffset += sizeof(T);
+    lRet = true;
+  }
+  return lRet;
+}
+
+/**
+ * @brief Read one tagged argument and add it to the store
+ *
+ * @param pArgs Captured arguments
+ * @param pOffset Read position, moved after the argument
+ * @param pStore Store receiving the argument, strings are not copied
+ * @return false if the arguments are corrupted
+ */
+bool ReadArg(std::string_view pArgs, std::size_t &pOffset,
+             fmt::dynamic_format_arg_store<fmt::format_context> &pStore) {
+  bool lRet{false};
+  const auto lType{static_cast<DeferredArgType>(pArgs[pOffset++])};
+  switch (lType) {
+    case DeferredArgType::Int: {
+      std::int64_t lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue);
+      break;
+    }
+    case DeferredArgType::UInt: {
+      std::uint64_t lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue);
+      break;
+    }
+    case DeferredArgType::Float: {
+      float lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue);
+      break;
+    }
+    case DeferredArgType::Double: {
+      double lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue);
+      break;
+    }
+    case DeferredArgType::Bool: {
+      std::uint8_t lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue != 0);
+      break;
+    }
+    case DeferredArgType::Char: {
+      char lValue{0};
+      lRet = ReadValue(pArgs, pOffset, lValue);
+      pStore.push_back(lValue);
+      break;
+    }
+    case DeferredArgType::String: {
+      std::uint32_t lLength{0};
+      lRet = ReadValue(pArgs, pOffset, lLength) &&
+             pOffset + lLength <= pArgs.size();
+      if (lRet) {
+        pStore.push_back(fmt::string_view{pArgs.data() + pOffset, lLength});
+        pOffset += lLength;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return lRet;
+}
+
+/**
+ * @brief Get the format strings interned by the process
+ *
+ * @return The set, its strings are never erased
+ */
+std::unordered_set<std::string> &GetInternedFormats() {
+  static std::unordered_set<std::string> sFormats{};
+  return sFormats;
+}
+
+/**
+ * @brief Get the mutex protecting the interned format strings
+ *
+ * @return The mutex
+ */
+std::mutex &GetInternedFormatsMutex() {
+  static std::mutex sMutex{};
+  return sMutex;
+}
+
+}  // namespace
+
+std::string_view InternFormat(std::string_view pFormat) {
+  // Formats seen by the thread, by address. The content is compared as a
+  // runtime format string may be freed and another one built at its address.
+  thread_local std::unordered_map<const char *, std::string_view> lSeen{};
+  const auto lSeenFormat{lSeen.find(pFormat.data())};
+  if (lSeenFormat != lSeen.end() && lSeenFormat->second == pFormat) {
+    return lSeenFormat->second;
+  }
+
+  std::string_view lRet{};
+  {
+    std::lock_guard<std::mutex> lLock(GetInternedFormatsMutex());
+    auto &lFormats{GetInternedFormats()};
+    auto lFormat{lFormats.find(std::string{pFormat})};
+    if (lFormat == lFormats.end() && lFormats.size() < c_MaxInternedFormats) {
+      lFormat = lFormats.emplace(pFormat).first;
+    }
+    if (lFormat != lFormats.end()) {
+      lRet = *lFormat;
+    }
+  }
+
+  if (lRet.data() != nullptr) {
+    // Runtime formats at ever changing addresses must not grow the cache
+    if (lSeen.size() >= c_MaxInternedFormats) {
+      lSeen.clear();
+    }
+    lSeen[pFormat.data()] = lRet;
+  }
+  return lRet;
+}
+
+bool FormatDeferredArgs(std::string_view pFormat, std::string_view pArgs,
+                        fmt::memory_buffer &pOut) {
+  // Reused by the thread to avoid an allocation per message
+  thread_local fmt::dynamic_format_arg_store<fmt::format_context> lStore{};
+  lStore.clear();
+
+  bool lRet{true};
+  std::size_t lOffset{0};
+  while (lRet && lOffset < pArgs.size()) {
+    lRet = ReadArg(pArgs, lOffset, lStore);
+  }
+
+  if (lRet) {
+    fmt::vformat_to(std::back_inserter(pOut),
+                    fmt::string_view{pFormat.data(), pFormat.size()}, lStore);
+  }
+  return lRet;
+}
+
+}  // namespace Stroalgo::Log
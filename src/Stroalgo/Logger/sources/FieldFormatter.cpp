@@ -0,0 +1,204 @@
+/**
+ * @file FieldFormatter.cpp
+ * @brief spdlog formatter sharing the rendered fields between sinks
+ * @details Uses spdlog formatting helpers
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "FieldFormatter.h"
+
+#include <spdlog/details/fmt_helper.h>
+#include <spdlog/details/os.h>
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <string_view>
+#include <utility>
+
+#include "LogClock.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Timestamp fields rendered for the last message of the thread
+ * @struct RenderedTime
+ */
+struct RenderedTime {
+  /**
+   * @brief Time rendered
+   */
+  spdlog::log_clock::time_point m_Time{};
+
+  /**
+   * @brief Second of the rendered date, the date only changes with it
+   */
+  std::time_t m_Second{-1};
+
+  /**
+   * @brief "YYYY-MM-DD HH:MM:SS.ffffff"
+   */
+  std::array<char, 26> m_DateTime{};
+
+  /**
+   * @brief UTC offset "+HH:MM"
+   */
+  std::array<char, 6> m_Offset{};
+};
+
+/**
+ * @brief Render the timestamp of a message, every sink of the logger writing
+ * the same message on the same thread reuses it. The date and the seconds
+ * are rendered once per second, only the sub-second digits are written for
+ * each message.
+ *
+ * @param pTime Time of the message
+ * @return The rendered fields
+ */
+const RenderedTime &RenderTime(spdlog::log_clock::time_point pTime) {
+  thread_local RenderedTime lRendered{};
+  if (pTime == lRendered.m_Time && lRendered.m_Second != -1) {
+    return lRendered;
+  }
+
+  const std::time_t lSecond{spdlog::log_clock::to_time_t(pTime)};
+  if (lSecond != lRendered.m_Second) {
+    char *lDest{lRendered.m_DateTime.data()};
+    int lOffset{FormatLocalDateTime(lSecond, lDest)};
+    lDest[c_LocalDateTimeSize] = '.';
+
+    lRendered.m_Offset[0] = lOffset < 0 ? '-' : '+';
+    lOffset = lOffset < 0 ? -lOffset : lOffset;
+    WriteDigits(lRendered.m_Offset.data() + 1, lOffset / 60, 2);
+    lRendered.m_Offset[3] = ':';
+    WriteDigits(lRendered.m_Offset.data() + 4, lOffset % 60, 2);
+    lRendered.m_Second = lSecond;
+  }
+
+  const auto lSinceEpoch{pTime.time_since_epoch()};
+  const auto lMicroseconds{
+      std::chrono::duration_cast<std::chrono::microseconds>(lSinceEpoch) -
+      std::chrono::duration_cast<std::chrono::seconds>(lSinceEpoch)};
+  WriteDigits(lRendered.m_DateTime.data() + 20, lMicroseconds.count(), 6);
+  lRendered.m_Time = pTime;
+  return lRendered;
+}
+
+/**
+ * @brief Append a string view to a buffer
+ *
+ * @param pValue String to append
+ * @param pDest Destination buffer
+ */
+void Append(std::string_view pValue, spdlog::memory_buf_t &pDest) {
+  pDest.append(pValue.data(), pValue.data() + pValue.size());
+}
+
+}  // namespace
+
+FieldFormatter::FieldFormatter(LogFraming pFraming, const LogFields &pFields,
+                               std::shared_ptr<ByteCounter> pWrittenBytes)
+    : m_Framing(pFraming),
+      m_Fields(pFields),
+      m_WrittenBytes(std::move(pWrittenBytes)) {}
+
+void FieldFormatter::format(const spdlog::details::log_msg &pMsg,
+                            spdlog::memory_buf_t &pDest) {
+  const std::size_t lStart{pDest.size()};
+  if (m_Framing == LogFraming::Json) {
+    FormatJson(pMsg, pDest);
+  } else {
+    FormatText(pMsg, pDest);
+  }
+  Append(spdlog::details::os::default_eol, pDest);
+  if (m_WrittenBytes != nullptr) {
+    m_WrittenBytes->fetch_add(pDest.size() - lStart,
+                              std::memory_order_relaxed);
+  }
+}
+
+std::unique_ptr<spdlog::formatter> FieldFormatter::clone() const {
+  return std::make_unique<FieldFormatter>(m_Framing, m_Fields, m_WrittenBytes);
+}
+
+void FieldFormatter::FormatText(const spdlog::details::log_msg &pMsg,
+                                spdlog::memory_buf_t &pDest) const {
+  pMsg.color_range_start = pDest.size();
+  if (m_Fields.m_Time) {
+    const RenderedTime &lTime{RenderTime(pMsg.time)};
+    pDest.push_back('[');
+    // Milliseconds only
+    Append(std::string_view{lTime.m_DateTime.data(), 23}, pDest);
+    Append("] ", pDest);
+  }
+  if (m_Fields.m_Name) {
+    pDest.push_back('[');
+    spdlog::details::fmt_helper::append_string_view(pMsg.logger_name, pDest);
+    Append("] ", pDest);
+  }
+  if (m_Fields.m_Level) {
+    pDest.push_back('[');
+    spdlog::details::fmt_helper::append_string_view(
+        spdlog::level::to_string_view(pMsg.level), pDest);
+    Append("] ", pDest);
+  }
+  if (m_Fields.m_Process) {
+    pDest.push_back('[');
+    spdlog::details::fmt_helper::append_int(spdlog::details::os::pid(), pDest);
+    Append("] ", pDest);
+  }
+  if (m_Fields.m_Thread) {
+    pDest.push_back('[');
+    spdlog::details::fmt_helper::append_int(pMsg.thread_id, pDest);
+    Append("] ", pDest);
+  }
+  Append("---> ", pDest);
+  AppendTextPayload(pDest,
+                    std::string_view{pMsg.payload.data(), pMsg.payload.size()},
+                    HasStructuredFields(pMsg));
+  pMsg.color_range_end = pDest.size();
+}
+
+void FieldFormatter::FormatJson(const spdlog::details::log_msg &pMsg,
+                                spdlog::memory_buf_t &pDest) const {
+  pDest.push_back('{');
+  if (m_Fields.m_Time) {
+    const RenderedTime &lTime{RenderTime(pMsg.time)};
+    Append("\"time\": \"", pDest);
+    Append(std::string_view{lTime.m_DateTime.data(), lTime.m_DateTime.size()},
+           pDest);
+    Append(std::string_view{lTime.m_Offset.data(), lTime.m_Offset.size()},
+           pDest);
+    Append("\", ", pDest);
+  }
+  if (m_Fields.m_Name) {
+    Append("\"name\": \"", pDest);
+    spdlog::details::fmt_helper::append_string_view(pMsg.logger_name, pDest);
+    Append("\", ", pDest);
+  }
+  if (m_Fields.m_Level) {
+    Append("\"level\": \"", pDest);
+    spdlog::details::fmt_helper::append_string_view(
+        spdlog::level::to_string_view(pMsg.level), pDest);
+    Append("\", ", pDest);
+  }
+  if (m_Fields.m_Process) {
+    Append("\"process\": ", pDest);
+    spdlog::details::fmt_helper::append_int(spdlog::details::os::pid(), pDest);
+    Append(", ", pDest);
+  }
+  if (m_Fields.m_Thread) {
+    Append("\"thread\": ", pDest);
+    spdlog::details::fmt_helper::append_int(pMsg.thread_id, pDest);
+    Append(", ", pDest);
+  }
+  AppendJsonPayload(pDest,
+                    std::string_view{pMsg.payload.data(), pMsg.payload.size()},
+                    HasStructuredFields(pMsg));
+  Append("},", pDest);
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,619 @@
+/**
+ * @file FlightRecorder.cpp
+ * @brief In-memory ring keeping the last records of a module
+ * @details Uses POSIX mmap and sigaction
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "FlightRecorder.h"
+
+#include <fcntl.h>
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <system_error>
+
+#include "BinaryLogFormat.h"
+#include "ProcessIdentity.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Header of a ring image, shared with the signal handler and with the
+ * recovery of a crashed process
+ * @struct FlightRecorderHeader
+ */
+struct FlightRecorderHeader {
+  /**
+   * @brief c_FlightRecorderMagic, written last
+   */
+  std::array<char, 4> m_Magic{};
+
+  /**
+   * @brief c_FlightRecorderVersion
+   */
+  std::uint16_t m_Version{0};
+
+  /**
+   * @brief Bytes of m_Name used
+   */
+  std::uint16_t m_NameSize{0};
+
+  /**
+   * @brief Registration id of the module
+   */
+  std::uint32_t m_ModuleId{0};
+
+  /**
+   * @brief Process writing the ring
+   */
+  std::uint32_t m_ProcessId{0};
+
+  /**
+   * @brief Start time of the process writing the ring, 0 if unknown
+   */
+  std::uint64_t m_StartTime{0};
+
+  /**
+   * @brief Bytes of data following the header
+   */
+  std::uint64_t m_Capacity{0};
+
+  /**
+   * @brief Position following the last complete record
+   */
+  std::atomic<std::uint64_t> m_Head{0};
+
+  /**
+   * @brief Position of the oldest record kept
+   */
+  std::atomic<std::uint64_t> m_Tail{0};
+
+  /**
+   * @brief Position following the last record dumped
+   */
+  std::atomic<std::uint64_t> m_Dumped{0};
+
+  /**
+   * @brief Name of the module, not terminated
+   */
+  std::array<char, c_FlightRecorderNameSize> m_Name{};
+};
+
+static_assert(sizeof(FlightRecorderHeader) <= c_FlightRecorderHeaderSize,
+              "The ring header does not fit its reserved size");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Ring positions are read by a signal handler and by another "
+              "process");
+
+namespace {
+
+/**
+ * @brief Maximum number of recorders written by the fatal signal handler
+ */
+constexpr std::size_t c_MaxSignaledRecorders{1024};
+
+/**
+ * @brief Signals writing the ring images before the process dies
+ */
+constexpr std::array<int, 5> c_FatalSignals{SIGSEGV, SIGBUS, SIGFPE, SIGILL,
+                                            SIGABRT};
+
+/**
+ * @brief Get the recorders written by the fatal signal handler
+ *
+ * @return Table of recorders, null slots are free
+ */
+std::array<std::atomic<FlightRecorder *>, c_MaxSignaledRecorders> &
+SignaledRecorders() {
+  static std::array<std::atomic<FlightRecorder *>, c_MaxSignaledRecorders>
+      lRecorders{};
+  return lRecorders;
+}
+
+/**
+ * @brief Get the actions replaced by the fatal signal handler
+ *
+ * @return Previous action of each of c_FatalSignals
+ */
+std::array<struct sigaction, c_FatalSignals.size()> &PreviousActions() {
+  static std::array<struct sigaction, c_FatalSignals.size()> lActions{};
+  return lActions;
+}
+
+/**
+ * @brief Write every ring image then let the previous action kill the
+ * process
+ *
+ * @param pSignal The fatal signal
+ */
+void HandleFatalSignal(int pSignal) {
+  for (const auto &lSlot : SignaledRecorders()) {
+    const FlightRecorder *lRecorder{lSlot.load(std::memory_order_acquire)};
+    if (lRecorder != nullptr) {
+      lRecorder->WriteCrashImage();
+    }
+  }
+  for (std::size_t lIndex = 0; lIndex < c_FatalSignals.size(); ++lIndex) {
+    if (c_FatalSignals[lIndex] == pSignal) {
+      ::sigaction(pSignal, &PreviousActions()[lIndex], nullptr);
+    }
+  }
+  ::raise(pSignal);
+}
+
+/**
+ * @brief Install the fatal signal handler once
+ *
+ */
+void InstallFatalSignalHandler() {
+  static std::once_flag lInstalled{};
+  std::call_once(lInstalled, []() noexcept {
+    struct sigaction lAction {};
+    lAction.sa_handler = HandleFatalSignal;
+    sigemptyset(&lAction.sa_mask);
+    for (std::size_t lIndex = 0; lIndex < c_FatalSignals.size(); ++lIndex) {
+      ::sigaction(c_FatalSignals[lIndex], &lAction,
+                  &PreviousActions()[lIndex]);
+    }
+  });
+}
+
+/**
+ * @brief Get the rank of the next recorder created by the process
+ *
+ * @return The rank, from 0
+ */
+std::uint32_t NextImageRank() {
+  static std::atomic<std::uint32_t> sRank{0};
+  return sRank.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Read the process owning a ring image from its name
+ *
+ * @param pOwner Part of the name between the module and the extension,
+ * "<pid>.<start>.<n>"
+ * @param pProcessId Receives the process id
+ * @param pStartTime Receives the start time of the process
+ * @return false if the name is not the one of a ring image
+ */
+bool ParseImageOwner(std::string_view pOwner, std::uint32_t &pProcessId,
+                     std::uint64_t &pStartTime) {
+  const char *lEnd{pOwner.data() + pOwner.size()};
+  auto lResult{std::from_chars(pOwner.data(), lEnd, pProcessId)};
+  if (lResult.ec != std::errc{} || lResult.ptr == lEnd ||
+      *lResult.ptr != '.') {
+    return false;
+  }
+  lResult = std::from_chars(lResult.ptr + 1, lEnd, pStartTime);
+  if (lResult.ec != std::errc{} || lResult.ptr == lEnd ||
+      *lResult.ptr != '.') {
+    return false;
+  }
+  std::uint32_t lRank{0};
+  lResult = std::from_chars(lResult.ptr + 1, lEnd, lRank);
+  return lResult.ec == std::errc{} && lResult.ptr == lEnd;
+}
+
+/**
+ * @brief Copy bytes into a ring
+ *
+ * @param pData Data of the ring
+ * @param pCapacity Bytes of data
+ * @param pPosition Position of the first byte
+ * @param pSource Bytes to copy, at most pCapacity
+ * @param pSize Number of bytes
+ */
+void CopyIn(char *pData, std::uint64_t pCapacity, std::uint64_t pPosition,
+            const char *pSource, std::size_t pSize) {
+  const std::uint64_t lOffset{pPosition % pCapacity};
+  const std::size_t lFirst{
+      std::min<std::size_t>(pSize, pCapacity - lOffset)};
+  std::memcpy(pData + lOffset, pSource, lFirst);
+  std::memcpy(pData, pSource + lFirst, pSize - lFirst);
+}
+
+/**
+ * @brief Copy bytes out of a ring
+ *
+ * @param pData Data of the ring
+ * @param pCapacity Bytes of data
+ * @param pPosition Position of the first byte
+ * @param pDestination Destination of pSize bytes, at most pCapacity
+ * @param pSize Number of bytes
+ */
+void CopyOut(const char *pData, std::uint64_t pCapacity,
+             std::uint64_t pPosition, char *pDestination, std::size_t pSize) {
+  const std::uint64_t lOffset{pPosition % pCapacity};
+  const std::size_t lFirst{
+      std::min<std::size_t>(pSize, pCapacity - lOffset)};
+  std::memcpy(pDestination, pData + lOffset, lFirst);
+  std::memcpy(pDestination + lFirst, pData, pSize - lFirst);
+}
+
+/**
+ * @brief Get the size of the record entry at a position of a ring
+ *
+ * @param pData Data of the ring
+ * @param pCapacity Bytes of data
+ * @param pPosition Position of the entry
+ * @return Bytes of the entry, its payload included
+ */
+std::uint64_t RecordSizeAt(const char *pData, std::uint64_t pCapacity,
+                           std::uint64_t pPosition) {
+  std::array<char, sizeof(std::uint32_t)> lLength{};
+  CopyOut(pData, pCapacity,
+          pPosition + c_BinaryRecordHeaderSize - sizeof(std::uint32_t),
+          lLength.data(), lLength.size());
+  return c_BinaryRecordHeaderSize +
+         std::uint64_t{ReadLittleEndian<std::uint32_t>(lLength.data())};
+}
+
+/**
+ * @brief Append the records of a ring between two positions to a binary log
+ * file
+ *
+ * @param pHeader Header of the ring
+ * @param pFrom Position of the first record
+ * @param pTo Position following the last record
+ * @param pOutputFilename Binary log file, its header is written if it is
+ * empty
+ * @param pRecords Number of records appended
+ * @return false if the file cannot be written
+ */
+bool AppendRecords(const FlightRecorderHeader &pHeader, std::uint64_t pFrom,
+                   std::uint64_t pTo, const std::string &pOutputFilename,
+                   std::size_t &pRecords) {
+  const char *lData{reinterpret_cast<const char *>(&pHeader) +
+                    c_FlightRecorderHeaderSize};
+  const std::uint64_t lCapacity{pHeader.m_Capacity};
+  spdlog::memory_buf_t lBuffer{};
+  std::error_code lError{};
+  const auto lSize{std::filesystem::file_size(pOutputFilename, lError)};
+  if (lError || lSize == 0) {
+    const std::string_view lName{
+        pHeader.m_Name.data(),
+        std::min<std::size_t>(pHeader.m_NameSize, pHeader.m_Name.size())};
+    AppendBinaryHeader(lBuffer, pHeader.m_ModuleId, lName);
+  }
+
+  // A record cut by the crash of the writer ends the data
+  pRecords = 0;
+  std::uint64_t lPosition{pFrom};
+  while (pTo - lPosition >= c_BinaryRecordHeaderSize) {
+    const std::uint64_t lRecordSize{
+        RecordSizeAt(lData, lCapacity, lPosition)};
+    if (lRecordSize > pTo - lPosition) {
+      break;
+    }
+    const std::size_t lOffset{lBuffer.size()};
+    lBuffer.resize(lOffset + lRecordSize);
+    CopyOut(lData, lCapacity, lPosition, lBuffer.data() + lOffset,
+            lRecordSize);
+    if (lBuffer[lOffset] != static_cast<char>(BinaryEntryKind::Record)) {
+      lBuffer.resize(lOffset);
+      break;
+    }
+    lPosition += lRecordSize;
+    ++pRecords;
+  }
+  if (pRecords == 0) {
+    return true;
+  }
+
+  spdlog::details::os::create_dir(
+      spdlog::details::os::dir_name(pOutputFilename));
+  std::ofstream lOutput{pOutputFilename, std::ios::binary | std::ios::app};
+  lOutput.write(lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+  return lOutput.good();
+}
+
+}  // namespace
+
+FlightRecorder::FlightRecorder(const std::string &pImageBaseFilename,
+                               const std::string &pDumpBaseFilename,
+                               const std::string &pModuleName,
+                               std::uint32_t pModuleId,
+                               const FlightRecorderOptions &pOptions)
+    : m_ProcessId(static_cast<std::uint32_t>(::getpid())),
+      m_StartTime(GetProcessStartTime(m_ProcessId)),
+      m_ImageFilename(GetFlightImageFilename(pImageBaseFilename, m_ProcessId,
+                                             m_StartTime, NextImageRank())),
+      m_DumpBaseFilename(pDumpBaseFilename),
+      m_ModuleName(pModuleName),
+      m_ModuleId(pModuleId),
+      m_Options(pOptions) {
+  m_Options.m_Size = std::max(m_Options.m_Size, c_MinFlightRecorderSize);
+  spdlog::details::os::create_dir(
+      spdlog::details::os::dir_name(m_ImageFilename));
+  RecoverImages(pImageBaseFilename);
+  Map();
+
+  if (m_Options.m_DumpOnFatalSignal) {
+    auto &lRecorders{SignaledRecorders()};
+    for (std::size_t lSlot = 0; lSlot < lRecorders.size(); ++lSlot) {
+      FlightRecorder *lFree{nullptr};
+      if (lRecorders[lSlot].compare_exchange_strong(
+              lFree, this, std::memory_order_acq_rel)) {
+        m_SignalSlot = static_cast<int>(lSlot);
+        break;
+      }
+    }
+    InstallFatalSignalHandler();
+  }
+}
+
+FlightRecorder::~FlightRecorder() {
+  if (m_SignalSlot >= 0) {
+    SignaledRecorders()[static_cast<std::size_t>(m_SignalSlot)].store(
+        nullptr, std::memory_order_release);
+  }
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, c_FlightRecorderHeaderSize + m_Options.m_Size);
+  }
+  if (m_Options.m_FileBacked) {
+    std::error_code lError{};
+    std::filesystem::remove(m_ImageFilename, lError);
+  }
+}
+
+void FlightRecorder::Record(spdlog::level::level_enum pLevel,
+                            spdlog::log_clock::time_point pTime,
+                            std::size_t pThreadId, std::string_view pPayload,
+                            bool pStructured) {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  Append(pLevel, pTime, pThreadId, pPayload, pStructured);
+}
+
+std::size_t FlightRecorder::Dump() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  return DumpLocked();
+}
+
+void FlightRecorder::WriteCrashImage() const noexcept {
+  // A file backed ring is already its image
+  if (m_Mapping == nullptr || m_Options.m_FileBacked) {
+    return;
+  }
+  const int lFile{::open(m_ImageFilename.c_str(),
+                         O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+  if (lFile < 0) {
+    return;
+  }
+  const char *lData{m_Mapping};
+  std::size_t lLeft{c_FlightRecorderHeaderSize + m_Options.m_Size};
+  while (lLeft > 0) {
+    const ::ssize_t lWritten{::write(lFile, lData, lLeft)};
+    if (lWritten <= 0) {
+      break;
+    }
+    lData += lWritten;
+    lLeft -= static_cast<std::size_t>(lWritten);
+  }
+  ::close(lFile);
+}
+
+std::string FlightRecorder::GetDumpFilename() const {
+  const std::tm lDate{spdlog::details::os::localtime(
+      spdlog::log_clock::to_time_t(spdlog::log_clock::now()))};
+  return spdlog::sinks::daily_filename_calculator::calc_filename(
+      m_DumpBaseFilename, lDate);
+}
+
+void FlightRecorder::sink_it_(const spdlog::details::log_msg &pMsg) {
+  Append(pMsg.level, pMsg.time, pMsg.thread_id,
+         std::string_view{pMsg.payload.data(), pMsg.payload.size()},
+         HasStructuredFields(pMsg));
+}
+
+void FlightRecorder::Append(spdlog::level::level_enum pLevel,
+                            spdlog::log_clock::time_point pTime,
+                            std::size_t pThreadId, std::string_view pPayload,
+                            bool pStructured) {
+  m_Buffer.clear();
+  AppendBinaryRecord(m_Buffer, ToBinaryTime(pTime), pLevel, m_ModuleId,
+                     pThreadId, GetTextFormatId(pStructured), pPayload);
+
+  // A record larger than the ring is not kept
+  const std::uint64_t lCapacity{m_Header->m_Capacity};
+  if (m_Buffer.size() <= lCapacity) {
+    char *lData{m_Mapping + c_FlightRecorderHeaderSize};
+    const std::uint64_t lHead{m_Header->m_Head.load(std::memory_order_relaxed)};
+    std::uint64_t lTail{m_Header->m_Tail.load(std::memory_order_relaxed)};
+    while (lHead + m_Buffer.size() - lTail > lCapacity) {
+      lTail += RecordSizeAt(lData, lCapacity, lTail);
+    }
+    m_Header->m_Tail.store(lTail, std::memory_order_relaxed);
+
+    // Readers of a crashed image never see tail behind overwritten bytes
+    std::atomic_thread_fence(std::memory_order_release);
+    CopyIn(lData, lCapacity, lHead, m_Buffer.data(), m_Buffer.size());
+    m_Header->m_Head.store(lHead + m_Buffer.size(), std::memory_order_release);
+    m_Recorded.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // No record has the off level, an off trigger never dumps
+  if (pLevel >= m_Options.m_TriggerLevel) {
+    DumpLocked();
+  }
+}
+
+std::size_t FlightRecorder::DumpLocked() {
+  const std::uint64_t lHead{m_Header->m_Head.load(std::memory_order_relaxed)};
+  const std::uint64_t lFrom{
+      std::max(m_Header->m_Tail.load(std::memory_order_relaxed),
+               m_Header->m_Dumped.load(std::memory_order_relaxed))};
+  std::size_t lRet{0};
+  if (lFrom == lHead ||
+      !AppendRecords(*m_Header, lFrom, lHead, GetDumpFilename(), lRet)) {
+    return 0;
+  }
+  m_Header->m_Dumped.store(lHead, std::memory_order_release);
+  m_Dumps.fetch_add(1, std::memory_order_relaxed);
+  return lRet;
+}
+
+void FlightRecorder::RecoverImages(const std::string &pImageBaseFilename) {
+  const std::filesystem::path lBase{pImageBaseFilename};
+  const std::string lPrefix{lBase.stem().string() + "."};
+  const std::string lExtension{lBase.extension().string()};
+  const std::string lOwnName{
+      std::filesystem::path{m_ImageFilename}.filename().string()};
+  std::error_code lError{};
+  std::filesystem::directory_iterator lFiles{
+      lBase.parent_path().empty() ? std::filesystem::path{"."}
+                                  : lBase.parent_path(),
+      lError};
+  for (const auto &lFile : lFiles) {
+    const std::string lName{lFile.path().filename().string()};
+    if (lName.size() <= lPrefix.size() + lExtension.size() ||
+        lName.compare(0, lPrefix.size(), lPrefix) != 0 ||
+        lName.compare(lName.size() - lExtension.size(), lExtension.size(),
+                      lExtension) != 0) {
+      continue;
+    }
+    std::uint32_t lProcessId{0};
+    std::uint64_t lStartTime{0};
+    if (!ParseImageOwner(
+            std::string_view{lName}.substr(
+                lPrefix.size(),
+                lName.size() - lPrefix.size() - lExtension.size()),
+            lProcessId, lStartTime)) {
+      continue;
+    }
+
+    // The rank makes the own name free in this process, an image having it
+    // was left by a previous process with the same id and an unknown start
+    if (lName != lOwnName && !IsProcessGone(lProcessId, lStartTime)) {
+      continue;
+    }
+    if (ExtractFlightRecording(lFile.path().string(), GetDumpFilename(), true)
+            .value_or(0) > 0) {
+      m_Dumps.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::filesystem::remove(lFile.path(), lError);
+  }
+}
+
+void FlightRecorder::Map() {
+  const std::size_t lSize{c_FlightRecorderHeaderSize + m_Options.m_Size};
+  void *lMapping{MAP_FAILED};
+  if (m_Options.m_FileBacked) {
+    // The image of another recorder is never replaced
+    const int lFile{::open(m_ImageFilename.c_str(),
+                           O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644)};
+    if (lFile < 0) {
+      spdlog::throw_spdlog_ex("Failed creating file " + m_ImageFilename,
+                              errno);
+    }
+    if (::ftruncate(lFile, static_cast<::off_t>(lSize)) == 0) {
+      lMapping = ::mmap(nullptr, lSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        lFile, 0);
+    }
+    const int lError{errno};
+    ::close(lFile);
+    if (lMapping == MAP_FAILED) {
+      spdlog::throw_spdlog_ex("Failed mapping file " + m_ImageFilename,
+                              lError);
+    }
+  } else {
+    lMapping = ::mmap(nullptr, lSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (lMapping == MAP_FAILED) {
+      spdlog::throw_spdlog_ex("Failed mapping flight recorder of " +
+                                  m_ModuleName,
+                              errno);
+    }
+  }
+  m_Mapping = static_cast<char *>(lMapping);
+
+  m_Header = new (m_Mapping) FlightRecorderHeader{};
+  m_Header->m_Version = c_FlightRecorderVersion;
+  m_Header->m_NameSize = static_cast<std::uint16_t>(
+      std::min(m_ModuleName.size(), m_Header->m_Name.size()));
+  std::copy_n(m_ModuleName.data(), m_Header->m_NameSize,
+              m_Header->m_Name.data());
+  m_Header->m_ModuleId = m_ModuleId;
+  m_Header->m_ProcessId = m_ProcessId;
+  m_Header->m_StartTime = m_StartTime;
+  m_Header->m_Capacity = m_Options.m_Size;
+
+  // An image is only valid once its header is complete
+  std::atomic_thread_fence(std::memory_order_release);
+  std::copy(c_FlightRecorderMagic.begin(), c_FlightRecorderMagic.end(),
+            m_Header->m_Magic.begin());
+}
+
+std::string GetFlightImageFilename(const std::string &pImageBaseFilename,
+                                   std::uint32_t pProcessId,
+                                   std::uint64_t pStartTime,
+                                   std::uint32_t pRank) {
+  const std::filesystem::path lBase{pImageBaseFilename};
+  std::filesystem::path lRet{lBase.parent_path() / lBase.stem()};
+  lRet += "." + std::to_string(pProcessId) + "." +
+          std::to_string(pStartTime) + "." + std::to_string(pRank);
+  lRet += lBase.extension();
+  return lRet.string();
+}
+
+std::optional<std::size_t> ExtractFlightRecording(
+    const std::string &pImageFilename, const std::string &pOutputFilename,
+    bool pUndumpedOnly) {
+  const int lFile{::open(pImageFilename.c_str(), O_RDONLY | O_CLOEXEC)};
+  if (lFile < 0) {
+    return std::nullopt;
+  }
+  struct stat lStat {};
+  void *lMapping{MAP_FAILED};
+  const bool lLargeEnough{
+      ::fstat(lFile, &lStat) == 0 &&
+      static_cast<std::size_t>(lStat.st_size) > c_FlightRecorderHeaderSize};
+  const auto lSize{static_cast<std::size_t>(lStat.st_size)};
+  if (lLargeEnough) {
+    lMapping = ::mmap(nullptr, lSize, PROT_READ, MAP_PRIVATE, lFile, 0);
+  }
+  ::close(lFile);
+  if (lMapping == MAP_FAILED) {
+    return std::nullopt;
+  }
+
+  // Positions are checked, the image may come from a dying process
+  std::optional<std::size_t> lRet{};
+  const auto *lHeader{static_cast<const FlightRecorderHeader *>(lMapping)};
+  const std::uint64_t lHead{lHeader->m_Head.load(std::memory_order_acquire)};
+  const std::uint64_t lTail{lHeader->m_Tail.load(std::memory_order_relaxed)};
+  const std::uint64_t lDumped{
+      lHeader->m_Dumped.load(std::memory_order_relaxed)};
+  if (std::string_view{lHeader->m_Magic.data(), lHeader->m_Magic.size()} ==
+          c_FlightRecorderMagic &&
+      lHeader->m_Version == c_FlightRecorderVersion &&
+      lHeader->m_Capacity == lSize - c_FlightRecorderHeaderSize &&
+      lTail <= lHead && lHead - lTail <= lHeader->m_Capacity) {
+    const std::uint64_t lFrom{
+        pUndumpedOnly ? std::clamp(lDumped, lTail, lHead) : lTail};
+    std::size_t lRecords{0};
+    if (AppendRecords(*lHeader, lFrom, lHead, pOutputFilename, lRecords)) {
+      lRet = lRecords;
+    }
+  }
+  ::munmap(lMapping, lSize);
+  return lRet;
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,175 @@
+/**
+ * @file FlushSink.cpp
+ * @brief Flush policy of a module logger
+ * @details Uses POSIX fdatasync for group commit
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "FlushSink.h"
+
+#include <fcntl.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <string>
+
+#include "BinaryFileSink.h"
+#ifdef STROALGO_LOG_MAPPED_FILES
+#include "MappedFileSink.h"
+#endif
+#ifdef STROALGO_LOG_IO_URING
+#include "UringFileSink.h"
+#endif
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Write the data of a file to disk
+ * @details Any descriptor on the file gives access to its dirty pages
+ *
+ * @param pFilePath Path of the file
+ */
+void SyncFile(const std::string &pFilePath) {
+#ifdef _WIN32
+  const int lFile{::_open(pFilePath.c_str(), _O_WRONLY | _O_BINARY)};
+  if (lFile >= 0) {
+    ::_commit(lFile);
+    ::_close(lFile);
+  }
+#else
+  const int lFile{::open(pFilePath.c_str(), O_RDONLY | O_CLOEXEC)};
+  if (lFile >= 0) {
+    ::fdatasync(lFile);
+    ::close(lFile);
+  }
+#endif
+}
+
+}  // namespace
+
+FlushSink::FlushSink(const FlushPolicy &pPolicy) {
+  SetPolicy(pPolicy);
+  m_LastFlush.store(Now(), std::memory_order_relaxed);
+}
+
+void FlushSink::SetLogger(spdlog::logger *pLogger) {
+  m_Logger.store(pLogger, std::memory_order_release);
+}
+
+void FlushSink::SetPolicy(const FlushPolicy &pPolicy) {
+  m_MaxBytes.store(pPolicy.m_MaxBytes, std::memory_order_relaxed);
+  m_MaxRecords.store(pPolicy.m_MaxRecords, std::memory_order_relaxed);
+  m_IntervalNs.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(pPolicy.m_Interval)
+          .count(),
+      std::memory_order_relaxed);
+  m_Level.store(pPolicy.m_Level, std::memory_order_relaxed);
+  m_Sync.store(pPolicy.m_Sync, std::memory_order_relaxed);
+}
+
+FlushPolicy FlushSink::GetPolicy() const {
+  FlushPolicy lRet{};
+  lRet.m_MaxBytes = m_MaxBytes.load(std::memory_order_relaxed);
+  lRet.m_MaxRecords = m_MaxRecords.load(std::memory_order_relaxed);
+  lRet.m_Interval = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::nanoseconds{m_IntervalNs.load(std::memory_order_relaxed)});
+  lRet.m_Level = static_cast<spdlog::level::level_enum>(
+      m_Level.load(std::memory_order_relaxed));
+  lRet.m_Sync = m_Sync.load(std::memory_order_relaxed);
+  return lRet;
+}
+
+void FlushSink::FlushIfDue() {
+  const std::int64_t lInterval{m_IntervalNs.load(std::memory_order_relaxed)};
+  if (lInterval > 0 && m_PendingRecords.load(std::memory_order_relaxed) > 0 &&
+      Now() - m_LastFlush.load(std::memory_order_relaxed) >= lInterval) {
+    FlushNow();
+  }
+}
+
+void FlushSink::FlushNow() {
+  m_PendingBytes.store(0, std::memory_order_relaxed);
+  m_PendingRecords.store(0, std::memory_order_relaxed);
+  m_LastFlush.store(Now(), std::memory_order_relaxed);
+
+  spdlog::logger *lLogger{m_Logger.load(std::memory_order_acquire)};
+  if (lLogger == nullptr) {
+    return;
+  }
+  const auto lStart{std::chrono::steady_clock::now()};
+  lLogger->flush();
+
+  // Group commit : one fdatasync per file for every record of the batch
+  if (m_Sync.load(std::memory_order_relaxed)) {
+    for (const auto &lSink : lLogger->sinks()) {
+      if (auto *lDaily{
+              dynamic_cast<spdlog::sinks::daily_file_sink_mt *>(lSink.get())};
+          lDaily != nullptr) {
+        SyncFile(lDaily->filename());
+      } else if (auto *lBinary{dynamic_cast<BinaryFileSink *>(lSink.get())};
+                 lBinary != nullptr) {
+        SyncFile(lBinary->GetFilename());
+      }
+#ifdef STROALGO_LOG_MAPPED_FILES
+      if (auto *lMapped{dynamic_cast<MappedFileSink *>(lSink.get())};
+          lMapped != nullptr) {
+        SyncFile(lMapped->GetFilename());
+      }
+#endif
+#ifdef STROALGO_LOG_IO_URING
+      if (auto *lUring{dynamic_cast<UringFileSink *>(lSink.get())};
+          lUring != nullptr) {
+        // Submitted through the ring after the pending writes
+        lUring->Sync();
+      }
+#endif
+    }
+  }
+  m_FlushDurations.Record(std::chrono::steady_clock::now() - lStart);
+}
+
+void FlushSink::log(const spdlog::details::log_msg &pMsg) {
+  OnRecord(pMsg.level, pMsg.payload.size());
+}
+
+void FlushSink::WriteRecord(const LogRecord &pRecord) {
+  OnRecord(pRecord.m_Level, pRecord.Payload().size());
+}
+
+void FlushSink::OnRecord(spdlog::level::level_enum pLevel, std::size_t pSize) {
+  m_WrittenRecords.fetch_add(1, std::memory_order_relaxed);
+  const std::size_t lBytes{
+      m_PendingBytes.fetch_add(pSize, std::memory_order_relaxed) + pSize};
+  const std::size_t lRecords{
+      m_PendingRecords.fetch_add(1, std::memory_order_relaxed) + 1};
+  const std::size_t lMaxBytes{m_MaxBytes.load(std::memory_order_relaxed)};
+  const std::size_t lMaxRecords{m_MaxRecords.load(std::memory_order_relaxed)};
+
+  bool lDue{pLevel >= m_Level.load(std::memory_order_relaxed) &&
+            pLevel != spdlog::level::off};
+  lDue = lDue || (lMaxBytes > 0 && lBytes >= lMaxBytes);
+  lDue = lDue || (lMaxRecords > 0 && lRecords >= lMaxRecords);
+  if (!lDue) {
+    const std::int64_t lInterval{m_IntervalNs.load(std::memory_order_relaxed)};
+    lDue = lInterval > 0 &&
+           Now() - m_LastFlush.load(std::memory_order_relaxed) >= lInterval;
+  }
+
+  if (lDue) {
+    FlushNow();
+  }
+}
+
+std::int64_t FlushSink::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,206 @@
+/**
+ * @file IoUring.cpp
+ * @brief Minimal Linux io_uring submission and completion rings
+ * @details Uses the io_uring system calls
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "IoUring.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Get a ring field from its offset
+ *
+ * @param pRing Mapped ring
+ * @param pOffset Offset given by io_uring_setup
+ * @return The field
+ */
+unsigned *RingField(void *pRing, std::uint32_t pOffset) {
+  return reinterpret_cast<unsigned *>(static_cast<char *>(pRing) + pOffset);
+}
+
+}  // namespace
+
+IoUring::IoUring(unsigned pEntries) {
+  io_uring_params lParams{};
+  const long lRing{::syscall(__NR_io_uring_setup, pEntries, &lParams)};
+  if (lRing < 0) {
+    return;
+  }
+  m_Ring = static_cast<int>(lRing);
+
+  // Both rings share one mapping on recent kernels
+  m_SubmitRingSize =
+      lParams.sq_off.array + lParams.sq_entries * sizeof(unsigned);
+  m_CompleteRingSize =
+      lParams.cq_off.cqes + lParams.cq_entries * sizeof(io_uring_cqe);
+  const bool lSingleMapping{(lParams.features & IORING_FEAT_SINGLE_MMAP) != 0};
+  if (lSingleMapping) {
+    m_SubmitRingSize = std::max(m_SubmitRingSize, m_CompleteRingSize);
+    m_CompleteRingSize = m_SubmitRingSize;
+  }
+
+  m_SubmitRing = ::mmap(nullptr, m_SubmitRingSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQ_RING);
+  m_CompleteRing = lSingleMapping || m_SubmitRing == MAP_FAILED
+                       ? m_SubmitRing
+                       : ::mmap(nullptr, m_CompleteRingSize,
+                                PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, m_Ring,
+                                IORING_OFF_CQ_RING);
+  m_EntriesSize = lParams.sq_entries * sizeof(io_uring_sqe);
+  void *lEntries{::mmap(nullptr, m_EntriesSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQES)};
+  if (m_SubmitRing == MAP_FAILED || m_CompleteRing == MAP_FAILED ||
+      lEntries == MAP_FAILED) {
+    if (lEntries != MAP_FAILED) {
+      ::munmap(lEntries, m_EntriesSize);
+    }
+    if (m_CompleteRing != MAP_FAILED && m_CompleteRing != m_SubmitRing) {
+      ::munmap(m_CompleteRing, m_CompleteRingSize);
+    }
+    if (m_SubmitRing != MAP_FAILED) {
+      ::munmap(m_SubmitRing, m_SubmitRingSize);
+    }
+    m_SubmitRing = nullptr;
+    m_CompleteRing = nullptr;
+    ::close(m_Ring);
+    m_Ring = -1;
+    return;
+  }
+  m_Entries = static_cast<io_uring_sqe *>(lEntries);
+
+  m_SubmitHead = RingField(m_SubmitRing, lParams.sq_off.head);
+  m_SubmitTail = RingField(m_SubmitRing, lParams.sq_off.tail);
+  m_SubmitArray = RingField(m_SubmitRing, lParams.sq_off.array);
+  m_SubmitMask = *RingField(m_SubmitRing, lParams.sq_off.ring_mask);
+  m_SubmitEntries = *RingField(m_SubmitRing, lParams.sq_off.ring_entries);
+
+  m_CompleteHead = RingField(m_CompleteRing, lParams.cq_off.head);
+  m_CompleteTail = RingField(m_CompleteRing, lParams.cq_off.tail);
+  m_CompleteMask = *RingField(m_CompleteRing, lParams.cq_off.ring_mask);
+  m_Completions = reinterpret_cast<io_uring_cqe *>(
+      static_cast<char *>(m_CompleteRing) + lParams.cq_off.cqes);
+}
+
+IoUring::~IoUring() {
+  if (m_Ring < 0) {
+    return;
+  }
+  ::munmap(m_Entries, m_EntriesSize);
+  if (m_CompleteRing != m_SubmitRing) {
+    ::munmap(m_CompleteRing, m_CompleteRingSize);
+  }
+  ::munmap(m_SubmitRing, m_SubmitRingSize);
+  ::close(m_Ring);
+}
+
+bool IoUring::IsSupported() {
+  static const bool lSupported{IoUring{1}.IsValid()};
+  return lSupported;
+}
+
+bool IoUring::RegisterBuffers(const iovec *pBuffers, unsigned pCount) {
+  return m_Ring >= 0 && ::syscall(__NR_io_uring_register, m_Ring,
+                                  IORING_REGISTER_BUFFERS, pBuffers,
+                                  pCount) == 0;
+}
+
+bool IoUring::PrepareWriteFixed(int pFile, const char *pData,
+                                std::uint32_t pSize, std::uint64_t pOffset,
+                                std::uint16_t pBufferIndex,
+                                std::uint64_t pUserData) {
+  io_uring_sqe *lEntry{NextEntry()};
+  if (lEntry == nullptr) {
+    return false;
+  }
+  lEntry->opcode = IORING_OP_WRITE_FIXED;
+  lEntry->fd = pFile;
+  lEntry->addr = reinterpret_cast<std::uintptr_t>(pData);
+  lEntry->len = pSize;
+  lEntry->off = pOffset;
+  lEntry->buf_index = pBufferIndex;
+  lEntry->user_data = pUserData;
+  return true;
+}
+
+bool IoUring::PrepareDataSync(int pFile, std::uint64_t pUserData) {
+  io_uring_sqe *lEntry{NextEntry()};
+  if (lEntry == nullptr) {
+    return false;
+  }
+  lEntry->opcode = IORING_OP_FSYNC;
+  lEntry->flags = IOSQE_IO_DRAIN;
+  lEntry->fd = pFile;
+  lEntry->fsync_flags = IORING_FSYNC_DATASYNC;
+  lEntry->user_data = pUserData;
+  return true;
+}
+
+bool IoUring::Submit(unsigned pWaitCompletions) {
+  if (m_Ring < 0) {
+    return false;
+  }
+  __atomic_store_n(m_SubmitTail, *m_SubmitTail + m_Unpublished,
+                   __ATOMIC_RELEASE);
+  m_Unpublished = 0;
+
+  const unsigned lFlags{pWaitCompletions > 0 ? IORING_ENTER_GETEVENTS : 0U};
+  long lSubmitted{-1};
+  do {
+    lSubmitted = ::syscall(__NR_io_uring_enter, m_Ring, m_Queued,
+                           pWaitCompletions, lFlags, nullptr, 0);
+  } while (lSubmitted < 0 && errno == EINTR);
+  if (lSubmitted < 0) {
+    return false;
+  }
+  m_Queued -= std::min(m_Queued, static_cast<unsigned>(lSubmitted));
+  return true;
+}
+
+bool IoUring::PopCompletion(std::uint64_t &pUserData, std::int32_t &pResult) {
+  if (m_Ring < 0) {
+    return false;
+  }
+  const unsigned lHead{*m_CompleteHead};
+  if (lHead == __atomic_load_n(m_CompleteTail, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+  const io_uring_cqe &lCompletion{m_Completions[lHead & m_CompleteMask]};
+  pUserData = lCompletion.user_data;
+  pResult = lCompletion.res;
+  __atomic_store_n(m_CompleteHead, lHead + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+io_uring_sqe *IoUring::NextEntry() {
+  if (m_Ring < 0) {
+    return nullptr;
+  }
+  // Entries are published to the kernel by Submit, once filled
+  const unsigned lTail{*m_SubmitTail + m_Unpublished};
+  if (lTail - __atomic_load_n(m_SubmitHead, __ATOMIC_ACQUIRE) >=
+      m_SubmitEntries) {
+    return nullptr;
+  }
+  const unsigned lIndex{lTail & m_SubmitMask};
+  io_uring_sqe *lEntry{&m_Entries[lIndex]};
+  std::memset(lEntry, 0, sizeof(io_uring_sqe));
+  m_SubmitArray[lIndex] = lIndex;
+  ++m_Unpublished;
+  ++m_Queued;
+  return lEntry;
+}
+
+}  // namespace Stroalgo::Log
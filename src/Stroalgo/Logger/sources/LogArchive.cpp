@@ -0,0 +1,411 @@
+/**
+ * @file LogArchive.cpp
+ * @brief Block compressed archives of the log files of previous days
+ * @details Uses zlib through Boost.Iostreams
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogArchive.h"
+
+#include <spdlog/common.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <iterator>
+#include <utility>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+#include "BinaryLogTombstones.h"
+#include "LogClock.h"
+#include "LogCompactor.h"
+#include "LogFileLock.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Size of the archive header
+ */
+constexpr std::size_t c_ArchiveHeaderSize{4 + 2};
+
+/**
+ * @brief Size of the description of a block in the index
+ */
+constexpr std::size_t c_ArchiveBlockSize{8 + 4 + 8 + 4};
+
+/**
+ * @brief Size of the archive trailer
+ */
+constexpr std::size_t c_ArchiveTrailerSize{4 + 4};
+
+/**
+ * @brief Compress a block
+ *
+ * @param pData Original bytes
+ * @param pSize Number of bytes
+ * @return zlib stream
+ */
+std::string Compress(const char *pData, std::size_t pSize) {
+  std::string lRet{};
+  boost::iostreams::filtering_ostream lOut{};
+  lOut.push(boost::iostreams::zlib_compressor{});
+  lOut.push(boost::iostreams::back_inserter(lRet));
+  lOut.write(pData, static_cast<std::streamsize>(pSize));
+  // Flushes the end of the zlib stream
+  lOut.reset();
+  return lRet;
+}
+
+}  // namespace
+
+std::string GetLogFileDate(const std::filesystem::path &pFilePath) {
+  const std::string lStem{pFilePath.stem().string()};
+  if (lStem.size() <= c_LocalDateSize ||
+      lStem[lStem.size() - c_LocalDateSize - 1] != '_') {
+    return std::string{};
+  }
+  return lStem.substr(lStem.size() - c_LocalDateSize);
+}
+
+void RemoveLogFile(const std::string &pFilePath) {
+  std::error_code lError{};
+  std::filesystem::remove(pFilePath, lError);
+  std::filesystem::remove(GetBinaryIndexFilename(pFilePath), lError);
+  std::filesystem::remove(GetBinaryTombstoneFilename(pFilePath), lError);
+}
+
+bool WriteLogArchive(const std::string &pFilePath, std::size_t pBlockSize) {
+  std::ifstream lInput{pFilePath, std::ios::binary};
+  if (!lInput || pBlockSize == 0) {
+    return false;
+  }
+
+  // Written aside, an archive is complete once renamed
+  const std::string lArchive{GetLogArchiveFilename(pFilePath)};
+  const std::string lTemporary{lArchive + ".part"};
+  std::ofstream lOutput{lTemporary, std::ios::binary | std::ios::trunc};
+  spdlog::memory_buf_t lBuffer{};
+  lBuffer.append(c_LogArchiveMagic.data(),
+                 c_LogArchiveMagic.data() + c_LogArchiveMagic.size());
+  AppendLittleEndian(lBuffer, c_LogArchiveVersion);
+  lOutput.write(lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+
+  std::vector<LogArchiveBlock> lBlocks{};
+  std::uint64_t lOffset{lBuffer.size()};
+  std::uint64_t lBegin{0};
+  std::string lData(pBlockSize, '\0');
+  try {
+    while (lOutput) {
+      lInput.read(lData.data(), static_cast<std::streamsize>(lData.size()));
+      const auto lLength{static_cast<std::size_t>(lInput.gcount())};
+      if (lLength == 0) {
+        break;
+      }
+      const std::string lCompressed{Compress(lData.data(), lLength)};
+      lOutput.write(lCompressed.data(),
+                    static_cast<std::streamsize>(lCompressed.size()));
+      lBlocks.push_back({lBegin, static_cast<std::uint32_t>(lLength), lOffset,
+                         static_cast<std::uint32_t>(lCompressed.size())});
+      lBegin += lLength;
+      lOffset += lCompressed.size();
+    }
+  } catch (const std::ios_base::failure &) {
+    lOutput.setstate(std::ios::failbit);
+  }
+
+  lBuffer.clear();
+  for (const auto &lBlock : lBlocks) {
+    AppendLittleEndian(lBuffer, lBlock.m_Begin);
+    AppendLittleEndian(lBuffer, lBlock.m_Length);
+    AppendLittleEndian(lBuffer, lBlock.m_Offset);
+    AppendLittleEndian(lBuffer, lBlock.m_Size);
+  }
+  AppendLittleEndian(lBuffer, static_cast<std::uint32_t>(lBlocks.size()));
+  lBuffer.append(c_LogArchiveIndexMagic.data(),
+                 c_LogArchiveIndexMagic.data() + c_LogArchiveIndexMagic.size());
+  lOutput.write(lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+  lOutput.close();
+
+  std::error_code lError{};
+  if (!lOutput || lInput.bad()) {
+    std::filesystem::remove(lTemporary, lError);
+    return false;
+  }
+  std::filesystem::rename(lTemporary, lArchive, lError);
+  return !lError;
+}
+
+LogArchiveBuffer::LogArchiveBuffer(const std::string &pFilePath)
+    : m_File(pFilePath, std::ios::binary) {
+  std::array<char, c_ArchiveHeaderSize> lHeader{};
+  std::array<char, c_ArchiveTrailerSize> lTrailer{};
+  m_File.seekg(0, std::ios::end);
+  const std::streamoff lEnd{m_File.tellg()};
+  const auto lSize{
+      static_cast<std::uint64_t>(std::max(lEnd, std::streamoff{0}))};
+  m_File.seekg(0);
+  if (lSize < c_ArchiveHeaderSize + c_ArchiveTrailerSize ||
+      !m_File.read(lHeader.data(), lHeader.size()) ||
+      std::string_view(lHeader.data(), 4) != c_LogArchiveMagic ||
+      ReadLittleEndian<std::uint16_t>(lHeader.data() + 4) !=
+          c_LogArchiveVersion ||
+      !m_File.seekg(static_cast<std::streamoff>(lSize - lTrailer.size())) ||
+      !m_File.read(lTrailer.data(), lTrailer.size()) ||
+      std::string_view(lTrailer.data() + 4, 4) != c_LogArchiveIndexMagic) {
+    return;
+  }
+
+  // Index just before the trailer
+  const std::uint64_t lCount{ReadLittleEndian<std::uint32_t>(lTrailer.data())};
+  const std::uint64_t lIndexSize{lCount * c_ArchiveBlockSize};
+  if (lIndexSize > lSize - c_ArchiveHeaderSize - c_ArchiveTrailerSize) {
+    return;
+  }
+  std::string lIndex(lIndexSize, '\0');
+  if (!m_File.seekg(static_cast<std::streamoff>(lSize - lTrailer.size() -
+                                                lIndexSize)) ||
+      !m_File.read(lIndex.data(), static_cast<std::streamsize>(lIndexSize))) {
+    return;
+  }
+  for (std::uint64_t lBlock = 0; lBlock < lCount; ++lBlock) {
+    const char *lData{lIndex.data() + lBlock * c_ArchiveBlockSize};
+    m_Blocks.push_back({ReadLittleEndian<std::uint64_t>(lData),
+                        ReadLittleEndian<std::uint32_t>(lData + 8),
+                        ReadLittleEndian<std::uint64_t>(lData + 12),
+                        ReadLittleEndian<std::uint32_t>(lData + 20)});
+  }
+  m_Current = m_Blocks.size();
+  m_Valid = true;
+}
+
+std::uint64_t LogArchiveBuffer::GetSize() const {
+  return m_Blocks.empty() ? 0
+                          : m_Blocks.back().m_Begin + m_Blocks.back().m_Length;
+}
+
+LogArchiveBuffer::int_type LogArchiveBuffer::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+  return LoadBlock(GetPosition()) ? traits_type::to_int_type(*gptr())
+                                  : traits_type::eof();
+}
+
+LogArchiveBuffer::pos_type LogArchiveBuffer::seekoff(
+    off_type pOffset, std::ios_base::seekdir pDirection,
+    std::ios_base::openmode pMode) {
+  off_type lBase{0};
+  if (pDirection == std::ios_base::cur) {
+    lBase = static_cast<off_type>(GetPosition());
+  } else if (pDirection == std::ios_base::end) {
+    lBase = static_cast<off_type>(GetSize());
+  }
+  return seekpos(pos_type{lBase + pOffset}, pMode);
+}
+
+LogArchiveBuffer::pos_type LogArchiveBuffer::seekpos(
+    pos_type pPosition, std::ios_base::openmode pMode) {
+  const off_type lPosition{pPosition};
+  if (!m_Valid || (pMode & std::ios_base::in) == 0 || lPosition < 0) {
+    return pos_type{off_type{-1}};
+  }
+
+  // Inside the current block the decompressed bytes are kept
+  const auto lTarget{static_cast<std::uint64_t>(lPosition)};
+  if (m_Current < m_Blocks.size() &&
+      lTarget >= m_Blocks[m_Current].m_Begin &&
+      lTarget < m_Blocks[m_Current].m_Begin + m_Blocks[m_Current].m_Length) {
+    setg(eback(), eback() + (lTarget - m_Blocks[m_Current].m_Begin), egptr());
+  } else {
+    m_Current = m_Blocks.size();
+    m_Position = lTarget;
+    setg(nullptr, nullptr, nullptr);
+  }
+  return pPosition;
+}
+
+std::uint64_t LogArchiveBuffer::GetPosition() const {
+  return m_Current < m_Blocks.size()
+             ? m_Blocks[m_Current].m_Begin +
+                   static_cast<std::uint64_t>(gptr() - eback())
+             : m_Position;
+}
+
+bool LogArchiveBuffer::LoadBlock(std::uint64_t pPosition) {
+  m_Current = m_Blocks.size();
+  m_Position = pPosition;
+  setg(nullptr, nullptr, nullptr);
+  const auto lBlock{std::upper_bound(
+      m_Blocks.begin(), m_Blocks.end(), pPosition,
+      [](std::uint64_t pValue, const LogArchiveBlock &pBlock) {
+        return pValue < pBlock.m_Begin;
+      })};
+  if (!m_Valid || lBlock == m_Blocks.begin() ||
+      pPosition >= std::prev(lBlock)->m_Begin + std::prev(lBlock)->m_Length) {
+    return false;
+  }
+
+  // A corrupted stream stops the decompressing stream without throwing
+  const LogArchiveBlock &lFound{*std::prev(lBlock)};
+  std::string lCompressed(lFound.m_Size, '\0');
+  m_File.clear();
+  if (!m_File.seekg(static_cast<std::streamoff>(lFound.m_Offset)) ||
+      !m_File.read(lCompressed.data(),
+                   static_cast<std::streamsize>(lCompressed.size()))) {
+    return false;
+  }
+  boost::iostreams::filtering_istream lIn{};
+  lIn.push(boost::iostreams::zlib_decompressor{});
+  lIn.push(boost::iostreams::array_source{lCompressed.data(),
+                                          lCompressed.size()});
+  m_Data.assign(std::istreambuf_iterator<char>{lIn},
+                std::istreambuf_iterator<char>{});
+  if (m_Data.size() != lFound.m_Length) {
+    return false;
+  }
+
+  m_Current = static_cast<std::size_t>(lBlock - m_Blocks.begin()) - 1;
+  setg(m_Data.data(), m_Data.data() + (pPosition - lFound.m_Begin),
+       m_Data.data() + m_Data.size());
+  return true;
+}
+
+std::unique_ptr<std::streambuf> OpenLogFileBuffer(
+    const std::string &pFilePath) {
+  if (IsLogArchive(pFilePath)) {
+    return std::make_unique<LogArchiveBuffer>(pFilePath);
+  }
+  auto lRet{std::make_unique<std::filebuf>()};
+  lRet->open(pFilePath, std::ios::in | std::ios::binary);
+  return lRet;
+}
+
+LogArchiver::LogArchiver(std::string pDirectory,
+                         const ArchiveOptions &pOptions)
+    : m_Directory(std::move(pDirectory)), m_Options(pOptions) {
+  m_Thread = std::thread(&LogArchiver::Run, this);
+}
+
+LogArchiver::~LogArchiver() { Stop(); }
+
+void LogArchiver::Wake() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Woken = true;
+  }
+  m_Condition.notify_one();
+}
+
+void LogArchiver::Stop() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Stop = true;
+  }
+  m_Condition.notify_one();
+  if (m_Thread.joinable()) {
+    m_Thread.join();
+  }
+}
+
+std::size_t LogArchiver::ArchivePending() {
+  std::lock_guard<std::mutex> lArchiveLock(m_ArchiveMutex);
+  const auto lNow{spdlog::log_clock::now()};
+  const std::string lToday{
+      FormatLocalDate(spdlog::log_clock::to_time_t(lNow)).View()};
+  const std::string lExpired{
+      FormatLocalDate(spdlog::log_clock::to_time_t(
+                          lNow - std::chrono::hours{24} * m_Options.m_MaxDays))
+          .View()};
+  const auto lLastWrite{std::filesystem::file_time_type::clock::now() -
+                        m_Options.m_MinAge};
+
+  // Listed first, the directories change while files are archived
+  std::vector<std::filesystem::path> lFiles{};
+  std::error_code lError{};
+  for (const auto &lFile :
+       std::filesystem::recursive_directory_iterator{m_Directory, lError}) {
+    if (lFile.is_regular_file(lError)) {
+      lFiles.push_back(lFile.path());
+    }
+  }
+
+  std::size_t lRet{0};
+  for (const auto &lFile : lFiles) {
+    {
+      std::lock_guard<std::mutex> lLock(m_Mutex);
+      if (m_Stop) {
+        break;
+      }
+    }
+
+    const std::string lFilePath{lFile.string()};
+    const std::string lExtension{lFile.extension().string()};
+    if (IsLogArchive(lFile)) {
+      const std::string lDate{GetLogFileDate(GetArchivedLogPath(lFile))};
+      if (m_Options.m_MaxDays > 0 && !lDate.empty() && lDate < lExpired) {
+        const LogFileLock lLock{lFile};
+        RemoveLogFile(lFilePath);
+      }
+      continue;
+    }
+    const std::string lDate{GetLogFileDate(lFile)};
+    if ((lExtension != ".txt" && lExtension != ".json" &&
+         lExtension != ".slog") ||
+        lDate.empty() || lDate >= lToday ||
+        std::filesystem::last_write_time(lFile, lError) > lLastWrite ||
+        lError) {
+      continue;
+    }
+
+    // Deleted records are dropped before compressing, the compactor and the
+    // retention thread may have taken the file meanwhile
+    if (lExtension == ".slog" &&
+        !LoadBinaryTombstones(lFilePath).empty() &&
+        LogCompactor::CompactFile(lFilePath) &&
+        !std::filesystem::exists(lFile, lError)) {
+      continue;
+    }
+    lRet += ArchiveFile(lFilePath, m_Options.m_BlockSize) ? 1 : 0;
+  }
+  return lRet;
+}
+
+bool LogArchiver::ArchiveFile(const std::string &pFilePath,
+                              std::size_t pBlockSize) {
+  const LogFileLock lLock{pFilePath};
+  if (!WriteLogArchive(pFilePath, pBlockSize)) {
+    return false;
+  }
+
+  // Readers of the log file fall back on a full scan while its index moves
+  const std::string lArchive{GetLogArchiveFilename(pFilePath)};
+  std::error_code lError{};
+  std::filesystem::rename(GetBinaryIndexFilename(pFilePath),
+                          GetBinaryIndexFilename(lArchive), lError);
+  RenameBinaryTombstones(pFilePath, lArchive);
+  std::filesystem::remove(pFilePath, lError);
+  return true;
+}
+
+void LogArchiver::Run() {
+  std::unique_lock<std::mutex> lLock(m_Mutex);
+  while (true) {
+    m_Condition.wait_for(lLock, m_Options.m_Interval,
+                         [this]() { return m_Stop || m_Woken; });
+    if (m_Stop) {
+      return;
+    }
+    m_Woken = false;
+    lLock.unlock();
+    ArchivePending();
+    lLock.lock();
+  }
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,160 @@
+/**
+ * @file LogClock.cpp
+ * @brief Time source of the records and rendering of local dates
+ * @details Uses clock_gettime on Linux and the spdlog time zone helpers
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogClock.h"
+
+#include <spdlog/details/os.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Seconds of a rendering window, time zones and their changes are
+ * aligned on quarters of an hour
+ */
+constexpr std::time_t c_WindowSeconds{15 * 60};
+
+/**
+ * @brief Get the clock stamping the records
+ *
+ * @return The shared selection
+ */
+std::atomic<ClockSource> &SelectedClockSource() {
+  static std::atomic<ClockSource> lSource{ClockSource::Precise};
+  return lSource;
+}
+
+/**
+ * @brief Local time rendered at the start of the current window of a thread
+ * @struct LocalTimeWindow
+ */
+struct LocalTimeWindow {
+  /**
+   * @brief First second of the window, -1 before the first rendering
+   */
+  std::time_t m_Start{-1};
+
+  /**
+   * @brief "YYYY-MM-DD HH:MM:SS" at the start of the window
+   */
+  std::array<char, c_LocalDateTimeSize> m_Text{};
+
+  /**
+   * @brief Minute at the start of the window
+   */
+  int m_Minute{0};
+
+  /**
+   * @brief Offset from UTC in minutes
+   */
+  int m_Offset{0};
+
+  /**
+   * @brief The window starts on a quarter of an hour of the local time,
+   * false for the rare zones not aligned on them
+   */
+  bool m_Aligned{false};
+};
+
+/**
+ * @brief Convert and render a local date and time
+ *
+ * @param pSecond Time to render
+ * @param pDest Receives "YYYY-MM-DD HH:MM:SS"
+ * @param pDate Receives the broken down local time
+ */
+void RenderLocalDateTime(std::time_t pSecond, char *pDest, std::tm &pDate) {
+  pDate = spdlog::details::os::localtime(pSecond);
+  WriteDigits(pDest, pDate.tm_year + 1900, 4);
+  pDest[4] = '-';
+  WriteDigits(pDest + 5, pDate.tm_mon + 1, 2);
+  pDest[7] = '-';
+  WriteDigits(pDest + 8, pDate.tm_mday, 2);
+  pDest[10] = ' ';
+  WriteDigits(pDest + 11, pDate.tm_hour, 2);
+  pDest[13] = ':';
+  WriteDigits(pDest + 14, pDate.tm_min, 2);
+  pDest[16] = ':';
+  WriteDigits(pDest + 17, pDate.tm_sec, 2);
+}
+
+}  // namespace
+
+void SetLogClockSource(ClockSource pSource) {
+  SelectedClockSource().store(pSource, std::memory_order_relaxed);
+}
+
+ClockSource GetLogClockSource() {
+  return SelectedClockSource().load(std::memory_order_relaxed);
+}
+
+spdlog::log_clock::time_point LogClockNow() {
+#ifdef CLOCK_REALTIME_COARSE
+  if (GetLogClockSource() == ClockSource::Coarse) {
+    timespec lNow{};
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &lNow) == 0) {
+      return spdlog::log_clock::time_point{
+          std::chrono::duration_cast<spdlog::log_clock::duration>(
+              std::chrono::seconds{lNow.tv_sec} +
+              std::chrono::nanoseconds{lNow.tv_nsec})};
+    }
+  }
+#endif
+  return spdlog::log_clock::now();
+}
+
+int FormatLocalDateTime(std::time_t pSecond, char *pDest) {
+  thread_local LocalTimeWindow lWindow{};
+  const std::time_t lStart{
+      pSecond - ((pSecond % c_WindowSeconds) + c_WindowSeconds) %
+                    c_WindowSeconds};
+  if (lStart != lWindow.m_Start) {
+    std::tm lDate{};
+    RenderLocalDateTime(lStart, lWindow.m_Text.data(), lDate);
+    lWindow.m_Start = lStart;
+    lWindow.m_Minute = lDate.tm_min;
+    lWindow.m_Offset = spdlog::details::os::utc_minutes_offset(lDate);
+    lWindow.m_Aligned = lDate.tm_sec == 0 && lDate.tm_min % 15 == 0;
+  }
+
+  if (!lWindow.m_Aligned) {
+    std::tm lDate{};
+    RenderLocalDateTime(pSecond, pDest, lDate);
+    return spdlog::details::os::utc_minutes_offset(lDate);
+  }
+
+  // Only the minutes and seconds change within the window
+  const std::time_t lElapsed{pSecond - lStart};
+  std::memcpy(pDest, lWindow.m_Text.data(), lWindow.m_Text.size());
+  WriteDigits(pDest + 14, lWindow.m_Minute + lElapsed / 60, 2);
+  WriteDigits(pDest + 17, lElapsed % 60, 2);
+  return lWindow.m_Offset;
+}
+
+LocalDate FormatLocalDate(std::time_t pSecond) {
+  std::array<char, c_LocalDateTimeSize> lText{};
+  FormatLocalDateTime(pSecond, lText.data());
+  LocalDate lRet{};
+  std::memcpy(lRet.m_Text.data(), lText.data(), lRet.m_Text.size());
+  return lRet;
+}
+
+LocalDate CurrentLocalDate() {
+  return FormatLocalDate(
+      spdlog::log_clock::to_time_t(spdlog::log_clock::now()));
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,88 @@
+/**
+ * @file LogCollector.cpp
+ * @brief Collector writing the records of every producer process of the host
+ * @details Uses std::filesystem to find the shared memory segments
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogCollector.h"
+
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace Stroalgo::Log {
+
+LogCollector::LogCollector(CollectorOptions pOptions)
+    : m_Options(std::move(pOptions)) {}
+
+std::size_t LogCollector::CollectPending() {
+  Discover();
+  std::size_t lRet{0};
+  for (auto lIt = m_Segments.begin(); lIt != m_Segments.end();) {
+    SharedLogSegment &lSegment{*lIt->second};
+
+    // Checked first, the records written before the exit are then all there
+    const bool lGone{lSegment.IsProducerGone()};
+    std::size_t lWritten{0};
+    do {
+      lWritten = lSegment.Drain(
+          [this](const SharedLogRecord &pRecord) { Write(pRecord); },
+          m_Options.m_BatchRecords);
+      lRet += lWritten;
+    } while (lWritten == m_Options.m_BatchRecords);
+
+    const std::uint64_t lDropped{lSegment.TakeDroppedRecords()};
+    if (lDropped > 0) {
+      m_Counters.m_Dropped += lDropped;
+      Logger::GetInstance().Warning(
+          Stroalgo::Constants::c_LoggerModuleName,
+          "{} records dropped by process {}, the collector is late", lDropped,
+          lSegment.GetProcessId());
+    }
+
+    if (lGone) {
+      lSegment.Remove();
+      lIt = m_Segments.erase(lIt);
+      ++m_Counters.m_Departed;
+    } else {
+      ++lIt;
+    }
+  }
+  m_Counters.m_Collected += lRet;
+  m_Counters.m_Producers = m_Segments.size();
+  return lRet;
+}
+
+void LogCollector::Discover() {
+  const std::string lPrefix{m_Options.m_Name + "."};
+  std::error_code lError{};
+  for (const auto &lFile :
+       std::filesystem::directory_iterator{m_Options.m_Directory, lError}) {
+    const std::string lFilename{lFile.path().filename().string()};
+    const std::string lSegmentName{"/" + lFilename};
+    if (lFilename.compare(0, lPrefix.size(), lPrefix) != 0 ||
+        m_Segments.find(lSegmentName) != m_Segments.end()) {
+      continue;
+    }
+
+    // A segment still being created is mapped by the next round
+    try {
+      m_Segments.try_emplace(lSegmentName,
+                             std::make_unique<SharedLogSegment>(lSegmentName));
+    } catch (const spdlog::spdlog_ex &) {
+      continue;
+    }
+  }
+}
+
+void LogCollector::Write(const SharedLogRecord &pRecord) {
+  if (!Logger::GetInstance().GetModuleLogger(pRecord.m_ModuleName).IsValid()) {
+    Logger::GetInstance().RegisterModule(std::string{pRecord.m_ModuleName},
+                                         m_Options.m_FileFormats);
+  }
+  Logger::GetInstance().WriteForwardedRecord(pRecord);
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,209 @@
+/**
+ * @file LogCompactor.cpp
+ * @brief Background compaction of the binary log files
+ * @details Uses BinaryLogRangeReader, deferred records are rewritten as text
+ * and archives are compressed again with WriteLogArchive
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogCompactor.h"
+
+#include <spdlog/common.h>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+#include "BinaryLogTombstones.h"
+#include "LogArchive.h"
+#include "LogClock.h"
+#include "LogFileLock.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Remove a file and its index
+ *
+ * @param pFilePath Path of the binary log file
+ */
+void RemoveWithIndex(const std::string &pFilePath) {
+  std::error_code lError{};
+  std::filesystem::remove(pFilePath, lError);
+  std::filesystem::remove(GetBinaryIndexFilename(pFilePath), lError);
+}
+
+}  // namespace
+
+LogCompactor::LogCompactor(std::string pDirectory,
+                           std::chrono::milliseconds pInterval,
+                           std::chrono::milliseconds pMinAge)
+    : m_Directory(std::move(pDirectory)),
+      m_Interval(pInterval),
+      m_MinAge(pMinAge) {
+  m_Thread = std::thread(&LogCompactor::Run, this);
+}
+
+LogCompactor::~LogCompactor() { Stop(); }
+
+void LogCompactor::Wake() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Woken = true;
+  }
+  m_Condition.notify_one();
+}
+
+void LogCompactor::Stop() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Stop = true;
+  }
+  m_Condition.notify_one();
+  if (m_Thread.joinable()) {
+    m_Thread.join();
+  }
+}
+
+std::size_t LogCompactor::CompactPending() {
+  std::lock_guard<std::mutex> lCompactLock(m_CompactMutex);
+  const std::string lToday{CurrentLocalDate().View()};
+  const auto lLastWrite{std::filesystem::file_time_type::clock::now() -
+                        m_MinAge};
+  std::size_t lRet{0};
+  std::error_code lError{};
+  for (const auto &lModuleDir :
+       std::filesystem::recursive_directory_iterator{m_Directory, lError}) {
+    const std::string lFilePath{lModuleDir.path().string()};
+    const std::filesystem::path lLogPath{
+        IsLogArchive(lModuleDir.path()) ? GetArchivedLogPath(lModuleDir.path())
+                                        : lModuleDir.path()};
+    if (lLogPath.extension() != ".slog" ||
+        GetLogFileDate(lLogPath) == lToday ||
+        !std::filesystem::exists(GetBinaryTombstoneFilename(lFilePath),
+                                 lError) ||
+        std::filesystem::last_write_time(lModuleDir.path(), lError) >
+            lLastWrite ||
+        lError) {
+      continue;
+    }
+
+    // One file at a time, stopping between two files
+    {
+      std::lock_guard<std::mutex> lLock(m_Mutex);
+      if (m_Stop) {
+        break;
+      }
+    }
+    lRet += CompactFile(lFilePath) ? 1 : 0;
+  }
+  return lRet;
+}
+
+bool LogCompactor::CompactFile(const std::string &pFilePath) {
+  const LogFileLock lLock{pFilePath};
+  const std::size_t lApplied{LoadBinaryTombstones(pFilePath).size()};
+  if (lApplied == 0) {
+    return false;
+  }
+
+  // Records left are written in a new file along with its index, the one of
+  // an archive is then compressed
+  const bool lArchive{IsLogArchive(pFilePath)};
+  const std::string lTemporary{
+      (lArchive ? GetArchivedLogPath(pFilePath).string() : pFilePath) +
+      ".compact"};
+  std::size_t lRecords{0};
+  try {
+    BinaryLogRangeReader lReader{pFilePath,
+                                 spdlog::log_clock::time_point::min(),
+                                 spdlog::log_clock::time_point::max()};
+    if (!lReader.IsValid()) {
+      return false;
+    }
+    std::ofstream lFile{lTemporary, std::ios::binary | std::ios::trunc};
+    spdlog::memory_buf_t lBuffer{};
+    AppendBinaryHeader(lBuffer, lReader.GetModuleId(),
+                       lReader.GetModuleName());
+    lFile.write(lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+    std::uint64_t lOffset{lBuffer.size()};
+    BinaryLogIndexWriter lIndex{};
+    lIndex.Open(lTemporary, lOffset, true);
+
+    BinaryLogEntry lEntry{};
+    while (lReader.Next(lEntry)) {
+      const std::int64_t lTime{ToBinaryTime(lEntry.m_Time)};
+      lBuffer.clear();
+      AppendBinaryRecord(lBuffer, lTime, lEntry.m_Level, lEntry.m_ModuleId,
+                         lEntry.m_ThreadId,
+                         GetTextFormatId(lEntry.m_Structured),
+                         lEntry.m_Message);
+      lFile.write(lBuffer.data(),
+                  static_cast<std::streamsize>(lBuffer.size()));
+      lOffset += lBuffer.size();
+      lIndex.AddRecord(lOffset, lTime, lEntry.m_Level);
+      ++lRecords;
+    }
+    lIndex.Flush();
+    lFile.flush();
+    if (!lFile) {
+      RemoveWithIndex(lTemporary);
+      return false;
+    }
+  } catch (const spdlog::spdlog_ex &) {
+    RemoveWithIndex(lTemporary);
+    return false;
+  }
+
+  if (lRecords == 0) {
+    RemoveWithIndex(lTemporary);
+    RemoveWithIndex(pFilePath);
+    RemoveBinaryTombstones(pFilePath, std::numeric_limits<std::size_t>::max());
+    return true;
+  }
+
+  std::error_code lError{};
+  std::string lReplacement{lTemporary};
+  if (lArchive) {
+    if (!WriteLogArchive(lTemporary, c_DefaultArchiveBlockSize)) {
+      RemoveWithIndex(lTemporary);
+      return false;
+    }
+    lReplacement = GetLogArchiveFilename(lTemporary);
+    std::filesystem::remove(lTemporary, lError);
+  }
+
+  // Without index while the data is replaced, the whole file is read
+  std::filesystem::remove(GetBinaryIndexFilename(pFilePath), lError);
+  std::filesystem::rename(lReplacement, pFilePath, lError);
+  if (lError) {
+    RemoveWithIndex(lTemporary);
+    std::filesystem::remove(lReplacement, lError);
+    return false;
+  }
+  std::filesystem::rename(GetBinaryIndexFilename(lTemporary),
+                          GetBinaryIndexFilename(pFilePath), lError);
+  RemoveBinaryTombstones(pFilePath, lApplied);
+  return true;
+}
+
+void LogCompactor::Run() {
+  std::unique_lock<std::mutex> lLock(m_Mutex);
+  while (true) {
+    m_Condition.wait_for(lLock, m_Interval,
+                         [this]() { return m_Stop || m_Woken; });
+    if (m_Stop) {
+      return;
+    }
+    m_Woken = false;
+    lLock.unlock();
+    CompactPending();
+    lLock.lock();
+  }
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,82 @@
+/**
+ * @file LogFileLock.cpp
+ * @brief Process-wide lock of the log files maintained in background
+ * @details The files locked are kept in a set guarded by a mutex
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogFileLock.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <system_error>
+
+#include "LogArchive.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Get the mutex protecting the locked files
+ *
+ * @return The mutex
+ */
+std::mutex &GetLockedFilesMutex() {
+  static std::mutex sMutex{};
+  return sMutex;
+}
+
+/**
+ * @brief Get the condition signaled when a file is released
+ *
+ * @return The condition
+ */
+std::condition_variable &GetLockedFilesCondition() {
+  static std::condition_variable sCondition{};
+  return sCondition;
+}
+
+/**
+ * @brief Get the files locked by the process
+ *
+ * @return Keys of the locked files
+ */
+std::set<std::string> &GetLockedFiles() {
+  static std::set<std::string> sFiles{};
+  return sFiles;
+}
+
+/**
+ * @brief Get the key shared by a log file and its archive
+ *
+ * @param pFilePath Path of a log file or of its archive
+ * @return Absolute path of the log file
+ */
+std::string GetLockKey(const std::filesystem::path &pFilePath) {
+  std::error_code lError{};
+  const std::filesystem::path lLogFile{GetArchivedLogPath(pFilePath)};
+  const std::filesystem::path lAbsolute{
+      std::filesystem::absolute(lLogFile, lError)};
+  return (lError ? lLogFile : lAbsolute).lexically_normal().string();
+}
+
+}  // namespace
+
+LogFileLock::LogFileLock(const std::filesystem::path &pFilePath)
+    : m_Key(GetLockKey(pFilePath)) {
+  std::unique_lock<std::mutex> lLock(GetLockedFilesMutex());
+  GetLockedFilesCondition().wait(
+      lLock, [this]() { return GetLockedFiles().insert(m_Key).second; });
+}
+
+LogFileLock::~LogFileLock() {
+  {
+    std::lock_guard<std::mutex> lLock(GetLockedFilesMutex());
+    GetLockedFiles().erase(m_Key);
+  }
+  GetLockedFilesCondition().notify_all();
+}
+
+}  // namespace Stroalgo::Log
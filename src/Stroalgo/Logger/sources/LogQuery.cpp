@@ -0,0 +1,312 @@
+/**
+ * @file LogQuery.cpp
+ * @brief Query of the binary log files with constant memory
+ * @details Uses BinaryLogRangeReader and std::filesystem
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogQuery.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <utility>
+
+#include "Exceptions.h"
+#include "JsonEscape.h"
+#include "LogArchive.h"
+#include "LogClock.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Extension of the binary log files
+ */
+constexpr std::string_view c_BinaryExtension{".slog"};
+
+/**
+ * @brief Write a record as a LogItem JSON object
+ *
+ * @param pOut Destination buffer
+ * @param pItem The record
+ */
+void AppendLogItem(spdlog::memory_buf_t &pOut, const LogQueryItem &pItem) {
+  const auto &lEntry{pItem.m_Entry};
+  std::array<char, c_LocalDateTimeSize> lDateTime{};
+  const int lOffset{FormatLocalDateTime(
+      spdlog::log_clock::to_time_t(lEntry.m_Time), lDateTime.data())};
+  const auto lSinceEpoch{lEntry.m_Time.time_since_epoch()};
+  const auto lMicroseconds{
+      std::chrono::duration_cast<std::chrono::microseconds>(lSinceEpoch) -
+      std::chrono::duration_cast<std::chrono::seconds>(lSinceEpoch)};
+  const int lAbsOffset{lOffset < 0 ? -lOffset : lOffset};
+  const auto lLevel{spdlog::level::to_string_view(lEntry.m_Level)};
+
+  fmt::format_to(std::back_inserter(pOut),
+                 "{{\"time\": \"{}.{:06d}{}{:02d}:{:02d}\", \"module\": ",
+                 std::string_view{lDateTime.data(), lDateTime.size()},
+                 lMicroseconds.count(), lOffset < 0 ? '-' : '+',
+                 lAbsOffset / 60, lAbsOffset % 60);
+  AppendJsonString(pOut, pItem.m_Module);
+  pOut.append(std::string_view{", \"level\": \""});
+  pOut.append(std::string_view{lLevel.data(), lLevel.size()});
+  pOut.append(std::string_view{"\", "});
+  AppendJsonPayload(pOut, lEntry.m_Message, lEntry.m_Structured);
+  pOut.push_back('}');
+}
+
+}  // namespace
+
+LogQuery::LogQuery(LogQueryOptions pOptions) : m_Options(std::move(pOptions)) {
+  // Days of the time range, files of other days are not opened
+  const std::string lFirstDate{
+      m_Options.m_Start == spdlog::log_clock::time_point::min()
+          ? std::string{}
+          : std::string{FormatLocalDate(spdlog::log_clock::to_time_t(
+                                            m_Options.m_Start))
+                            .View()}};
+  const std::string lLastDate{
+      m_Options.m_End == spdlog::log_clock::time_point::max()
+          ? std::string{}
+          : std::string{
+                FormatLocalDate(spdlog::log_clock::to_time_t(m_Options.m_End))
+                    .View()}};
+
+  std::vector<std::pair<std::string, std::string>> lFiles{};
+  std::error_code lError{};
+  for (const auto &lModuleDir :
+       std::filesystem::directory_iterator{m_Options.m_Directory, lError}) {
+    if (!lModuleDir.is_directory() ||
+        (!m_Options.m_Module.empty() &&
+         lModuleDir.path().filename() != m_Options.m_Module)) {
+      continue;
+    }
+    for (const auto &lFile :
+         std::filesystem::directory_iterator{lModuleDir.path(), lError}) {
+      // Archived files of the previous days are read as well
+      const std::filesystem::path lLogFile{GetArchivedLogPath(lFile.path())};
+      const std::string lDate{GetLogFileDate(lLogFile)};
+      if (lLogFile.extension() != c_BinaryExtension || lDate.empty() ||
+          (!lFirstDate.empty() && lDate < lFirstDate) ||
+          (!lLastDate.empty() && lDate > lLastDate)) {
+        continue;
+      }
+      lFiles.emplace_back(lDate, lFile.path().string());
+    }
+  }
+  std::sort(lFiles.begin(), lFiles.end());
+
+  for (auto &lFile : lFiles) {
+    m_Files.push_back(std::move(lFile.second));
+  }
+  m_Scans.resize(m_Files.size());
+
+  // Files of the cursor are resumed at their offset, the others are new
+  std::size_t lBegin{0};
+  while (lBegin < m_Options.m_Cursor.size()) {
+    const std::size_t lEnd{std::min(m_Options.m_Cursor.find('|', lBegin),
+                                    m_Options.m_Cursor.size())};
+    const std::string lEntry{m_Options.m_Cursor.substr(lBegin, lEnd - lBegin)};
+    const std::size_t lSeparator{lEntry.rfind('@')};
+    if (lSeparator == std::string::npos || lSeparator + 1 == lEntry.size() ||
+        lEntry.find_first_not_of("0123456789", lSeparator + 1) !=
+            std::string::npos) {
+      throw Stroalgo::Exceptions::LoggerException(
+          fmt::format("Invalid log query cursor {}", m_Options.m_Cursor));
+    }
+    const auto lFile{std::find(m_Files.begin(), m_Files.end(),
+                               lEntry.substr(0, lSeparator))};
+    if (lFile != m_Files.end()) {
+      m_Scans[static_cast<std::size_t>(lFile - m_Files.begin())]
+          .m_StartOffset = std::stoull(lEntry.substr(lSeparator + 1));
+    }
+    lBegin = lEnd + 1;
+  }
+}
+
+LogQuery::~LogQuery() { Stop(); }
+
+bool LogQuery::Next(LogQueryItem &pItem) {
+  if (!m_Started) {
+    m_Started = true;
+    Start();
+  }
+  if ((m_Options.m_Limit != 0 && m_Returned == m_Options.m_Limit) ||
+      m_Heads.empty()) {
+    return false;
+  }
+
+  // Oldest record of every file
+  const std::size_t lFile{m_Heads.top().second};
+  m_Heads.pop();
+  FileScan &lScan{m_Scans[lFile]};
+  pItem = std::move(lScan.m_Current[lScan.m_Position++].m_Item);
+  Advance(lFile);
+  ++m_Returned;
+
+  // Early termination, the files are no longer read
+  if ((m_Options.m_Limit != 0 && m_Returned == m_Options.m_Limit) ||
+      m_Heads.empty()) {
+    if (!m_Heads.empty()) {
+      BuildCursor();
+    }
+    Stop();
+  }
+  return true;
+}
+
+void LogQuery::Start() {
+  if (m_Files.empty()) {
+    return;
+  }
+  std::size_t lThreads{m_Options.m_Threads != 0
+                           ? m_Options.m_Threads
+                           : std::thread::hardware_concurrency()};
+  lThreads = std::clamp<std::size_t>(lThreads, 1, m_Files.size());
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    for (std::size_t lFile = 0; lFile < m_Files.size(); ++lFile) {
+      Request(lFile);
+    }
+  }
+  for (std::size_t lThread = 0; lThread < lThreads; ++lThread) {
+    m_Workers.emplace_back(&LogQuery::Work, this);
+  }
+  for (std::size_t lFile = 0; lFile < m_Files.size(); ++lFile) {
+    Advance(lFile);
+  }
+}
+
+void LogQuery::Work() {
+  std::unique_lock<std::mutex> lLock(m_Mutex);
+  while (true) {
+    m_WorkAvailable.wait(lLock,
+                         [this]() { return m_Stop || !m_Requests.empty(); });
+    if (m_Stop) {
+      return;
+    }
+    const std::size_t lFile{m_Requests.front()};
+    m_Requests.pop_front();
+    FileScan &lScan{m_Scans[lFile]};
+    lLock.unlock();
+
+    // The reader is only used by the worker holding the request of its file
+    if (lScan.m_Reader == nullptr) {
+      lScan.m_Reader = std::make_unique<BinaryLogRangeReader>(
+          m_Files[lFile], m_Options.m_Start, m_Options.m_End,
+          m_Options.m_Levels);
+      if (lScan.m_StartOffset != 0) {
+        lScan.m_Reader->SetStartOffset(lScan.m_StartOffset);
+      }
+    }
+    std::vector<ScanEntry> lBatch{};
+    lBatch.reserve(c_QueryBatchSize);
+    ScanEntry lEntry{};
+    bool lExhausted{false};
+    while (lBatch.size() < c_QueryBatchSize) {
+      if (!lScan.m_Reader->Next(lEntry.m_Item.m_Entry)) {
+        lExhausted = true;
+        break;
+      }
+      lEntry.m_Item.m_Module = lScan.m_Reader->GetModuleName();
+      lEntry.m_Offset = lScan.m_Reader->GetEntryOffset();
+      lBatch.push_back(lEntry);
+    }
+
+    lLock.lock();
+    lScan.m_Ready = std::move(lBatch);
+    lScan.m_Requested = false;
+    lScan.m_Exhausted = lExhausted;
+    if (lExhausted) {
+      // Records appended later are read by a resumed query
+      lScan.m_EndOffset = lScan.m_Reader->GetEntryOffset();
+      lScan.m_Reader.reset();
+    }
+    m_BatchReady.notify_all();
+  }
+}
+
+void LogQuery::Request(std::size_t pFile) {
+  m_Scans[pFile].m_Requested = true;
+  m_Requests.push_back(pFile);
+  m_WorkAvailable.notify_one();
+}
+
+void LogQuery::Advance(std::size_t pFile) {
+  FileScan &lScan{m_Scans[pFile]};
+  if (lScan.m_Position == lScan.m_Current.size()) {
+    std::unique_lock<std::mutex> lLock(m_Mutex);
+    m_BatchReady.wait(lLock, [&lScan]() { return !lScan.m_Requested; });
+    lScan.m_Current = std::move(lScan.m_Ready);
+    lScan.m_Ready.clear();
+    lScan.m_Position = 0;
+
+    // Next batch is read while this one is merged
+    if (!lScan.m_Exhausted) {
+      Request(pFile);
+    }
+  }
+  if (lScan.m_Position < lScan.m_Current.size()) {
+    m_Heads.emplace(
+        ToBinaryTime(lScan.m_Current[lScan.m_Position].m_Item.m_Entry.m_Time),
+        pFile);
+  }
+}
+
+void LogQuery::Stop() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Stop = true;
+  }
+  m_WorkAvailable.notify_all();
+  for (auto &lWorker : m_Workers) {
+    lWorker.join();
+  }
+  m_Workers.clear();
+}
+
+void LogQuery::BuildCursor() {
+  std::lock_guard<std::mutex> lLock(m_Mutex);
+  for (std::size_t lFile = 0; lFile < m_Files.size(); ++lFile) {
+    const FileScan &lScan{m_Scans[lFile]};
+    // Next record of the file, or its end once every record is returned
+    const std::uint64_t lOffset{
+        lScan.m_Position < lScan.m_Current.size()
+            ? lScan.m_Current[lScan.m_Position].m_Offset
+            : lScan.m_EndOffset};
+    m_Cursor += fmt::format("{}{}@{}", m_Cursor.empty() ? "" : "|",
+                            m_Files[lFile], lOffset);
+  }
+}
+
+std::size_t WriteLogItemsJson(
+    LogQuery &pQuery, const std::function<void(std::string_view)> &pWriteChunk,
+    std::size_t pChunkSize) {
+  spdlog::memory_buf_t lChunk{};
+  LogQueryItem lItem{};
+  std::size_t lRet{0};
+  lChunk.push_back('[');
+  while (pQuery.Next(lItem)) {
+    if (lRet > 0) {
+      lChunk.push_back(',');
+    }
+    AppendLogItem(lChunk, lItem);
+    ++lRet;
+    if (lChunk.size() >= pChunkSize) {
+      pWriteChunk(std::string_view{lChunk.data(), lChunk.size()});
+      lChunk.clear();
+    }
+  }
+  lChunk.push_back(']');
+  pWriteChunk(std::string_view{lChunk.data(), lChunk.size()});
+  return lRet;
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,345 @@
+/**
+ * @file LogRetention.cpp
+ * @brief Background enforcement of the disk quotas of the log files
+ * @details Uses std::filesystem
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogRetention.h"
+
+#include <spdlog/common.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "BinaryLogIndex.h"
+#include "BinaryLogTombstones.h"
+#include "FlightRecorder.h"
+#include "LogClock.h"
+#include "LogFileLock.h"
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Get the size of a file with its index and tombstones
+ *
+ * @param pFilePath Path of a log file or of an archive
+ * @return Bytes on disk, 0 for the missing files
+ */
+std::uint64_t GetSizeWithSidecars(const std::string &pFilePath) {
+  std::uint64_t lRet{0};
+  for (const auto &lFile :
+       {pFilePath, GetBinaryIndexFilename(pFilePath),
+        GetBinaryTombstoneFilename(pFilePath)}) {
+    std::error_code lError{};
+    const auto lSize{std::filesystem::file_size(lFile, lError)};
+    if (!lError) {
+      lRet += lSize;
+    }
+  }
+  return lRet;
+}
+
+/**
+ * @brief Get the oldest day kept by an age limit
+ *
+ * @param pMaxDays Daily files kept, 0 keeps them
+ * @return "yyyy-mm-dd", files of an earlier day are expired, empty to keep
+ * every day
+ */
+std::string GetExpiryDate(std::uint16_t pMaxDays) {
+  if (pMaxDays == 0) {
+    return std::string{};
+  }
+  return std::string{
+      FormatLocalDate(spdlog::log_clock::to_time_t(
+                          spdlog::log_clock::now() -
+                          std::chrono::hours{24} * pMaxDays))
+          .View()};
+}
+
+}  // namespace
+
+LogRetention::LogRetention(std::string pDirectory,
+                           const RetentionOptions &pOptions)
+    : m_Directory(std::move(pDirectory)), m_Options(pOptions) {
+  m_Thread = std::thread(&LogRetention::Run, this);
+}
+
+LogRetention::~LogRetention() { Stop(); }
+
+void LogRetention::SetOptions(const RetentionOptions &pOptions) {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Options = pOptions;
+  }
+  // The interval of the current wait may have changed
+  Wake();
+}
+
+RetentionOptions LogRetention::GetOptions() const {
+  std::lock_guard<std::mutex> lLock(m_Mutex);
+  return m_Options;
+}
+
+RetentionCounters LogRetention::GetCounters() const {
+  std::lock_guard<std::mutex> lLock(m_Mutex);
+  return m_Counters;
+}
+
+void LogRetention::Wake() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Woken = true;
+  }
+  // A round may be paced on another thread
+  m_Condition.notify_all();
+}
+
+void LogRetention::Stop() {
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    m_Stop = true;
+  }
+  m_Condition.notify_all();
+  if (m_Thread.joinable()) {
+    m_Thread.join();
+  }
+}
+
+std::size_t LogRetention::EnforcePending() {
+  std::lock_guard<std::mutex> lRoundLock(m_RoundMutex);
+  const RetentionOptions lOptions{GetOptions()};
+  std::vector<Segment> lSegments{ListSegments(lOptions.m_MinAge)};
+  std::size_t lRet{0};
+
+  // Age limit of each module
+  std::map<std::string, std::string> lExpiryDates{};
+  const std::string lExpiryDate{GetExpiryDate(lOptions.m_MaxDays)};
+  for (const auto &lModule : lOptions.m_Modules) {
+    lExpiryDates.try_emplace(lModule.first,
+                             GetExpiryDate(lModule.second.m_MaxDays));
+  }
+  for (auto &lSegment : lSegments) {
+    const auto lModule{lExpiryDates.find(lSegment.m_Module)};
+    const std::string &lExpiry{
+        lModule != lExpiryDates.end() ? lModule->second : lExpiryDate};
+    if (!lSegment.m_Active && !lExpiry.empty() && lSegment.m_Date < lExpiry) {
+      Remove(lSegment, lOptions.m_IoRate);
+      ++lRet;
+    }
+    if (IsStopping()) {
+      return lRet;
+    }
+  }
+
+  // Quota of each module, then of all the modules
+  for (const auto &lModule : lOptions.m_Modules) {
+    if (lModule.second.m_MaxBytes > 0) {
+      lRet += EnforceQuota(lSegments, lModule.first, lModule.second.m_MaxBytes,
+                           lOptions.m_Compress, lOptions.m_IoRate,
+                           lOptions.m_BlockSize);
+    }
+  }
+  if (lOptions.m_MaxBytes > 0) {
+    lRet += EnforceQuota(lSegments, std::string{}, lOptions.m_MaxBytes,
+                         lOptions.m_Compress, lOptions.m_IoRate,
+                         lOptions.m_BlockSize);
+  }
+
+  // Free disk space, compressing would first need more of it
+  std::error_code lError{};
+  const auto lSpace{std::filesystem::space(m_Directory, lError)};
+  if (lOptions.m_MinFreeBytes > 0 && !lError &&
+      lSpace.available < lOptions.m_MinFreeBytes) {
+    const std::uint64_t lTarget{
+        std::max(lOptions.m_TargetFreeBytes, lOptions.m_MinFreeBytes)};
+    std::uint64_t lFree{lSpace.available};
+    for (auto &lSegment : lSegments) {
+      if (lFree >= lTarget || IsStopping()) {
+        break;
+      }
+      if (!lSegment.m_Active && !lSegment.m_Removed) {
+        lFree += lSegment.m_Size;
+        Remove(lSegment, lOptions.m_IoRate);
+        ++lRet;
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lLock(m_Mutex);
+  ++m_Counters.m_Rounds;
+  return lRet;
+}
+
+std::vector<LogRetention::Segment> LogRetention::ListSegments(
+    std::chrono::milliseconds pMinAge) const {
+  const std::string lToday{CurrentLocalDate().View()};
+  const auto lLastWrite{std::filesystem::file_time_type::clock::now() -
+                        pMinAge};
+  std::vector<Segment> lRet{};
+  std::error_code lError{};
+  for (const auto &lModule :
+       std::filesystem::directory_iterator{m_Directory, lError}) {
+    if (!lModule.is_directory(lError)) {
+      continue;
+    }
+    for (const auto &lFile :
+         std::filesystem::directory_iterator{lModule.path(), lError}) {
+      // Indexes and tombstones are accounted with their file, flight
+      // recorder dumps age like the daily files
+      const std::filesystem::path lLogFile{GetArchivedLogPath(lFile.path())};
+      const std::string lExtension{lLogFile.extension().string()};
+      if (!lFile.is_regular_file(lError) ||
+          (lExtension != ".txt" && lExtension != ".json" &&
+           lExtension != ".slog" && lExtension != c_FlightDumpExtension)) {
+        continue;
+      }
+      Segment lSegment{};
+      lSegment.m_Date = GetLogFileDate(lLogFile);
+      if (lSegment.m_Date.empty()) {
+        continue;
+      }
+      lSegment.m_Path = lFile.path().string();
+      lSegment.m_Module = lModule.path().filename().string();
+      lSegment.m_Size = GetSizeWithSidecars(lSegment.m_Path);
+      lSegment.m_Archived = IsLogArchive(lFile.path());
+      // Archives are written from files no longer written by their sink
+      lSegment.m_Active =
+          lSegment.m_Date >= lToday ||
+          (!lSegment.m_Archived && lFile.last_write_time(lError) > lLastWrite);
+      lRet.push_back(std::move(lSegment));
+    }
+  }
+  std::sort(lRet.begin(), lRet.end(),
+            [](const Segment &pLeft, const Segment &pRight) {
+              return pLeft.m_Date != pRight.m_Date
+                         ? pLeft.m_Date < pRight.m_Date
+                         : pLeft.m_Path < pRight.m_Path;
+            });
+  return lRet;
+}
+
+std::size_t LogRetention::EnforceQuota(std::vector<Segment> &pSegments,
+                                       const std::string &pModule,
+                                       std::uint64_t pMaxBytes, bool pCompress,
+                                       std::uint64_t pIoRate,
+                                       std::size_t pBlockSize) {
+  const auto lConcerned{[&pModule](const Segment &pSegment) {
+    return !pSegment.m_Removed &&
+           (pModule.empty() || pSegment.m_Module == pModule);
+  }};
+  std::uint64_t lUsage{0};
+  for (const auto &lSegment : pSegments) {
+    lUsage += lConcerned(lSegment) ? lSegment.m_Size : 0;
+  }
+
+  // Compressing the oldest files may be enough to meet the quota
+  std::size_t lRet{0};
+  for (auto &lSegment : pSegments) {
+    if (!pCompress || lUsage <= pMaxBytes || IsStopping()) {
+      break;
+    }
+    const std::uint64_t lSize{lSegment.m_Size};
+    if (lConcerned(lSegment) && !lSegment.m_Active && !lSegment.m_Archived &&
+        Compress(lSegment, pIoRate, pBlockSize)) {
+      lUsage -= lSize - std::min(lSize, lSegment.m_Size);
+      ++lRet;
+    }
+  }
+  for (auto &lSegment : pSegments) {
+    if (lUsage <= pMaxBytes || IsStopping()) {
+      break;
+    }
+    if (lConcerned(lSegment) && !lSegment.m_Active) {
+      lUsage -= lSegment.m_Size;
+      Remove(lSegment, pIoRate);
+      ++lRet;
+    }
+  }
+  return lRet;
+}
+
+void LogRetention::Remove(Segment &pSegment, std::uint64_t pIoRate) {
+  {
+    // The archiver may have replaced the file by its archive since listed
+    const LogFileLock lLock{pSegment.m_Path};
+    std::error_code lError{};
+    if (!pSegment.m_Archived &&
+        !std::filesystem::exists(pSegment.m_Path, lError)) {
+      pSegment.m_Path = GetLogArchiveFilename(pSegment.m_Path);
+      pSegment.m_Archived = true;
+    }
+    RemoveLogFile(pSegment.m_Path);
+  }
+  pSegment.m_Removed = true;
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    ++m_Counters.m_Removed;
+    m_Counters.m_FreedBytes += pSegment.m_Size;
+  }
+  Pace(pSegment.m_Size, pIoRate);
+}
+
+bool LogRetention::Compress(Segment &pSegment, std::uint64_t pIoRate,
+                            std::size_t pBlockSize) {
+  // Holds the lock of the file, the archiver may have taken it meanwhile
+  if (!LogArchiver::ArchiveFile(pSegment.m_Path, pBlockSize)) {
+    const std::string lArchive{GetLogArchiveFilename(pSegment.m_Path)};
+    std::error_code lError{};
+    if (!std::filesystem::exists(pSegment.m_Path, lError) &&
+        std::filesystem::exists(lArchive, lError)) {
+      pSegment.m_Path = lArchive;
+      pSegment.m_Size = GetSizeWithSidecars(lArchive);
+      pSegment.m_Archived = true;
+    }
+    return false;
+  }
+  const std::uint64_t lSize{pSegment.m_Size};
+  pSegment.m_Path = GetLogArchiveFilename(pSegment.m_Path);
+  pSegment.m_Size = GetSizeWithSidecars(pSegment.m_Path);
+  pSegment.m_Archived = true;
+  {
+    std::lock_guard<std::mutex> lLock(m_Mutex);
+    ++m_Counters.m_Compressed;
+    m_Counters.m_FreedBytes += lSize - std::min(lSize, pSegment.m_Size);
+  }
+  Pace(lSize, pIoRate);
+  return true;
+}
+
+bool LogRetention::Pace(std::uint64_t pBytes, std::uint64_t pIoRate) {
+  std::unique_lock<std::mutex> lLock(m_Mutex);
+  if (pIoRate > 0) {
+    const std::chrono::duration<double> lDelay{static_cast<double>(pBytes) /
+                                               static_cast<double>(pIoRate)};
+    m_Condition.wait_for(lLock, lDelay, [this]() { return m_Stop; });
+  }
+  return !m_Stop;
+}
+
+bool LogRetention::IsStopping() {
+  std::lock_guard<std::mutex> lLock(m_Mutex);
+  return m_Stop;
+}
+
+void LogRetention::Run() {
+  std::unique_lock<std::mutex> lLock(m_Mutex);
+  while (true) {
+    m_Condition.wait_for(lLock, m_Options.m_Interval,
+                         [this]() { return m_Stop || m_Woken; });
+    if (m_Stop) {
+      return;
+    }
+    m_Woken = false;
+    lLock.unlock();
+    EnforcePending();
+    lLock.lock();
+  }
+}
+
+}  // namespace Stroalgo::Log
@@ -1,249 +1,1045 @@
-// /**
-//  * @file Logger.cpp
-//  * @brief A logger class
-//  * @details Uses spdlog
-//  */
-
-// #include "Logger.h"
-
-// #include <algorithm>
-// #include <boost/algorithm/string.hpp>
-// #include <boost/date_time/gregorian/gregorian.hpp>
-// #include <filesystem>
-// #include <fmt/core.h>
-// #include <fstream>
-// #include <list>
-// #include <memory>
-// #include <spdlog/sinks/daily_file_sink.h>
-// #include <spdlog/sinks/stdout_color_sinks.h>
-// #include <string>
-
-// namespace Utilities::Log {
-
-// Logger::Logger() {
-//   // Register the Logger class itself
-//   RegisterModule(std::string(Utilities::Constants::c_LoggerModuleName));
-// }
-
-// void Logger::RegisterModule(const std::string &pModuleName) {
-
-//   std::string lModuleName = pModuleName;
-//   boost::algorithm::trim(lModuleName);
-//   if (lModuleName.empty()) {
-//     HandleWriteFailure("Module Name can not be an empty string or contain "
-//                        "whitespace,tab,newline",
-//                        std::string(Utilities::Constants::c_LoggerModuleName));
-//   } else if (spdlog::get(pModuleName) == nullptr) {
-
-//     // Console LOG
-//     auto lConsole_sink =
-//         std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-//     lConsole_sink->set_pattern("%^[%Y-%m-%d %H:%M:%S.%e] [%n] [%l] --->
-//     %v%$");
-
-//     // File LOG.txt
-//     std::string lFilename_txt_path{std::string("Logs/") + pModuleName +
-//                                    std::string("/") + pModuleName +
-//                                    std::string(".txt")};
-//     // Create a new Log file at 00:00 and delete it after 31 days
-//     auto lFile_txt_sink =
-//     std::make_shared<spdlog::sinks::daily_file_sink_mt>(
-//         lFilename_txt_path, 00, 00, false, 31);
-//     lFile_txt_sink->set_pattern("%^[%Y-%m-%d %H:%M:%S.%e] [%n] [%l] --->
-//     %v%$");
-
-//     // File LOG.json
-//     std::string lFilename_json_path{std::string("Logs/") + pModuleName +
-//                                     std::string("/") + pModuleName +
-//                                     std::string(".json")};
-//     // Create a new Log file at 00:00 and delete it after 31 days
-//     auto lFile_json_sink =
-//     std::make_shared<spdlog::sinks::daily_file_sink_mt>(
-//         lFilename_json_path, 00, 00, false, 31);
-//     lFile_json_sink->set_pattern(
-//         "{\"time\": \"%Y-%m-%d %H:%M:%S.%f%z\", \"name\": \"%n\", \"level\":
-//         "
-//         "\"%^%l%$\", \"process\": %P, \"thread\": %t, \"message\":
-//         \"%v\"},");
-
-//     spdlog::sinks_init_list lSink_list{lConsole_sink, lFile_txt_sink,
-//                                        lFile_json_sink};
-
-//     // Create Logger
-//     auto lLog = std::make_shared<spdlog::logger>(
-//         pModuleName, lSink_list.begin(), lSink_list.end());
-
-//     // Save logger to avoid multiple call of sdplog::get
-//     m_Loggers->try_emplace(pModuleName, lLog);
-
-//     // Default Log level
-//     lLog->set_level(spdlog::level::trace);
-
-//     // Min Level log to flush
-//     lLog->flush_on(spdlog::level::trace);
-
-//     // Register Logger to enable retrieve using spdlog::get
-//     spdlog::register_logger(lLog);
-//   } else {
-//     spdlog::get(std::string(Utilities::Constants::c_LoggerModuleName))
-//         ->warn("Module {} already registered", pModuleName);
-//   }
-// }
-
-// void Logger::SetModuleLogLevel(const std::string &pModuleName,
-//                                const spdlog::level::level_enum pLogLevel) {
-
-//   // Find the logger related to module
-//   auto lLogger = m_Loggers->find(pModuleName);
-
-//   // Set level if Module is registered
-//   if (lLogger != m_Loggers->end()) {
-//     if (lLogger->second != nullptr) {
-//       lLogger->second->set_level(pLogLevel);
-//     } else {
-//       HandleWriteFailure("Unable to set level : Logger for Module {} is
-//       null",
-//                          pModuleName);
-//     }
-//   } else {
-
-//     HandleWriteFailure("Unable to set level : Module {} is not registered",
-//                        pModuleName);
-//   }
-// }
-
-// const std::string Logger::GetModuleLevel(const std::string &pModuleName) {
-
-//   std::string lRet{};
-//   // Find the logger related to module
-//   auto lLogger = m_Loggers->find(pModuleName);
-
-//   // Set level if Module is registered
-//   if (lLogger != m_Loggers->end()) {
-//     if (lLogger->second != nullptr) {
-//       lRet = LogLevelTostring(lLogger->second->level());
-//     } else {
-//       HandleWriteFailure("Unable to set level : Logger for Module {} is
-//       null",
-//                          pModuleName);
-//     }
-//   } else {
-
-//     HandleWriteFailure("Unable to get level : Module {} is not registered",
-//                        pModuleName);
-//   }
-//   return lRet;
-// }
-
-// const std::string
-// Logger::LogLevelTostring(const spdlog::level::level_enum pLogLevel) {
-//   std::string lRet{};
-//   switch (pLogLevel) {
-//   case spdlog::level::trace:
-//     lRet = "trace";
-//     break;
-//   case spdlog::level::debug:
-//     lRet = "debug";
-//     break;
-//   case spdlog::level::info:
-//     lRet = "info";
-//     break;
-//   case spdlog::level::warn:
-//     lRet = "warning";
-//     break;
-//   case spdlog::level::err:
-//     lRet = "error";
-//     break;
-//   case spdlog::level::critical:
-//     lRet = "critical";
-//     break;
-//   default:
-//     lRet = "";
-//     break;
-//   }
-//   return lRet;
-// }
-
-// const std::map<std::string, std::string> Logger::GetLogLevels() {
-//   std::map<std::string, std::string> lRet{};
-//   std::for_each(m_Loggers->cbegin(), m_Loggers->cend(),
-//                 [&lRet, this](const auto &pLogger) {
-//                   lRet.try_emplace(pLogger.first,
-//                                    LogLevelTostring(pLogger.second->level()));
-//                 });
-//   return lRet;
-// }
-
-// void Logger::ShutDown() {
-//   spdlog::drop_all();
-//   spdlog::shutdown();
-// }
-
-// void Logger::DeleteAllLogs() {
-//   std::for_each(m_Loggers->cbegin(), m_Loggers->cend(),
-//                 [this](const auto &pLogger) { DeleteLogs(pLogger.first); });
-// }
-
-// void Logger::DeleteAllModuleLogs(const std::string &pModuleName) {
-
-//   // Find the logger related to module
-//   auto lLogger = m_Loggers->find(pModuleName);
-
-//   // Set level if Module is registered
-//   if (lLogger != m_Loggers->end()) {
-//     DeleteLogs(lLogger->first);
-//   } else {
-//     HandleWriteFailure("Unable to delete logs : Module {} is not registered",
-//                        pModuleName);
-//     throw Utilities::Exceptions::LoggerException(fmt::format(
-//         "Unable to delete logs : Module {} is not registered", pModuleName));
-//   }
-// } // namespace Utilities::Log
-
-// std::string Logger::CurrentDateToString() {
-//   using namespace boost::gregorian;
-
-//   // Get the current date
-//   date d = day_clock::local_day();
-//   std::unique_ptr<date_facet> df = std::make_unique<date_facet>("%Y-%m-%d");
-
-//   // Apply format
-//   std::stringstream ss;
-//   ss.imbue(std::locale{ss.getloc(), df.get()});
-//   ss << d;
-//   return ss.str();
-// }
-
-// void Logger::DeleteLogs(const std::string &pModuleName) {
-
-//   std::list<std::string> lListOfPath{};
-//   for (const auto &lFilePath :
-//        std::filesystem::directory_iterator{"Logs/" + pModuleName}) {
-//     lListOfPath.push_back(lFilePath.path().string());
-//   }
-
-//   // Clear the content of current used logfile
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/" << pModuleName << "/" << pModuleName << "_"
-//                << CurrentDateToString() << ".txt";
-//   lListOfPath.remove(lLogFilePath.str());
-//   std::fstream lFileStreamTxt{};
-//   lFileStreamTxt.open(lLogFilePath.str(),
-//                       std::ofstream::out | std::ofstream::trunc);
-//   lFileStreamTxt.close();
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/" << pModuleName << "/" << pModuleName << "_"
-//                << CurrentDateToString() << ".json";
-//   lListOfPath.remove(lLogFilePath.str());
-//   std::fstream lFileStreamJson{};
-//   lFileStreamJson.open(lLogFilePath.str(),
-//                        std::ofstream::out | std::ofstream::trunc);
-//   lFileStreamJson.close();
-
-//   // Delete all logs files except the current log file
-//   for (const auto &lFilePath : lListOfPath) {
-//     std::filesystem::remove(lFilePath);
-//   }
-// }
-
-// } // namespace Utilities::Log
+/**
+ * @file Logger.cpp
+ * @brief A logger class
+ * @details Uses spdlog
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "Logger.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BinaryFileSink.h"
+#include "BinaryLogFormat.h"
+#include "Settings.h"
+#include "StructuredFields.h"
+#ifdef STROALGO_LOG_MAPPED_FILES
+#include "MappedFileSink.h"
+#endif
+#ifdef STROALGO_LOG_IO_URING
+#include "UringFileSink.h"
+#endif
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Convert a level read from the settings file
+ *
+ * @param pLevel Boost severity level
+ * @return The spdlog level
+ */
+spdlog::level::level_enum ToLogLevel(
+    boost::log::trivial::severity_level pLevel) {
+  switch (pLevel) {
+    case boost::log::trivial::trace:
+      return spdlog::level::trace;
+    case boost::log::trivial::debug:
+      return spdlog::level::debug;
+    case boost::log::trivial::info:
+      return spdlog::level::info;
+    case boost::log::trivial::warning:
+      return spdlog::level::warn;
+    case boost::log::trivial::error:
+      return spdlog::level::err;
+    case boost::log::trivial::fatal:
+    default:
+      return spdlog::level::critical;
+  }
+}
+
+/**
+ * @brief Convert the flush settings of a module
+ *
+ * @param pSettings Flush settings read from the settings file
+ * @return The flush policy
+ */
+FlushPolicy ToFlushPolicy(
+    const Stroalgo::Configuration::Settings::FlushSettings &pSettings) {
+  FlushPolicy lRet{};
+  lRet.m_MaxBytes = pSettings.m_Bytes;
+  lRet.m_MaxRecords = pSettings.m_Records;
+  lRet.m_Interval = std::chrono::milliseconds{pSettings.m_IntervalMs};
+  lRet.m_Sync = pSettings.m_Sync;
+  lRet.m_Level = ToLogLevel(pSettings.m_Level);
+  return lRet;
+}
+
+/**
+ * @brief Convert the file writer of a module
+ *
+ * @param pWriter File writer read from the settings file
+ * @return The file writer
+ */
+FileWriter ToFileWriter(Stroalgo::Configuration::Settings::FileWriter pWriter) {
+  switch (pWriter) {
+    case Stroalgo::Configuration::Settings::FileWriter::Mapped:
+      return FileWriter::Mapped;
+    case Stroalgo::Configuration::Settings::FileWriter::IoUring:
+      return FileWriter::IoUring;
+    case Stroalgo::Configuration::Settings::FileWriter::Stdio:
+    default:
+      return FileWriter::Stdio;
+  }
+}
+
+/**
+ * @brief Create the sink of a daily text or JSON file
+ *
+ * @param pBaseFilename Path without date
+ * @param pWriter How the file is written
+ * @param pSegmentSize Size of the mapped segments
+ * @param pMaxFiles Daily files kept, 0 keeps them
+ * @return The sink, a new file is created at 00:00
+ */
+spdlog::sink_ptr MakeDailyFileSink(const std::string &pBaseFilename,
+                                   FileWriter pWriter, std::size_t pSegmentSize,
+                                   std::uint16_t pMaxFiles) {
+#ifdef STROALGO_LOG_MAPPED_FILES
+  if (pWriter == FileWriter::Mapped) {
+    return std::make_shared<MappedFileSink>(pBaseFilename, pSegmentSize,
+                                            pMaxFiles);
+  }
+#endif
+#ifdef STROALGO_LOG_IO_URING
+  if (pWriter == FileWriter::IoUring && IoUring::IsSupported()) {
+    return std::make_shared<UringFileSink>(pBaseFilename, pMaxFiles);
+  }
+#endif
+  // Writer not available on this platform
+  static_cast<void>(pWriter);
+  static_cast<void>(pSegmentSize);
+  return std::make_shared<spdlog::sinks::daily_file_sink_mt>(
+      pBaseFilename, 00, 00, false, pMaxFiles);
+}
+
+/**
+ * @brief Get the local date of a time, as written in the log file names
+ *
+ * @param pTime The time
+ * @return "yyyy-mm-dd", sorting before or after every date for the time
+ * limits
+ */
+std::string ToLocalDate(spdlog::log_clock::time_point pTime) {
+  if (pTime == spdlog::log_clock::time_point::min()) {
+    return "0000-00-00";
+  }
+  if (pTime == spdlog::log_clock::time_point::max()) {
+    return "9999-99-99";
+  }
+  return std::string{
+      FormatLocalDate(spdlog::log_clock::to_time_t(pTime)).View()};
+}
+
+/**
+ * @brief Convert the throttle settings of a module
+ *
+ * @param pSettings Throttle settings read from the settings file
+ * @return The throttle policy
+ */
+ThrottlePolicy ToThrottlePolicy(
+    const Stroalgo::Configuration::Settings::ThrottleSettings &pSettings) {
+  ThrottlePolicy lRet{};
+  lRet.m_RatePerSecond = pSettings.m_RateLimit;
+  lRet.m_Burst = pSettings.m_RateBurst;
+  lRet.m_SampleRate = pSettings.m_SampleRate;
+  lRet.m_SuppressDuplicates = pSettings.m_SuppressDuplicates;
+  return lRet;
+}
+
+/**
+ * @brief Convert the flight recorder settings of a module
+ *
+ * @param pSettings Flight recorder settings read from the settings file
+ * @return The flight recorder options
+ */
+FlightRecorderOptions ToFlightRecorderOptions(
+    const Stroalgo::Configuration::Settings::FlightRecorderSettings
+        &pSettings) {
+  FlightRecorderOptions lRet{};
+  lRet.m_Size = pSettings.m_Size;
+  lRet.m_Level = ToLogLevel(pSettings.m_Level);
+  lRet.m_TriggerLevel = ToLogLevel(pSettings.m_Trigger);
+  lRet.m_FileBacked = pSettings.m_FileBacked;
+  return lRet;
+}
+
+}  // namespace
+
+Logger::Logger() {
+  // Register the Logger class itself
+  RegisterModule(std::string(Stroalgo::Constants::c_LoggerModuleName));
+}
+
+Logger::~Logger() {
+  DetachSettings();
+  StopFlushThread();
+  DisableAsyncMode();
+  m_Archiver.reset();
+  m_Retention.reset();
+  m_Compactor.reset();
+}
+
+ModuleLogger Logger::RegisterModule(const std::string &pModuleName,
+                                    const LogFileFormats &pFileFormats) {
+  ModuleLogger lRet{};
+  std::string lModuleName = pModuleName;
+  boost::algorithm::trim(lModuleName);
+  if (lModuleName.empty()) {
+    HandleWriteFailure(
+        "Module Name can not be an empty string or contain "
+        "whitespace,tab,newline",
+        std::string(Stroalgo::Constants::c_LoggerModuleName));
+  } else if (m_ModulesByName.find(pModuleName) == m_ModulesByName.end() &&
+             m_Modules.size() == ModuleLevelTable::c_Capacity) {
+    HandleWriteFailure("Unable to register module {} : Too many modules",
+                       pModuleName);
+  } else if (m_ModulesByName.find(pModuleName) == m_ModulesByName.end() &&
+             spdlog::get(pModuleName) == nullptr) {
+    // Console LOG (sinks share the fields rendered once per message)
+    // Bytes written by each formatted sink, reported by GetStats
+    std::vector<std::pair<std::string, std::shared_ptr<ByteCounter>>>
+        lSinkBytes{};
+    std::vector<spdlog::sink_ptr> lSinks{};
+    if (pFileFormats.m_Console) {
+      lSinkBytes.emplace_back("console", std::make_shared<ByteCounter>(0));
+      auto lConsole_sink =
+          std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+      lConsole_sink->set_formatter(std::make_unique<FieldFormatter>(
+          LogFraming::Text, pFileFormats.m_ConsoleFields,
+          lSinkBytes.back().second));
+      lSinks.push_back(lConsole_sink);
+    }
+
+    // Files are written by the collector once the records are sent to it
+    const bool lWritesFiles{m_SharedSink == nullptr};
+    const std::size_t lFirstFileSink{lSinks.size()};
+
+    // Writer of the files, from the settings unless chosen by the module
+    FileWriter lWriter{pFileFormats.m_Writer};
+    if (lWriter == FileWriter::Stdio && m_Settings != nullptr) {
+      lWriter =
+          ToFileWriter(m_Settings->GetSettingModuleFileWriter(pModuleName));
+    }
+
+    // Daily files kept, the retention thread enforces the byte quotas
+    const std::uint16_t lMaxFiles{
+        m_Settings != nullptr
+            ? m_Settings->GetSettingModuleRetention(pModuleName).m_MaxDays
+            : std::uint16_t{31}};
+
+    // File LOG.txt
+    if (pFileFormats.m_Text && lWritesFiles) {
+      std::string lFilename_txt_path{std::string("Logs/") + pModuleName +
+                                     std::string("/") + pModuleName +
+                                     std::string(".txt")};
+      // Create a new Log file at 00:00 and delete it after lMaxFiles days
+      auto lFile_txt_sink{
+          MakeDailyFileSink(lFilename_txt_path, lWriter,
+                            pFileFormats.m_MappedSegmentSize, lMaxFiles)};
+      lSinkBytes.emplace_back("text", std::make_shared<ByteCounter>(0));
+      lFile_txt_sink->set_formatter(std::make_unique<FieldFormatter>(
+          LogFraming::Text, pFileFormats.m_TextFields,
+          lSinkBytes.back().second));
+      lSinks.push_back(lFile_txt_sink);
+    }
+
+    // File LOG.json
+    if (pFileFormats.m_Json && lWritesFiles) {
+      std::string lFilename_json_path{std::string("Logs/") + pModuleName +
+                                      std::string("/") + pModuleName +
+                                      std::string(".json")};
+      // Create a new Log file at 00:00 and delete it after lMaxFiles days
+      auto lFile_json_sink{
+          MakeDailyFileSink(lFilename_json_path, lWriter,
+                            pFileFormats.m_MappedSegmentSize, lMaxFiles)};
+      lSinkBytes.emplace_back("json", std::make_shared<ByteCounter>(0));
+      lFile_json_sink->set_formatter(std::make_unique<FieldFormatter>(
+          LogFraming::Json, pFileFormats.m_JsonFields,
+          lSinkBytes.back().second));
+      lSinks.push_back(lFile_json_sink);
+    }
+
+    // File LOG.slog
+    std::shared_ptr<BinaryFileSink> lFile_binary_sink{nullptr};
+    if (pFileFormats.m_Binary && lWritesFiles) {
+      // Create a new Log file at 00:00 and delete it after lMaxFiles days
+      lFile_binary_sink = std::make_shared<BinaryFileSink>(
+          std::string("Logs/") + pModuleName + std::string("/") + pModuleName +
+              std::string(".slog"),
+          pModuleName, static_cast<std::uint32_t>(m_Modules.size()),
+          lMaxFiles);
+      lSinks.push_back(lFile_binary_sink);
+    }
+
+    std::vector<spdlog::sink_ptr> lFileSinks{lSinks.begin() + lFirstFileSink,
+                                             lSinks.end()};
+    if (!lWritesFiles) {
+      lSinks.push_back(m_SharedSink);
+    }
+
+    // Flight recorder, from the settings unless sized by the module
+    std::shared_ptr<FlightRecorder> lRecorder{nullptr};
+#ifdef STROALGO_LOG_MAPPED_FILES
+    FlightRecorderOptions lRecorderOptions{pFileFormats.m_FlightRecorder};
+    if (lRecorderOptions.m_Size == 0 && m_Settings != nullptr) {
+      lRecorderOptions = ToFlightRecorderOptions(
+          m_Settings->GetSettingModuleFlightRecorder(pModuleName));
+    }
+    if (lRecorderOptions.m_Size > 0) {
+      lRecorder = std::make_shared<FlightRecorder>(
+          std::string("Logs/") + pModuleName + std::string("/") + pModuleName +
+              std::string(".flight"),
+          std::string("Logs/") + pModuleName + std::string("/") + pModuleName +
+              std::string("_flight") + std::string(c_FlightDumpExtension),
+          pModuleName, static_cast<std::uint32_t>(m_Modules.size()),
+          lRecorderOptions);
+      lSinks.push_back(lRecorder);
+    }
+#endif
+
+    // Flush policy, last sink to flush after every other sink has written
+    auto lFlush_sink = std::make_shared<FlushSink>();
+    if (m_Settings != nullptr) {
+      lFlush_sink->SetPolicy(
+          ToFlushPolicy(m_Settings->GetSettingModuleFlush(pModuleName)));
+    }
+    lSinks.push_back(lFlush_sink);
+
+    // Create Logger
+    auto lLog = std::make_shared<spdlog::logger>(pModuleName, lSinks.begin(),
+                                                 lSinks.end());
+    lFlush_sink->SetLogger(lLog.get());
+
+    // Save module context to avoid multiple call of sdplog::get
+    auto lContext = std::make_unique<ModuleContext>();
+    lContext->m_Name = pModuleName;
+    lContext->m_Id = m_Modules.size();
+    m_Levels.Register(lContext->m_Id);
+    lContext->m_Threshold = &m_Levels.Threshold(lContext->m_Id);
+    lContext->m_Level = &m_Levels.Level(lContext->m_Id);
+    lContext->m_Logger = lLog;
+    lContext->m_BinarySink = lFile_binary_sink;
+    lContext->m_FileSinks = std::move(lFileSinks);
+    lContext->m_Recorder = lRecorder;
+    if (lRecorder != nullptr) {
+      m_Levels.SetRecorderLevel(lContext->m_Id,
+                                lRecorder->GetOptions().m_Level);
+    }
+    lContext->m_FlushSink = lFlush_sink;
+    lContext->m_ActiveBackend = &m_ActiveBackend;
+    lContext->m_SinkBytes = std::move(lSinkBytes);
+    if (m_Settings != nullptr) {
+      lContext->m_Throttle.SetPolicy(
+          ToThrottlePolicy(m_Settings->GetSettingModuleThrottle(pModuleName)));
+      const auto lLevel{m_Settings->GetSettingModuleLogLevelOrDefault(
+          pModuleName)};
+      m_Levels.SetLevel(lContext->m_Id, ToLogLevel(lLevel));
+      m_Levels.SetEnabled(lContext->m_Id,
+                          m_Settings->GetSettingModuleEnabled(pModuleName));
+    }
+    m_ModulesByName.try_emplace(pModuleName, lContext.get());
+    lRet = ModuleLogger{lContext.get()};
+    {
+      std::lock_guard<std::mutex> lLock(m_FlushMutex);
+      m_Modules.push_back(std::move(lContext));
+    }
+
+    // Levels are filtered by the level table before reaching spdlog
+    lLog->set_level(spdlog::level::trace);
+
+    // Flushes are decided by the flush sink
+    lLog->flush_on(spdlog::level::off);
+    if (lFlush_sink->GetPolicy().m_Interval.count() > 0) {
+      SetModuleFlushPolicy(pModuleName, lFlush_sink->GetPolicy());
+    }
+
+    // Register Logger to enable retrieve using spdlog::get
+    spdlog::register_logger(lLog);
+  } else {
+    HandleWriteFailure("Module {} already registered", pModuleName,
+                       spdlog::level::warn);
+    lRet = GetModuleLogger(pModuleName);
+  }
+  return lRet;
+}
+
+ModuleLogger Logger::GetModuleLogger(std::string_view pModuleName) {
+  ModuleLogger lRet{};
+  auto lModule = m_ModulesByName.find(pModuleName);
+  if (lModule != m_ModulesByName.end()) {
+    lRet = ModuleLogger{lModule->second};
+  }
+  return lRet;
+}
+
+void Logger::HandleWriteFailure(
+    const spdlog::format_string_t<std::string_view> &pFormat,
+    std::string_view pModuleName, spdlog::level::level_enum pLogLevel) {
+  auto lLogger = m_ModulesByName.find(Stroalgo::Constants::c_LoggerModuleName);
+
+  if (lLogger != m_ModulesByName.end()) {
+    lLogger->second->Write<std::string_view>(pLogLevel, pFormat,
+                                             std::string_view{pModuleName});
+  } else {
+    spdlog::critical(
+        "The {} module is not registered : Logs are not saved into files",
+        Stroalgo::Constants::c_LoggerModuleName);
+  }
+}
+
+void Logger::HandleWriteFailure(std::string_view pMessage,
+                                spdlog::level::level_enum pLogLevel) {
+  HandleWriteFailure("{}", pMessage, pLogLevel);
+}
+
+void Logger::ApplySettings(
+    const Stroalgo::Configuration::Settings &pSettings) {
+  if (m_Settings != &pSettings) {
+    DetachSettings();
+    m_Settings = &pSettings;
+    m_SettingsListener = pSettings.AddReloadListener(
+        [this](const Stroalgo::Configuration::Settings &pReloaded) {
+          for (const auto &lModule : m_ModulesByName) {
+            ApplyModuleSettings(*lModule.second, pReloaded);
+          }
+          ApplyRetentionSettings(pReloaded);
+        });
+  }
+  for (const auto &lModule : m_ModulesByName) {
+    ApplyModuleSettings(*lModule.second, pSettings);
+  }
+  ApplyRetentionSettings(pSettings);
+}
+
+void Logger::DetachSettings() {
+  if (m_Settings != nullptr) {
+    m_Settings->RemoveReloadListener(m_SettingsListener);
+    m_Settings = nullptr;
+  }
+}
+
+void Logger::ApplyRetentionSettings(
+    const Stroalgo::Configuration::Settings &pSettings) {
+  const auto &lRetention{pSettings.GetSettingRetention()};
+  RetentionOptions lOptions{};
+  lOptions.m_Interval = std::chrono::milliseconds{lRetention.m_IntervalMs};
+  lOptions.m_MaxDays = lRetention.m_MaxDays;
+  lOptions.m_MaxBytes = lRetention.m_MaxBytes;
+  lOptions.m_MinFreeBytes = lRetention.m_MinFreeBytes;
+  lOptions.m_TargetFreeBytes = lRetention.m_TargetFreeBytes;
+  lOptions.m_Compress = lRetention.m_Compress;
+  lOptions.m_IoRate = lRetention.m_IoRate;
+  bool lHasQuota{lOptions.m_MaxBytes > 0 || lOptions.m_MinFreeBytes > 0};
+  for (const auto &lModule : m_ModulesByName) {
+    const auto lModuleRetention{
+        pSettings.GetSettingModuleRetention(lModule.first)};
+    lOptions.m_Modules.try_emplace(lModule.first,
+                                   ModuleRetention{lModuleRetention.m_MaxBytes,
+                                                   lModuleRetention.m_MaxDays});
+    lHasQuota = lHasQuota || lModuleRetention.m_MaxBytes > 0;
+  }
+
+  // Without quota the daily sinks remove the expired files themselves
+  if (lHasQuota) {
+    EnableRetention(lOptions);
+  } else {
+    DisableRetention();
+  }
+}
+
+void Logger::ApplyModuleSettings(
+    ModuleContext &pContext,
+    const Stroalgo::Configuration::Settings &pSettings) {
+  SetModuleFlushPolicy(
+      pContext.m_Name,
+      ToFlushPolicy(pSettings.GetSettingModuleFlush(pContext.m_Name)));
+  pContext.m_Throttle.SetPolicy(
+      ToThrottlePolicy(pSettings.GetSettingModuleThrottle(pContext.m_Name)));
+  m_Levels.SetLevel(pContext.m_Id,
+                    ToLogLevel(pSettings.GetSettingModuleLogLevelOrDefault(
+                        pContext.m_Name)));
+  m_Levels.SetEnabled(pContext.m_Id,
+                      pSettings.GetSettingModuleEnabled(pContext.m_Name));
+
+  // The ring is sized at registration, only its level follows the settings
+  const auto &lRecorder{
+      pSettings.GetSettingModuleFlightRecorder(pContext.m_Name)};
+  if (pContext.m_Recorder != nullptr && lRecorder.m_Size > 0) {
+    m_Levels.SetRecorderLevel(pContext.m_Id, ToLogLevel(lRecorder.m_Level));
+  }
+}
+
+void Logger::SetModuleFlushPolicy(const std::string &pModuleName,
+                                  const FlushPolicy &pPolicy) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Set policy if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    lModule->second->m_FlushSink->SetPolicy(pPolicy);
+
+    // Pending records are flushed by the flush thread after the interval
+    std::lock_guard<std::mutex> lLock(m_FlushMutex);
+    if (pPolicy.m_Interval.count() > 0 && !m_FlushThread.joinable()) {
+      m_FlushThreadStop = false;
+      m_FlushThread = std::thread([this]() { RunFlushThread(); });
+    }
+  } else {
+    HandleWriteFailure(
+        "Unable to set flush policy : Module {} is not registered",
+        pModuleName);
+  }
+}
+
+void Logger::SetModuleThrottlePolicy(const std::string &pModuleName,
+                                     const ThrottlePolicy &pPolicy) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Set policy if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    lModule->second->FlushRepeats();
+    lModule->second->m_Throttle.SetPolicy(pPolicy);
+  } else {
+    HandleWriteFailure(
+        "Unable to set throttle policy : Module {} is not registered",
+        pModuleName);
+  }
+}
+
+ThrottleCounters Logger::GetModuleThrottleCounters(
+    const std::string &pModuleName) {
+  ThrottleCounters lRet{};
+  auto lModule = m_ModulesByName.find(pModuleName);
+  if (lModule != m_ModulesByName.end()) {
+    lRet = lModule->second->m_Throttle.GetCounters();
+  } else {
+    HandleWriteFailure(
+        "Unable to get throttle counters : Module {} is not registered",
+        pModuleName);
+  }
+  return lRet;
+}
+
+ModuleStats Logger::GetModuleStats(const std::string &pModuleName) {
+  ModuleStats lRet{};
+  auto lModule = m_ModulesByName.find(pModuleName);
+  if (lModule != m_ModulesByName.end()) {
+    lRet = CollectStats(*lModule->second);
+  } else {
+    HandleWriteFailure("Unable to get stats : Module {} is not registered",
+                       pModuleName);
+  }
+  return lRet;
+}
+
+LoggerStats Logger::GetStats() {
+  LoggerStats lRet{};
+  for (const auto &lModule : m_ModulesByName) {
+    lRet.m_Modules.try_emplace(lModule.first, CollectStats(*lModule.second));
+  }
+  lRet.m_AsyncEnabled = IsAsyncModeEnabled();
+  lRet.m_Async = GetAsyncCounters();
+  if (m_SharedSink != nullptr) {
+    lRet.m_SharedTransportEnabled = true;
+    lRet.m_SharedWritten = m_SharedSink->GetWrittenRecords();
+    lRet.m_SharedDropped = m_SharedSink->GetDroppedRecords();
+  }
+  return lRet;
+}
+
+ModuleStats Logger::CollectStats(const ModuleContext &pModule) const {
+  ModuleStats lRet{};
+  lRet.m_Accepted =
+      pModule.m_Counters.m_Accepted.load(std::memory_order_relaxed);
+  lRet.m_Throttle = pModule.m_Throttle.GetCounters();
+  lRet.m_QueueDropped =
+      pModule.m_Counters.m_QueueDropped.load(std::memory_order_relaxed);
+  lRet.m_Dropped = lRet.m_Throttle.m_RateLimited + lRet.m_Throttle.m_Sampled +
+                   lRet.m_Throttle.m_Duplicates + lRet.m_QueueDropped;
+  lRet.m_Written = pModule.m_FlushSink->GetWrittenRecords();
+  lRet.m_FlushDurations = pModule.m_FlushSink->GetFlushDurations();
+  lRet.m_Flushes = lRet.m_FlushDurations.m_Count;
+  for (const auto &lSink : pModule.m_SinkBytes) {
+    lRet.m_BytesWritten.try_emplace(
+        lSink.first, lSink.second->load(std::memory_order_relaxed));
+  }
+  if (pModule.m_BinarySink != nullptr) {
+    lRet.m_BytesWritten.try_emplace("binary",
+                                    pModule.m_BinarySink->GetWrittenBytes());
+  }
+  if (pModule.m_Recorder != nullptr) {
+    lRet.m_Recorded = pModule.m_Recorder->GetRecordedRecords();
+    lRet.m_RecorderDumps = pModule.m_Recorder->GetDumps();
+  }
+  return lRet;
+}
+
+void Logger::RunFlushThread() {
+  // Upper bound of the wait when no module uses an interval anymore
+  constexpr std::chrono::milliseconds lMaxWait{100};
+
+  std::unique_lock<std::mutex> lLock(m_FlushMutex);
+  while (!m_FlushThreadStop) {
+    std::chrono::milliseconds lWait{lMaxWait};
+    for (const auto &lModule : m_Modules) {
+      lModule->m_FlushSink->FlushIfDue();
+      const auto lInterval{lModule->m_FlushSink->GetPolicy().m_Interval};
+      if (lInterval.count() > 0 && lInterval < lWait) {
+        lWait = lInterval;
+      }
+    }
+    m_FlushCondition.wait_for(lLock, lWait);
+  }
+}
+
+void Logger::StopFlushThread() {
+  {
+    std::lock_guard<std::mutex> lLock(m_FlushMutex);
+    m_FlushThreadStop = true;
+  }
+  m_FlushCondition.notify_all();
+  if (m_FlushThread.joinable()) {
+    m_FlushThread.join();
+  }
+}
+
+void Logger::EnableSharedTransport(const SharedTransportOptions &pOptions) {
+#ifdef STROALGO_LOG_SHARED_MEMORY
+  if (m_SharedSink != nullptr) {
+    HandleWriteFailure("Shared transport already enabled as {}",
+                       m_SharedSink->GetSegmentName(), spdlog::level::warn);
+    return;
+  }
+  try {
+    m_SharedSink = std::make_shared<SharedLogSink>(pOptions);
+  } catch (const spdlog::spdlog_ex &lException) {
+    HandleWriteFailure("Unable to enable shared transport : {}",
+                       lException.what());
+    return;
+  }
+
+  // Records written until now stay in the files, the next ones go to the
+  // ring in front of the flight recorder and of the flush sink
+  std::lock_guard<std::mutex> lLock(m_FlushMutex);
+  for (const auto &lModule : m_Modules) {
+    auto &lSinks{lModule->m_Logger->sinks()};
+    for (const auto &lFileSink : lModule->m_FileSinks) {
+      lFileSink->flush();
+      lSinks.erase(std::find(lSinks.begin(), lSinks.end(), lFileSink));
+    }
+    const auto lPosition{std::find_if(
+        lSinks.begin(), lSinks.end(),
+        [&lModule](const spdlog::sink_ptr &pSink) {
+          return pSink == lModule->m_Recorder || pSink == lModule->m_FlushSink;
+        })};
+    lSinks.insert(lPosition, m_SharedSink);
+    lModule->m_FileSinks.clear();
+    lModule->m_BinarySink = nullptr;
+  }
+#else
+  HandleWriteFailure(
+      "Unable to enable shared transport {} : not supported on this platform",
+      pOptions.m_Name);
+#endif
+}
+
+void Logger::WriteForwardedRecord(const SharedLogRecord &pRecord) {
+  auto lModule = m_ModulesByName.find(pRecord.m_ModuleName);
+  if (lModule == m_ModulesByName.end()) {
+    HandleWriteFailure(
+        "Unable to write forwarded record : Module {} is not registered",
+        pRecord.m_ModuleName);
+    return;
+  }
+
+  // The level table of the collector can filter the records further
+  ModuleContext &lContext{*lModule->second};
+  if (!lContext.ShouldLog(pRecord.m_Level)) {
+    return;
+  }
+  lContext.m_Counters.m_Accepted.fetch_add(1, std::memory_order_relaxed);
+  spdlog::details::log_msg lMsg{
+      pRecord.m_Time,
+      pRecord.m_Structured ? StructuredSource() : spdlog::source_loc{},
+      lContext.m_Logger->name(), pRecord.m_Level,
+      spdlog::string_view_t{pRecord.m_Payload.data(),
+                            pRecord.m_Payload.size()}};
+  lMsg.thread_id = pRecord.m_ThreadId;
+  try {
+    for (const auto &lSink : lContext.m_Logger->sinks()) {
+      if (lSink->should_log(lMsg.level)) {
+        lSink->log(lMsg);
+      }
+    }
+  } catch (const std::exception &lException) {
+    HandleWriteFailure("Unable to write forwarded record : {}",
+                       lException.what());
+  }
+}
+
+std::size_t Logger::DumpFlightRecorder(const std::string &pModuleName) {
+  std::size_t lRet{0};
+  auto lModule = m_ModulesByName.find(pModuleName);
+  if (lModule == m_ModulesByName.end()) {
+    HandleWriteFailure(
+        "Unable to dump flight recorder : Module {} is not registered",
+        pModuleName);
+  } else if (lModule->second->m_Recorder != nullptr) {
+    lRet = lModule->second->m_Recorder->Dump();
+  }
+  return lRet;
+}
+
+void Logger::SetModuleLogLevel(const std::string &pModuleName,
+                               const spdlog::level::level_enum pLogLevel) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Set level if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    m_Levels.SetLevel(lModule->second->m_Id, pLogLevel);
+  } else {
+    HandleWriteFailure("Unable to set level : Module {} is not registered",
+                       pModuleName);
+  }
+}
+
+void Logger::SetModuleEnabled(const std::string &pModuleName, bool pEnabled) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Enable or disable the module if it is registered
+  if (lModule != m_ModulesByName.end()) {
+    m_Levels.SetEnabled(lModule->second->m_Id, pEnabled);
+  } else {
+    HandleWriteFailure("Unable to enable : Module {} is not registered",
+                       pModuleName);
+  }
+}
+
+bool Logger::IsModuleEnabled(const std::string &pModuleName) {
+  auto lModule = m_ModulesByName.find(pModuleName);
+  return lModule != m_ModulesByName.end() &&
+         m_Levels.IsEnabled(lModule->second->m_Id);
+}
+
+const std::string Logger::GetModuleLevel(const std::string &pModuleName) {
+  std::string lRet{};
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Get level if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    lRet = LogLevelTostring(m_Levels.GetLevel(lModule->second->m_Id));
+  } else {
+    HandleWriteFailure("Unable to get level : Module {} is not registered",
+                       pModuleName);
+  }
+  return lRet;
+}
+
+const std::string Logger::LogLevelTostring(
+    const spdlog::level::level_enum pLogLevel) {
+  std::string lRet{};
+  switch (pLogLevel) {
+    case spdlog::level::trace:
+      lRet = "trace";
+      break;
+    case spdlog::level::debug:
+      lRet = "debug";
+      break;
+    case spdlog::level::info:
+      lRet = "info";
+      break;
+    case spdlog::level::warn:
+      lRet = "warning";
+      break;
+    case spdlog::level::err:
+      lRet = "error";
+      break;
+    case spdlog::level::critical:
+      lRet = "critical";
+      break;
+    default:
+      lRet = "";
+      break;
+  }
+  return lRet;
+}
+
+const std::map<std::string, std::string> Logger::GetLogLevels() {
+  std::map<std::string, std::string> lRet{};
+  std::for_each(
+      m_Modules.cbegin(), m_Modules.cend(), [&lRet, this](const auto &pModule) {
+        lRet.try_emplace(pModule->m_Name,
+                         LogLevelTostring(m_Levels.GetLevel(pModule->m_Id)));
+      });
+  return lRet;
+}
+
+void Logger::ShutDown() {
+  StopFlushThread();
+  DisableAsyncMode();
+  m_Archiver.reset();
+  m_Retention.reset();
+  m_Compactor.reset();
+  spdlog::drop_all();
+  spdlog::shutdown();
+}
+
+void Logger::EnableAsyncMode(const AsyncOptions &pOptions) {
+  if (m_ActiveBackend.load(std::memory_order_acquire) != nullptr) {
+    HandleWriteFailure("Asynchronous mode already enabled");
+  } else {
+    m_AsyncBackend = std::make_unique<AsyncBackend>(pOptions);
+    m_ActiveBackend.store(m_AsyncBackend.get(), std::memory_order_release);
+  }
+}
+
+void Logger::EnableArchiving(const ArchiveOptions &pOptions) {
+  if (m_Archiver != nullptr) {
+    HandleWriteFailure("Archiving already enabled");
+  } else {
+    m_Archiver = std::make_unique<LogArchiver>("Logs", pOptions);
+    m_Archiver->Wake();
+  }
+}
+
+void Logger::DisableArchiving() { m_Archiver.reset(); }
+
+void Logger::EnableRetention(const RetentionOptions &pOptions) {
+  if (m_Retention != nullptr) {
+    m_Retention->SetOptions(pOptions);
+  } else {
+    m_Retention = std::make_unique<LogRetention>("Logs", pOptions);
+    m_Retention->Wake();
+  }
+}
+
+void Logger::DisableRetention() { m_Retention.reset(); }
+
+RetentionCounters Logger::GetRetentionCounters() const {
+  RetentionCounters lRet{};
+  if (m_Retention != nullptr) {
+    lRet = m_Retention->GetCounters();
+  }
+  return lRet;
+}
+
+void Logger::DisableAsyncMode() {
+  AsyncBackend *lBackend{
+      m_ActiveBackend.exchange(nullptr, std::memory_order_acq_rel)};
+  if (lBackend != nullptr) {
+    // Backend is kept alive to report its counters
+    lBackend->Stop();
+  }
+}
+
+AsyncCounters Logger::GetAsyncCounters() const {
+  AsyncCounters lRet{};
+  if (m_AsyncBackend != nullptr) {
+    lRet = m_AsyncBackend->GetCounters();
+  }
+  return lRet;
+}
+
+void Logger::Flush() {
+  // Repeats of the last messages are written before being flushed
+  std::for_each(m_Modules.cbegin(), m_Modules.cend(),
+                [](const auto &pModule) { pModule->FlushRepeats(); });
+  AsyncBackend *lBackend{m_ActiveBackend.load(std::memory_order_acquire)};
+  if (lBackend != nullptr) {
+    lBackend->Drain();
+  }
+  std::for_each(
+      m_Modules.cbegin(), m_Modules.cend(),
+      [](const auto &pModule) { pModule->m_Logger->flush(); });
+}
+
+void Logger::DeleteAllLogs() {
+  std::for_each(m_Modules.cbegin(), m_Modules.cend(),
+                [this](const auto &pModule) { DeleteLogs(*pModule); });
+}
+
+void Logger::DeleteAllModuleLogs(const std::string &pModuleName) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Delete logs if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    DeleteLogs(*lModule->second);
+  } else {
+    HandleWriteFailure("Unable to delete logs : Module {} is not registered",
+                       pModuleName);
+    throw Stroalgo::Exceptions::LoggerException(fmt::format(
+        "Unable to delete logs : Module {} is not registered", pModuleName));
+  }
+}
+
+void Logger::DeleteLogsInRange(spdlog::log_clock::time_point pStart,
+                               spdlog::log_clock::time_point pEnd,
+                               std::uint8_t pLevels) {
+  std::for_each(m_Modules.cbegin(), m_Modules.cend(),
+                [&](const auto &pModule) {
+                  DeleteLogsInRange(*pModule, pStart, pEnd, pLevels);
+                });
+}
+
+void Logger::DeleteModuleLogsInRange(const std::string &pModuleName,
+                                     spdlog::log_clock::time_point pStart,
+                                     spdlog::log_clock::time_point pEnd,
+                                     std::uint8_t pLevels) {
+  // Find the logger related to module
+  auto lModule = m_ModulesByName.find(pModuleName);
+
+  // Delete logs if Module is registered
+  if (lModule != m_ModulesByName.end()) {
+    DeleteLogsInRange(*lModule->second, pStart, pEnd, pLevels);
+  } else {
+    HandleWriteFailure("Unable to delete logs : Module {} is not registered",
+                       pModuleName);
+    throw Stroalgo::Exceptions::LoggerException(fmt::format(
+        "Unable to delete logs : Module {} is not registered", pModuleName));
+  }
+}
+
+std::string Logger::CurrentDateToString() {
+  return std::string{CurrentLocalDate().View()};
+}
+
+void Logger::DeleteLogs(const ModuleContext &pModule) {
+  const std::string &lModuleName{pModule.m_Name};
+  std::list<std::string> lListOfPath{};
+  for (const auto &lFilePath :
+       std::filesystem::directory_iterator{"Logs/" + lModuleName}) {
+    lListOfPath.push_back(lFilePath.path().string());
+  }
+
+#if defined(STROALGO_LOG_MAPPED_FILES) || defined(STROALGO_LOG_IO_URING)
+  // Mapped and io_uring files are emptied by their sink, which keeps their
+  // segment mapped or their write offset
+  for (const auto &lSink : pModule.m_Logger->sinks()) {
+#ifdef STROALGO_LOG_MAPPED_FILES
+    if (auto *lMapped{dynamic_cast<MappedFileSink *>(lSink.get())};
+        lMapped != nullptr) {
+      lListOfPath.remove(lMapped->GetFilename());
+      lMapped->Truncate();
+    }
+#endif
+#ifdef STROALGO_LOG_IO_URING
+    if (auto *lUring{dynamic_cast<UringFileSink *>(lSink.get())};
+        lUring != nullptr) {
+      lListOfPath.remove(lUring->GetFilename());
+      lUring->Truncate();
+    }
+#endif
+  }
+#endif
+
+  // Clear the content of current used logfile, if not already done by its sink
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/" << lModuleName << "/" << lModuleName << "_"
+               << CurrentDateToString() << ".txt";
+  if (std::find(lListOfPath.begin(), lListOfPath.end(),
+                lLogFilePath.str()) != lListOfPath.end()) {
+    lListOfPath.remove(lLogFilePath.str());
+    std::fstream lFileStreamTxt{};
+    lFileStreamTxt.open(lLogFilePath.str(),
+                        std::ofstream::out | std::ofstream::trunc);
+    lFileStreamTxt.close();
+  }
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/" << lModuleName << "/" << lModuleName << "_"
+               << CurrentDateToString() << ".json";
+  if (std::find(lListOfPath.begin(), lListOfPath.end(),
+                lLogFilePath.str()) != lListOfPath.end()) {
+    lListOfPath.remove(lLogFilePath.str());
+    std::fstream lFileStreamJson{};
+    lFileStreamJson.open(lLogFilePath.str(),
+                         std::ofstream::out | std::ofstream::trunc);
+    lFileStreamJson.close();
+  }
+
+  // Binary file and its index are emptied by its sink which writes its header
+  // again
+  if (pModule.m_BinarySink != nullptr) {
+    const std::string lBinaryFile{pModule.m_BinarySink->GetFilename()};
+    lListOfPath.remove(lBinaryFile);
+    lListOfPath.remove(GetBinaryIndexFilename(lBinaryFile));
+    pModule.m_BinarySink->Truncate();
+  }
+
+  // Delete all logs files except the current log file
+  for (const auto &lFilePath : lListOfPath) {
+    std::filesystem::remove(lFilePath);
+  }
+}
+
+void Logger::DeleteLogsInRange(const ModuleContext &pModule,
+                               spdlog::log_clock::time_point pStart,
+                               spdlog::log_clock::time_point pEnd,
+                               std::uint8_t pLevels) {
+  const std::string &lModuleName{pModule.m_Name};
+  const std::string lStartDate{ToLocalDate(pStart)};
+  const std::string lEndDate{ToLocalDate(pEnd)};
+  const std::string lToday{CurrentDateToString()};
+  BinaryLogTombstone lTombstone{};
+  lTombstone.m_Start = ToBinaryTime(pStart);
+  lTombstone.m_End = ToBinaryTime(pEnd);
+  lTombstone.m_Levels = pLevels;
+
+  std::error_code lError{};
+  bool lTombstoneAdded{false};
+  for (const auto &lFilePath :
+       std::filesystem::directory_iterator{"Logs/" + lModuleName, lError}) {
+    // Files are named <module>_<yyyy-mm-dd>.<extension>, archives have the
+    // name of the file they hold followed by their own extension
+    const std::filesystem::path lLogFile{GetArchivedLogPath(lFilePath.path())};
+    const std::string lExtension{lLogFile.extension().string()};
+    const std::string lDate{GetLogFileDate(lLogFile)};
+    if (lDate.empty() || lDate < lStartDate || lDate > lEndDate) {
+      continue;
+    }
+
+    if (lExtension == ".slog") {
+      try {
+        AddBinaryTombstone(lFilePath.path().string(), lTombstone);
+        lTombstoneAdded = true;
+      } catch (const spdlog::spdlog_ex &lException) {
+        HandleWriteFailure("Unable to delete logs : {}", lException.what());
+      }
+    } else if ((lExtension == ".txt" || lExtension == ".json") &&
+               pLevels == c_AllLevelsMask && lDate != lToday &&
+               lDate > lStartDate && lDate < lEndDate) {
+      // Records of a text file can not be told apart, the whole day goes
+      std::filesystem::remove(lFilePath.path(), lError);
+    }
+  }
+
+  if (lTombstoneAdded) {
+    if (m_Compactor == nullptr) {
+      m_Compactor = std::make_unique<LogCompactor>("Logs");
+    }
+    m_Compactor->Wake();
+  }
+}
+
+}  // namespace Stroalgo::Log
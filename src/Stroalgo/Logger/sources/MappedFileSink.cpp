@@ -0,0 +1,229 @@
+/**
+ * @file MappedFileSink.cpp
+ * @brief spdlog sink writing daily log files through memory mapped segments
+ * @details Uses POSIX fallocate and mmap
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "MappedFileSink.h"
+
+#include <fcntl.h>
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Round a segment size up to the page size
+ *
+ * @param pSize Requested size
+ * @return Size multiple of the page size, at least one page
+ */
+std::size_t RoundToPages(std::size_t pSize) {
+  const auto lPage{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+  return std::max<std::size_t>(1, (pSize + lPage - 1) / lPage) * lPage;
+}
+
+/**
+ * @brief Find the end of the data of a file, log files never hold a zero byte
+ * so the preallocated end left by a crash is skipped
+ *
+ * @param pFile Descriptor of the file
+ * @return Offset following the last non zero byte
+ */
+std::size_t FindDataEnd(int pFile) {
+  struct stat lStat {};
+  if (::fstat(pFile, &lStat) != 0) {
+    return 0;
+  }
+
+  std::array<char, 4096> lChunk{};
+  auto lEnd{static_cast<std::size_t>(lStat.st_size)};
+  while (lEnd > 0) {
+    const std::size_t lSize{std::min(lEnd, lChunk.size())};
+    const ::ssize_t lRead{::pread(pFile, lChunk.data(), lSize,
+                                  static_cast<::off_t>(lEnd - lSize))};
+    if (lRead != static_cast<::ssize_t>(lSize)) {
+      break;
+    }
+    for (std::size_t lByte = lSize; lByte > 0; --lByte) {
+      if (lChunk[lByte - 1] != '\0') {
+        return lEnd - lSize + lByte;
+      }
+    }
+    lEnd -= lSize;
+  }
+  return lEnd;
+}
+
+}  // namespace
+
+MappedFileSink::MappedFileSink(const std::string &pBaseFilename,
+                               std::size_t pSegmentSize,
+                               std::uint16_t pMaxFiles)
+    : m_BaseFilename(pBaseFilename),
+      m_SegmentSize(RoundToPages(pSegmentSize)),
+      m_MaxFiles(pMaxFiles) {
+  RotateIfNeeded(spdlog::log_clock::now());
+}
+
+MappedFileSink::~MappedFileSink() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  Close();
+}
+
+void MappedFileSink::Truncate() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  if (m_File < 0) {
+    return;
+  }
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, m_SegmentSize);
+    m_Mapping = nullptr;
+  }
+  m_Segment = 0;
+  m_Offset = 0;
+  if (::ftruncate(m_File, 0) != 0) {
+    spdlog::throw_spdlog_ex("Failed truncating file " + m_Filename, errno);
+  }
+  MapSegment(0);
+}
+
+std::string MappedFileSink::GetFilename() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  return m_Filename;
+}
+
+void MappedFileSink::sink_it_(const spdlog::details::log_msg &pMsg) {
+  RotateIfNeeded(pMsg.time);
+  m_Buffer.clear();
+  formatter_->format(pMsg, m_Buffer);
+  Write(m_Buffer.data(), m_Buffer.size());
+}
+
+void MappedFileSink::Write(const char *pData, std::size_t pSize) {
+  while (pSize > 0) {
+    // Next segment once the mapped one is full
+    if (m_Mapping == nullptr || m_Offset == m_SegmentSize) {
+      MapSegment(m_Mapping == nullptr ? m_Segment : m_Segment + 1);
+    }
+    const std::size_t lCount{std::min(pSize, m_SegmentSize - m_Offset)};
+    std::memcpy(m_Mapping + m_Offset, pData, lCount);
+    m_Offset += lCount;
+    pData += lCount;
+    pSize -= lCount;
+  }
+}
+
+void MappedFileSink::RotateIfNeeded(spdlog::log_clock::time_point pTime) {
+  if (pTime < m_NextRotation) {
+    return;
+  }
+
+  const std::time_t lTime{spdlog::log_clock::to_time_t(pTime)};
+  std::tm lDate{spdlog::details::os::localtime(lTime)};
+  Open(spdlog::sinks::daily_filename_calculator::calc_filename(m_BaseFilename,
+                                                               lDate));
+
+  // Remove the file leaving the retention window
+  if (m_MaxFiles > 0) {
+    std::tm lExpired{lDate};
+    lExpired.tm_mday -= m_MaxFiles;
+    std::mktime(&lExpired);
+    std::error_code lError{};
+    std::filesystem::remove(
+        spdlog::sinks::daily_filename_calculator::calc_filename(m_BaseFilename,
+                                                                lExpired),
+        lError);
+  }
+
+  // Next file is opened at 00:00
+  lDate.tm_hour = 0;
+  lDate.tm_min = 0;
+  lDate.tm_sec = 0;
+  lDate.tm_mday += 1;
+  m_NextRotation = spdlog::log_clock::from_time_t(std::mktime(&lDate));
+}
+
+void MappedFileSink::Open(const std::string &pFilename) {
+  Close();
+  spdlog::details::os::create_dir(spdlog::details::os::dir_name(pFilename));
+  m_Filename = pFilename;
+  m_File = ::open(pFilename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (m_File < 0) {
+    spdlog::throw_spdlog_ex("Failed opening file " + pFilename, errno);
+  }
+
+  // Continue after the data already written today
+  const std::size_t lEnd{FindDataEnd(m_File)};
+  m_Segment = lEnd / m_SegmentSize;
+  m_Offset = lEnd % m_SegmentSize;
+  MapSegment(m_Segment);
+}
+
+void MappedFileSink::Close() {
+  if (m_File < 0) {
+    return;
+  }
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, m_SegmentSize);
+    m_Mapping = nullptr;
+  }
+
+  // Drop the preallocated bytes never written
+  [[maybe_unused]] const int lResult{
+      ::ftruncate(m_File, static_cast<::off_t>(WrittenSize()))};
+  ::close(m_File);
+  m_File = -1;
+  m_Segment = 0;
+  m_Offset = 0;
+}
+
+void MappedFileSink::MapSegment(std::size_t pSegment) {
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, m_SegmentSize);
+    m_Mapping = nullptr;
+  }
+  if (m_File < 0) {
+    spdlog::throw_spdlog_ex("No file opened for " + m_BaseFilename);
+  }
+
+  // Reserve the blocks of the segment, sparse file if not supported
+  const auto lOffset{static_cast<::off_t>(pSegment * m_SegmentSize)};
+  const auto lSize{static_cast<::off_t>(m_SegmentSize)};
+  if (::fallocate(m_File, 0, lOffset, lSize) != 0) {
+    struct stat lStat {};
+    if (::fstat(m_File, &lStat) != 0 ||
+        (lStat.st_size < lOffset + lSize &&
+         ::ftruncate(m_File, lOffset + lSize) != 0)) {
+      spdlog::throw_spdlog_ex("Failed allocating segment of " + m_Filename,
+                              errno);
+    }
+  }
+
+  void *lMapping{::mmap(nullptr, m_SegmentSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, m_File, lOffset)};
+  if (lMapping == MAP_FAILED) {
+    spdlog::throw_spdlog_ex("Failed mapping segment of " + m_Filename, errno);
+  }
+  m_Mapping = static_cast<char *>(lMapping);
+  if (pSegment != m_Segment) {
+    m_Segment = pSegment;
+    m_Offset = 0;
+  }
+}
+
+}  // namespace Stroalgo::Log
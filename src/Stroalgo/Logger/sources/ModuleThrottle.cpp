@@ -0,0 +1,144 @@
+/**
+ * @file ModuleThrottle.cpp
+ * @brief Rate limit, sampling and duplicate suppression of a module
+ * @details Uses the steady clock and a xorshift64* generator
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "ModuleThrottle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Current steady time
+ *
+ * @return Nanoseconds
+ */
+std::int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+void ModuleThrottle::SetPolicy(const ThrottlePolicy &pPolicy) {
+  // Sampled records are those drawing above the threshold
+  const double lSampleRate{std::clamp(pPolicy.m_SampleRate, 0.0, 1.0)};
+  const std::uint64_t lThreshold{
+      lSampleRate >= 1.0
+          ? std::numeric_limits<std::uint64_t>::max()
+          : static_cast<std::uint64_t>(std::ldexp(lSampleRate, 64))};
+
+  std::int64_t lInterval{0};
+  std::int64_t lTolerance{0};
+  if (pPolicy.m_RatePerSecond > 0) {
+    lInterval = std::max<std::int64_t>(
+        static_cast<std::int64_t>(1e9 / pPolicy.m_RatePerSecond), 1);
+    const double lBurst{pPolicy.m_Burst > 0
+                            ? static_cast<double>(pPolicy.m_Burst)
+                            : std::max(pPolicy.m_RatePerSecond, 1.0)};
+    lTolerance = static_cast<std::int64_t>(
+        static_cast<double>(lInterval) * (std::floor(lBurst) - 1));
+  }
+
+  m_SampleThreshold.store(lThreshold, std::memory_order_relaxed);
+  m_ToleranceNs.store(lTolerance, std::memory_order_relaxed);
+  m_IntervalNs.store(lInterval, std::memory_order_relaxed);
+  m_TheoreticalArrival.store(0, std::memory_order_relaxed);
+  m_SuppressDuplicates.store(pPolicy.m_SuppressDuplicates,
+                             std::memory_order_relaxed);
+  m_Enabled.store(lThreshold != std::numeric_limits<std::uint64_t>::max() ||
+                      lInterval > 0 || pPolicy.m_SuppressDuplicates,
+                  std::memory_order_relaxed);
+}
+
+ThrottlePolicy ModuleThrottle::GetPolicy() const {
+  ThrottlePolicy lRet{};
+  const std::uint64_t lThreshold{
+      m_SampleThreshold.load(std::memory_order_relaxed)};
+  lRet.m_SampleRate =
+      lThreshold == std::numeric_limits<std::uint64_t>::max()
+          ? 1.0
+          : std::ldexp(static_cast<double>(lThreshold), -64);
+  const std::int64_t lInterval{m_IntervalNs.load(std::memory_order_relaxed)};
+  if (lInterval > 0) {
+    lRet.m_RatePerSecond = 1e9 / static_cast<double>(lInterval);
+    lRet.m_Burst = static_cast<std::uint32_t>(
+        m_ToleranceNs.load(std::memory_order_relaxed) / lInterval + 1);
+  }
+  lRet.m_SuppressDuplicates =
+      m_SuppressDuplicates.load(std::memory_order_relaxed);
+  return lRet;
+}
+
+ThrottleCounters ModuleThrottle::GetCounters() const {
+  ThrottleCounters lRet{};
+  lRet.m_RateLimited = m_RateLimited.load(std::memory_order_relaxed);
+  lRet.m_Sampled = m_Sampled.load(std::memory_order_relaxed);
+  lRet.m_Duplicates = m_Duplicates.load(std::memory_order_relaxed);
+  return lRet;
+}
+
+bool ModuleThrottle::AdmitMessage(spdlog::level::level_enum pLogLevel,
+                                  std::string_view pMessage,
+                                  std::uint64_t &pRepeats,
+                                  spdlog::level::level_enum &pRepeatLevel) {
+  std::lock_guard<std::mutex> lLock(m_DuplicateMutex);
+  if (pLogLevel == m_LastLevel && pMessage == m_LastMessage) {
+    ++m_Repeats;
+    m_Duplicates.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  pRepeats = m_Repeats;
+  pRepeatLevel = m_LastLevel;
+  m_Repeats = 0;
+  m_LastLevel = pLogLevel;
+  m_LastMessage.assign(pMessage);
+  return true;
+}
+
+std::uint64_t ModuleThrottle::TakeRepeats(
+    spdlog::level::level_enum &pRepeatLevel) {
+  std::lock_guard<std::mutex> lLock(m_DuplicateMutex);
+  const std::uint64_t lRet{m_Repeats};
+  pRepeatLevel = m_LastLevel;
+  m_Repeats = 0;
+  return lRet;
+}
+
+bool ModuleThrottle::AdmitRate(std::int64_t pInterval) {
+  // Admitted while the arrival time stays within the burst tolerance
+  const std::int64_t lNow{Now()};
+  const std::int64_t lTolerance{m_ToleranceNs.load(std::memory_order_relaxed)};
+  std::int64_t lArrival{m_TheoreticalArrival.load(std::memory_order_relaxed)};
+  std::int64_t lNext{0};
+  do {
+    const std::int64_t lStart{std::max(lArrival, lNow)};
+    if (lStart - lNow > lTolerance) {
+      return false;
+    }
+    lNext = lStart + pInterval;
+  } while (!m_TheoreticalArrival.compare_exchange_weak(
+      lArrival, lNext, std::memory_order_relaxed));
+  return true;
+}
+
+std::uint64_t ModuleThrottle::NextRandom() {
+  thread_local std::uint64_t lState{
+      (static_cast<std::uint64_t>(std::random_device{}()) << 32) |
+      std::random_device{}() | 1U};
+  lState ^= lState >> 12;
+  lState ^= lState << 25;
+  lState ^= lState >> 27;
+  return lState * std::uint64_t{0x2545F4914F6CDD1D};
+}
+
+}  // namespace Stroalgo::Log
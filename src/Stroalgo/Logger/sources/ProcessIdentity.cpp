@@ -0,0 +1,63 @@
+/**
+ * @file ProcessIdentity.cpp
+ * @brief Identity of the processes owning shared rings and images
+ * @details Uses POSIX kill and the Linux /proc file system, the start time
+ *          is unknown elsewhere
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "ProcessIdentity.h"
+
+#include <signal.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief Field of /proc/<pid>/stat holding the start time, counted from the
+ * field following the command name
+ */
+constexpr int c_StartTimeField{20};
+
+}  // namespace
+
+std::uint64_t GetProcessStartTime(std::uint32_t pProcessId) {
+  std::ifstream lFile{"/proc/" + std::to_string(pProcessId) + "/stat"};
+  std::string lStat{};
+  std::getline(lFile, lStat);
+
+  // The command name may hold spaces and parentheses
+  const std::size_t lNameEnd{lStat.rfind(')')};
+  if (lNameEnd == std::string::npos) {
+    return 0;
+  }
+  std::istringstream lFields{lStat.substr(lNameEnd + 1)};
+  std::string lField{};
+  int lIndex{0};
+  while (lIndex < c_StartTimeField && (lFields >> lField)) {
+    ++lIndex;
+  }
+  return lIndex == c_StartTimeField
+             ? std::strtoull(lField.c_str(), nullptr, 10)
+             : 0;
+}
+
+bool IsProcessGone(std::uint32_t pProcessId, std::uint64_t pStartTime) {
+  // EPERM means the process exists under another user
+  if (::kill(static_cast<::pid_t>(pProcessId), 0) != 0 && errno == ESRCH) {
+    return true;
+  }
+
+  // A process started later reuses the id, an unknown time proves nothing
+  const std::uint64_t lStartTime{GetProcessStartTime(pProcessId)};
+  return pStartTime != 0 && lStartTime != 0 && lStartTime != pStartTime;
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,331 @@
+/**
+ * @file SharedLogTransport.cpp
+ * @brief Shared memory rings carrying records from the processes to a
+ * collector
+ * @details Uses POSIX shm_open and mmap
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "SharedLogTransport.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "BinaryLogFormat.h"
+#include "StructuredFields.h"
+
+namespace Stroalgo::Log {
+
+/**
+ * @brief Header of a shared memory segment, the producer and the collector
+ * positions are kept on separate cache lines
+ * @struct SharedLogHeader
+ */
+struct SharedLogHeader {
+  /**
+   * @brief c_SharedLogMagic, written last
+   */
+  std::array<char, 4> m_Magic{};
+
+  /**
+   * @brief c_SharedLogVersion
+   */
+  std::uint16_t m_Version{0};
+
+  /**
+   * @brief Producer process
+   */
+  std::uint32_t m_ProcessId{0};
+
+  /**
+   * @brief Start time of the producer process, 0 if unknown
+   */
+  std::uint64_t m_StartTime{0};
+
+  /**
+   * @brief Bytes of data following the header
+   */
+  std::uint64_t m_Capacity{0};
+
+  /**
+   * @brief Position following the last complete entry, written by the
+   * producer
+   */
+  alignas(64) std::atomic<std::uint64_t> m_Head{0};
+
+  /**
+   * @brief Records dropped by the producer because the ring was full
+   */
+  std::atomic<std::uint64_t> m_Dropped{0};
+
+  /**
+   * @brief Position of the first entry not written yet, written by the
+   * collector
+   */
+  alignas(64) std::atomic<std::uint64_t> m_Tail{0};
+};
+
+static_assert(sizeof(SharedLogHeader) <= c_SharedLogHeaderSize,
+              "The segment header does not fit its reserved size");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Ring positions are shared with another process");
+
+namespace {
+
+/**
+ * @brief Bytes of an entry before its binary record, size and name length
+ */
+constexpr std::size_t c_EntryPrefixSize{sizeof(std::uint32_t) +
+                                        sizeof(std::uint16_t)};
+
+/**
+ * @brief Get the rank of the next segment created by the process
+ *
+ * @return The rank, from 0
+ */
+std::uint32_t NextSegmentRank() {
+  static std::atomic<std::uint32_t> sRank{0};
+  return sRank.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+std::string GetSharedLogSegmentName(const std::string &pName,
+                                    std::uint32_t pProcessId,
+                                    std::uint64_t pStartTime,
+                                    std::uint32_t pRank) {
+  return "/" + pName + "." + std::to_string(pProcessId) + "." +
+         std::to_string(pStartTime) + "." + std::to_string(pRank);
+}
+
+SharedLogSink::SharedLogSink(const SharedTransportOptions &pOptions)
+    : m_Options(pOptions) {
+  m_Options.m_Size = std::max(m_Options.m_Size, c_MinSharedLogSize);
+  const auto lProcessId{static_cast<std::uint32_t>(::getpid())};
+  const std::uint64_t lStartTime{GetProcessStartTime(lProcessId)};
+  m_SegmentName = GetSharedLogSegmentName(m_Options.m_Name, lProcessId,
+                                          lStartTime, NextSegmentRank());
+
+  // A segment left by a process with the same id is never replaced, its
+  // records are drained by the collector
+  const int lFile{::shm_open(m_SegmentName.c_str(),
+                             O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0660)};
+  if (lFile < 0) {
+    spdlog::throw_spdlog_ex("Failed creating segment " + m_SegmentName, errno);
+  }
+  const std::size_t lSize{c_SharedLogHeaderSize + m_Options.m_Size};
+  void *lMapping{MAP_FAILED};
+  if (::ftruncate(lFile, static_cast<::off_t>(lSize)) == 0) {
+    lMapping =
+        ::mmap(nullptr, lSize, PROT_READ | PROT_WRITE, MAP_SHARED, lFile, 0);
+  }
+  const int lError{errno};
+  ::close(lFile);
+  if (lMapping == MAP_FAILED) {
+    ::shm_unlink(m_SegmentName.c_str());
+    spdlog::throw_spdlog_ex("Failed mapping segment " + m_SegmentName, lError);
+  }
+  m_Mapping = static_cast<char *>(lMapping);
+
+  m_Header = new (m_Mapping) SharedLogHeader{};
+  m_Header->m_Version = c_SharedLogVersion;
+  m_Header->m_ProcessId = lProcessId;
+  m_Header->m_StartTime = lStartTime;
+  m_Header->m_Capacity = m_Options.m_Size;
+
+  // A segment is only read once its header is complete
+  std::atomic_thread_fence(std::memory_order_release);
+  std::copy(c_SharedLogMagic.begin(), c_SharedLogMagic.end(),
+            m_Header->m_Magic.begin());
+}
+
+SharedLogSink::~SharedLogSink() {
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, c_SharedLogHeaderSize + m_Options.m_Size);
+  }
+}
+
+std::uint64_t SharedLogSink::GetDroppedRecords() const {
+  return m_Header->m_Dropped.load(std::memory_order_relaxed);
+}
+
+void SharedLogSink::sink_it_(const spdlog::details::log_msg &pMsg) {
+  const std::string_view lName{
+      pMsg.logger_name.data(),
+      std::min<std::size_t>(pMsg.logger_name.size(),
+                            std::numeric_limits<std::uint16_t>::max())};
+  const std::string_view lPayload{pMsg.payload.data(), pMsg.payload.size()};
+  const std::uint64_t lEntrySize{c_EntryPrefixSize + lName.size() +
+                                 c_BinaryRecordHeaderSize + lPayload.size()};
+
+  // The producer never waits, an entry not fitting is dropped
+  const std::uint64_t lCapacity{m_Header->m_Capacity};
+  const std::uint64_t lHead{m_Header->m_Head.load(std::memory_order_relaxed)};
+  const std::uint64_t lTail{m_Header->m_Tail.load(std::memory_order_acquire)};
+  const std::uint64_t lOffset{lHead % lCapacity};
+  const std::uint64_t lSkipped{
+      lCapacity - lOffset < lEntrySize ? lCapacity - lOffset : 0};
+  if (lEntrySize > lCapacity ||
+      lHead + lSkipped + lEntrySize - lTail > lCapacity) {
+    m_Header->m_Dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  m_Buffer.clear();
+  AppendLittleEndian(m_Buffer, static_cast<std::uint32_t>(lEntrySize));
+  AppendLittleEndian(m_Buffer, static_cast<std::uint16_t>(lName.size()));
+  m_Buffer.append(lName.data(), lName.data() + lName.size());
+  AppendBinaryRecord(m_Buffer, ToBinaryTime(pMsg.time), pMsg.level, 0,
+                     pMsg.thread_id, GetTextFormatId(HasStructuredFields(pMsg)),
+                     lPayload);
+
+  char *lData{m_Mapping + c_SharedLogHeaderSize};
+  if (lSkipped >= sizeof(std::uint32_t)) {
+    std::memset(lData + lOffset, 0, sizeof(std::uint32_t));
+  }
+  std::memcpy(lData + (lHead + lSkipped) % lCapacity, m_Buffer.data(),
+              m_Buffer.size());
+  m_Header->m_Head.store(lHead + lSkipped + lEntrySize,
+                         std::memory_order_release);
+  m_Written.fetch_add(1, std::memory_order_relaxed);
+}
+
+SharedLogSegment::SharedLogSegment(std::string pSegmentName)
+    : m_SegmentName(std::move(pSegmentName)) {
+  const int lFile{::shm_open(m_SegmentName.c_str(), O_RDWR | O_CLOEXEC, 0)};
+  if (lFile < 0) {
+    spdlog::throw_spdlog_ex("Failed opening segment " + m_SegmentName, errno);
+  }
+  struct stat lStat {};
+  void *lMapping{MAP_FAILED};
+  if (::fstat(lFile, &lStat) == 0 &&
+      static_cast<std::size_t>(lStat.st_size) > c_SharedLogHeaderSize) {
+    m_Size = static_cast<std::size_t>(lStat.st_size);
+    lMapping =
+        ::mmap(nullptr, m_Size, PROT_READ | PROT_WRITE, MAP_SHARED, lFile, 0);
+  }
+  ::close(lFile);
+  if (lMapping == MAP_FAILED) {
+    spdlog::throw_spdlog_ex("Segment " + m_SegmentName + " is not ready");
+  }
+  m_Mapping = static_cast<char *>(lMapping);
+  m_Header = reinterpret_cast<SharedLogHeader *>(m_Mapping);
+
+  const bool lValid{
+      std::string_view{m_Header->m_Magic.data(), m_Header->m_Magic.size()} ==
+      c_SharedLogMagic};
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (!lValid || m_Header->m_Version != c_SharedLogVersion ||
+      m_Header->m_Capacity != m_Size - c_SharedLogHeaderSize) {
+    ::munmap(m_Mapping, m_Size);
+    m_Mapping = nullptr;
+    spdlog::throw_spdlog_ex("Segment " + m_SegmentName + " is not ready");
+  }
+}
+
+SharedLogSegment::~SharedLogSegment() {
+  if (m_Mapping != nullptr) {
+    ::munmap(m_Mapping, m_Size);
+  }
+}
+
+std::size_t SharedLogSegment::Drain(
+    const std::function<void(const SharedLogRecord &)> &pWrite,
+    std::size_t pMaxRecords) {
+  const char *lData{m_Mapping + c_SharedLogHeaderSize};
+  const std::uint64_t lCapacity{m_Header->m_Capacity};
+  const std::uint64_t lHead{m_Header->m_Head.load(std::memory_order_acquire)};
+  std::uint64_t lTail{m_Header->m_Tail.load(std::memory_order_relaxed)};
+  std::size_t lRet{0};
+
+  // Positions and entries are checked, the producer may be corrupted
+  bool lCorrupted{lHead < lTail || lHead - lTail > lCapacity};
+  while (!lCorrupted && lTail != lHead && lRet < pMaxRecords) {
+    const std::uint64_t lOffset{lTail % lCapacity};
+    const std::uint64_t lLeft{lCapacity - lOffset};
+    const std::uint32_t lEntrySize{
+        lLeft < sizeof(std::uint32_t)
+            ? 0
+            : ReadLittleEndian<std::uint32_t>(lData + lOffset)};
+    if (lEntrySize == 0) {
+      lCorrupted = lLeft > lHead - lTail;
+      lTail += lLeft;
+      continue;
+    }
+
+    const char *lEntry{lData + lOffset};
+    lCorrupted = lEntrySize > lLeft || lEntrySize > lHead - lTail ||
+                 lEntrySize < c_EntryPrefixSize + c_BinaryRecordHeaderSize;
+    if (lCorrupted) {
+      break;
+    }
+    const std::size_t lNameSize{
+        ReadLittleEndian<std::uint16_t>(lEntry + sizeof(std::uint32_t))};
+    const char *lRecord{lEntry + c_EntryPrefixSize + lNameSize};
+    lCorrupted =
+        lEntrySize < c_EntryPrefixSize + lNameSize + c_BinaryRecordHeaderSize ||
+        lRecord[0] != static_cast<char>(BinaryEntryKind::Record) ||
+        lEntrySize != c_EntryPrefixSize + lNameSize + c_BinaryRecordHeaderSize +
+                          ReadLittleEndian<std::uint32_t>(
+                              lRecord + c_BinaryRecordHeaderSize -
+                              sizeof(std::uint32_t));
+    if (lCorrupted) {
+      break;
+    }
+
+    SharedLogRecord lShared{};
+    lShared.m_ModuleName =
+        std::string_view{lEntry + c_EntryPrefixSize, lNameSize};
+    lShared.m_Time = spdlog::log_clock::time_point{
+        std::chrono::duration_cast<spdlog::log_clock::duration>(
+            std::chrono::nanoseconds{
+                ReadLittleEndian<std::int64_t>(lRecord + 1)})};
+    lShared.m_Level = static_cast<spdlog::level::level_enum>(
+        ReadLittleEndian<std::uint8_t>(lRecord + 9));
+    lShared.m_ThreadId = ReadLittleEndian<std::uint64_t>(lRecord + 14);
+    lShared.m_Structured =
+        ReadLittleEndian<std::uint32_t>(lRecord + 22) == c_StructuredFormatId;
+    lShared.m_Payload = std::string_view{
+        lRecord + c_BinaryRecordHeaderSize,
+        lEntrySize - c_EntryPrefixSize - lNameSize - c_BinaryRecordHeaderSize};
+    pWrite(lShared);
+    lTail += lEntrySize;
+    ++lRet;
+  }
+
+  // The unreadable entries are skipped, the next ones can still be read
+  m_Header->m_Tail.store(lCorrupted ? lHead : lTail,
+                         std::memory_order_release);
+  return lRet;
+}
+
+std::uint64_t SharedLogSegment::TakeDroppedRecords() {
+  const std::uint64_t lDropped{
+      m_Header->m_Dropped.load(std::memory_order_relaxed)};
+  const std::uint64_t lRet{lDropped - std::min(lDropped, m_ReportedDrops)};
+  m_ReportedDrops = lDropped;
+  return lRet;
+}
+
+bool SharedLogSegment::IsProducerGone() const {
+  return IsProcessGone(m_Header->m_ProcessId, m_Header->m_StartTime);
+}
+
+void SharedLogSegment::Remove() { ::shm_unlink(m_SegmentName.c_str()); }
+
+std::uint32_t SharedLogSegment::GetProcessId() const {
+  return m_Header->m_ProcessId;
+}
+
+}  // namespace Stroalgo::Log
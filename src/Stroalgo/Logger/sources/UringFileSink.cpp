@@ -0,0 +1,273 @@
+/**
+ * @file UringFileSink.cpp
+ * @brief spdlog sink writing daily log files with io_uring
+ * @details Uses IoUring, pwrite as fallback
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "UringFileSink.h"
+
+#include <fcntl.h>
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+
+namespace Stroalgo::Log {
+
+namespace {
+
+/**
+ * @brief User data of the fdatasync completions, writes use their buffer index
+ */
+constexpr std::uint64_t c_SyncUserData{c_UringBufferCount};
+
+/**
+ * @brief Submission queue size, a write per buffer and a fdatasync
+ */
+constexpr unsigned c_UringEntries{4};
+
+}  // namespace
+
+UringFileSink::UringFileSink(const std::string &pBaseFilename,
+                             std::uint16_t pMaxFiles)
+    : m_BaseFilename(pBaseFilename),
+      m_MaxFiles(pMaxFiles),
+      m_Ring(c_UringEntries) {
+  std::array<iovec, c_UringBufferCount> lBuffers{};
+  for (std::size_t lBuffer = 0; lBuffer < c_UringBufferCount; ++lBuffer) {
+    m_Buffers[lBuffer].resize(c_UringBufferSize);
+    lBuffers[lBuffer].iov_base = m_Buffers[lBuffer].data();
+    lBuffers[lBuffer].iov_len = m_Buffers[lBuffer].size();
+  }
+  m_UseRing = m_Ring.RegisterBuffers(lBuffers.data(), c_UringBufferCount);
+  RotateIfNeeded(spdlog::log_clock::now());
+}
+
+UringFileSink::~UringFileSink() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  try {
+    Close();
+  } catch (const spdlog::spdlog_ex &) {
+    // Nothing left to report the failure to
+  }
+}
+
+void UringFileSink::Sync() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  flush_();
+  if (m_File < 0) {
+    return;
+  }
+
+  // Started once the writes queued before it are completed
+  if (m_UseRing && m_Ring.PrepareDataSync(m_File, c_SyncUserData) &&
+      m_Ring.Submit(1)) {
+    m_SyncInFlight = true;
+    while (m_SyncInFlight) {
+      Reap(true);
+    }
+  } else {
+    m_SyncResult = ::fdatasync(m_File) == 0 ? 0 : -errno;
+  }
+  if (m_SyncResult < 0) {
+    spdlog::throw_spdlog_ex("Failed syncing file " + m_Filename,
+                            -m_SyncResult);
+  }
+}
+
+void UringFileSink::Truncate() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  m_Used[m_Current] = 0;
+  for (std::size_t lBuffer = 0; lBuffer < c_UringBufferCount; ++lBuffer) {
+    WaitBuffer(lBuffer);
+  }
+  if (m_File >= 0 && ::ftruncate(m_File, 0) != 0) {
+    spdlog::throw_spdlog_ex("Failed truncating file " + m_Filename, errno);
+  }
+  m_FileOffset = 0;
+}
+
+std::string UringFileSink::GetFilename() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  return m_Filename;
+}
+
+bool UringFileSink::IsUsingRing() {
+  std::lock_guard<std::mutex> lLock(mutex_);
+  return m_UseRing;
+}
+
+void UringFileSink::sink_it_(const spdlog::details::log_msg &pMsg) {
+  RotateIfNeeded(pMsg.time);
+  m_Formatted.clear();
+  formatter_->format(pMsg, m_Formatted);
+  Append(m_Formatted.data(), m_Formatted.size());
+}
+
+void UringFileSink::flush_() {
+  SubmitCurrent();
+  for (std::size_t lBuffer = 0; lBuffer < c_UringBufferCount; ++lBuffer) {
+    WaitBuffer(lBuffer);
+  }
+}
+
+void UringFileSink::Append(const char *pData, std::size_t pSize) {
+  while (pSize > 0) {
+    const std::size_t lCount{
+        std::min(pSize, c_UringBufferSize - m_Used[m_Current])};
+    std::memcpy(m_Buffers[m_Current].data() + m_Used[m_Current], pData,
+                lCount);
+    m_Used[m_Current] += lCount;
+    pData += lCount;
+    pSize -= lCount;
+    if (m_Used[m_Current] == c_UringBufferSize) {
+      SubmitCurrent();
+    }
+  }
+}
+
+void UringFileSink::SubmitCurrent() {
+  const std::size_t lBuffer{m_Current};
+  if (m_Used[lBuffer] == 0 || m_File < 0) {
+    return;
+  }
+  m_WriteOffset[lBuffer] = m_FileOffset;
+  m_FileOffset += m_Used[lBuffer];
+
+  // One system call for the whole buffer, not waited for
+  if (m_UseRing &&
+      m_Ring.PrepareWriteFixed(m_File, m_Buffers[lBuffer].data(),
+                               static_cast<std::uint32_t>(m_Used[lBuffer]),
+                               m_WriteOffset[lBuffer],
+                               static_cast<std::uint16_t>(lBuffer), lBuffer)) {
+    if (m_Ring.Submit()) {
+      m_InFlight[lBuffer] = true;
+    } else {
+      // Queued entry is never submitted again, the ring is given up
+      m_UseRing = false;
+      WriteBlocking(lBuffer, 0);
+    }
+  } else {
+    WriteBlocking(lBuffer, 0);
+  }
+
+  // Next buffer is filled once the kernel is done with it
+  m_Current = (lBuffer + 1) % c_UringBufferCount;
+  WaitBuffer(m_Current);
+  m_Used[m_Current] = 0;
+}
+
+void UringFileSink::WaitBuffer(std::size_t pBuffer) {
+  while (m_InFlight[pBuffer]) {
+    Reap(true);
+  }
+}
+
+void UringFileSink::Reap(bool pWait) {
+  std::uint64_t lUserData{0};
+  std::int32_t lResult{0};
+  bool lReaped{false};
+  while (m_Ring.PopCompletion(lUserData, lResult)) {
+    lReaped = true;
+    if (lUserData == c_SyncUserData) {
+      m_SyncInFlight = false;
+      m_SyncResult = lResult;
+    } else if (lUserData < c_UringBufferCount) {
+      m_InFlight[lUserData] = false;
+
+      // Short or failed write, the end of the buffer is written by pwrite
+      const std::size_t lWritten{
+          lResult > 0 ? static_cast<std::size_t>(lResult) : 0};
+      if (lWritten < m_Used[lUserData]) {
+        WriteBlocking(lUserData, lWritten);
+      }
+    }
+  }
+  if (pWait && !lReaped && !m_Ring.Submit(1)) {
+    // Completions can no longer be waited for, give up the ring
+    m_UseRing = false;
+    for (std::size_t lBuffer = 0; lBuffer < c_UringBufferCount; ++lBuffer) {
+      if (m_InFlight[lBuffer]) {
+        m_InFlight[lBuffer] = false;
+        WriteBlocking(lBuffer, 0);
+      }
+    }
+    m_SyncInFlight = false;
+    m_SyncResult = ::fdatasync(m_File) == 0 ? 0 : -errno;
+  }
+}
+
+void UringFileSink::WriteBlocking(std::size_t pBuffer, std::size_t pWritten) {
+  while (pWritten < m_Used[pBuffer]) {
+    const ::ssize_t lResult{
+        ::pwrite(m_File, m_Buffers[pBuffer].data() + pWritten,
+                 m_Used[pBuffer] - pWritten,
+                 static_cast<::off_t>(m_WriteOffset[pBuffer] + pWritten))};
+    if (lResult < 0 && errno != EINTR) {
+      spdlog::throw_spdlog_ex("Failed writing to file " + m_Filename, errno);
+    }
+    pWritten += lResult > 0 ? static_cast<std::size_t>(lResult) : 0;
+  }
+}
+
+void UringFileSink::RotateIfNeeded(spdlog::log_clock::time_point pTime) {
+  if (pTime < m_NextRotation) {
+    return;
+  }
+
+  const std::time_t lTime{spdlog::log_clock::to_time_t(pTime)};
+  std::tm lDate{spdlog::details::os::localtime(lTime)};
+  Close();
+  m_Filename = spdlog::sinks::daily_filename_calculator::calc_filename(
+      m_BaseFilename, lDate);
+  spdlog::details::os::create_dir(spdlog::details::os::dir_name(m_Filename));
+  m_File = ::open(m_Filename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+  if (m_File < 0) {
+    spdlog::throw_spdlog_ex("Failed opening file " + m_Filename, errno);
+  }
+
+  // Continue after the messages already written today
+  struct stat lStat {};
+  m_FileOffset =
+      ::fstat(m_File, &lStat) == 0 ? static_cast<std::uint64_t>(lStat.st_size)
+                                   : 0;
+
+  // Remove the file leaving the retention window
+  if (m_MaxFiles > 0) {
+    std::tm lExpired{lDate};
+    lExpired.tm_mday -= m_MaxFiles;
+    std::mktime(&lExpired);
+    std::error_code lError{};
+    std::filesystem::remove(
+        spdlog::sinks::daily_filename_calculator::calc_filename(m_BaseFilename,
+                                                                lExpired),
+        lError);
+  }
+
+  // Next file is opened at 00:00
+  lDate.tm_hour = 0;
+  lDate.tm_min = 0;
+  lDate.tm_sec = 0;
+  lDate.tm_mday += 1;
+  m_NextRotation = spdlog::log_clock::from_time_t(std::mktime(&lDate));
+}
+
+void UringFileSink::Close() {
+  if (m_File < 0) {
+    return;
+  }
+  flush_();
+  ::close(m_File);
+  m_File = -1;
+  m_FileOffset = 0;
+}
+
+}  // namespace Stroalgo::Log
@@ -0,0 +1,49 @@
+/**
+ * @file FlightRecover.cpp
+ * @brief stroalgo-flightrec : recover the flight recorder of a crashed process
+ * @details Usage : stroalgo-flightrec [--undumped] <image.flight>
+ *          <output.slog>, appends the records kept in the ring image to a
+ *          binary log file read with stroalgo-logcat. --undumped skips the
+ *          records the process already dumped itself.
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include <spdlog/fmt/fmt.h>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FlightRecorder.h"
+
+int main(int argc, char **argv) {
+  bool lUndumpedOnly{false};
+  std::vector<std::string> lFiles{};
+  for (int lIndex = 1; lIndex < argc; ++lIndex) {
+    const std::string_view lArg{argv[lIndex]};
+    if (lArg == "--undumped") {
+      lUndumpedOnly = true;
+    } else {
+      lFiles.emplace_back(lArg);
+    }
+  }
+
+  if (lFiles.size() != 2) {
+    fmt::print(stderr,
+               "Usage : {} [--undumped] <image.flight> <output.slog>\n",
+               argc > 0 ? argv[0] : "stroalgo-flightrec");
+    return 2;
+  }
+
+  const auto lRecords{Stroalgo::Log::ExtractFlightRecording(
+      lFiles[0], lFiles[1], lUndumpedOnly)};
+  if (!lRecords.has_value()) {
+    fmt::print(stderr,
+               "{} : not a flight recorder image, or {} cannot be written\n",
+               lFiles[0], lFiles[1]);
+    return 1;
+  }
+  fmt::print("{} records appended to {}\n", *lRecords, lFiles[1]);
+  return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file LogCat.cpp
+ * @brief stroalgo-logcat : convert binary log files to text or JSON
+ * @details Usage : stroalgo-logcat [--text|--json] [--from <time>]
+ *          [--to <time>] [--level <level>]... [--module <name>]
+ *          <file.slog|file.slz>..., times are local "YYYY-MM-DD HH:MM:SS".
+ *          Blocks outside of the time range or without a selected level are
+ *          skipped using the index of the files, files of other modules are
+ *          skipped after reading their header. Archives of binary files are
+ *          decompressed on the fly, archives of text and JSON files are
+ *          printed as they are.
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+#include "JsonEscape.h"
+#include "LogArchive.h"
+#include "LogClock.h"
+#include "StructuredFields.h"
+
+namespace {
+
+/**
+ * @brief Print one record
+ *
+ * @param pModuleName Module which wrote the file
+ * @param pEntry Record to print
+ * @param pJson Print a JSON object instead of a text line
+ */
+void PrintEntry(const std::string &pModuleName,
+                const Stroalgo::Log::BinaryLogEntry &pEntry, bool pJson) {
+  const auto lSeconds{
+      std::chrono::time_point_cast<std::chrono::seconds>(pEntry.m_Time)};
+  const auto lMicroseconds{
+      std::chrono::duration_cast<std::chrono::microseconds>(pEntry.m_Time -
+                                                            lSeconds)
+          .count()};
+  std::array<char, Stroalgo::Log::c_LocalDateTimeSize> lDateText{};
+  Stroalgo::Log::FormatLocalDateTime(
+      spdlog::log_clock::to_time_t(pEntry.m_Time), lDateText.data());
+  const std::string_view lDateView{lDateText.data(), lDateText.size()};
+  const auto lLevel{spdlog::level::to_string_view(pEntry.m_Level)};
+
+  spdlog::memory_buf_t lLine{};
+  if (pJson) {
+    fmt::format_to(std::back_inserter(lLine),
+                   "{{\"time\": \"{}.{:06d}\", \"name\": ", lDateView,
+                   lMicroseconds);
+    Stroalgo::Log::AppendJsonString(lLine, pModuleName);
+    fmt::format_to(std::back_inserter(lLine),
+                   ", \"level\": \"{}\", \"module_id\": {}, \"thread\": {}, ",
+                   std::string_view{lLevel.data(), lLevel.size()},
+                   pEntry.m_ModuleId, pEntry.m_ThreadId);
+    Stroalgo::Log::AppendJsonPayload(lLine, pEntry.m_Message,
+                                     pEntry.m_Structured);
+    lLine.push_back('}');
+  } else {
+    fmt::format_to(std::back_inserter(lLine), "[{}.{:03d}] [{}] [{}] ---> ",
+                   lDateView, lMicroseconds / 1000, pModuleName,
+                   std::string_view{lLevel.data(), lLevel.size()});
+    Stroalgo::Log::AppendTextPayload(lLine, pEntry.m_Message,
+                                     pEntry.m_Structured);
+  }
+  lLine.push_back('\n');
+  std::fwrite(lLine.data(), 1, lLine.size(), stdout);
+}
+
+/**
+ * @brief Parse a local time given on the command line
+ *
+ * @param pText Time as "YYYY-MM-DD HH:MM:SS"
+ * @return The time, empty if the text is not a valid time
+ */
+std::optional<spdlog::log_clock::time_point> ParseTime(
+    const std::string &pText) {
+  std::tm lDate{};
+  std::istringstream lStream{pText};
+  lStream >> std::get_time(&lDate, "%Y-%m-%d %H:%M:%S");
+  if (lStream.fail()) {
+    return std::nullopt;
+  }
+  lDate.tm_isdst = -1;
+  return spdlog::log_clock::from_time_t(std::mktime(&lDate));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  bool lJson{false};
+  bool lUsageError{false};
+  std::uint8_t lLevels{0};
+  std::string lModule{};
+  auto lFrom{spdlog::log_clock::time_point::min()};
+  auto lTo{spdlog::log_clock::time_point::max()};
+  std::vector<std::string> lFiles{};
+  for (int lIndex = 1; lIndex < argc; ++lIndex) {
+    const std::string_view lArg{argv[lIndex]};
+    if (lArg == "--json") {
+      lJson = true;
+    } else if (lArg == "--text") {
+      lJson = false;
+    } else if (lArg == "--from" || lArg == "--to") {
+      const auto lTime{lIndex + 1 < argc ? ParseTime(argv[++lIndex])
+                                         : std::nullopt};
+      lUsageError = lUsageError || !lTime.has_value();
+      if (lTime.has_value()) {
+        (lArg == "--from" ? lFrom : lTo) = *lTime;
+      }
+    } else if (lArg == "--level" && lIndex + 1 < argc) {
+      const auto lLevel{spdlog::level::from_str(argv[++lIndex])};
+      lUsageError = lUsageError || lLevel == spdlog::level::off;
+      lLevels |= Stroalgo::Log::GetLevelMask(lLevel);
+    } else if (lArg == "--module" && lIndex + 1 < argc) {
+      lModule = argv[++lIndex];
+    } else {
+      lFiles.emplace_back(lArg);
+    }
+  }
+
+  if (lFiles.empty() || lUsageError) {
+    fmt::print(stderr,
+               "Usage : {} [--text|--json] [--from \"YYYY-MM-DD HH:MM:SS\"] "
+               "[--to \"YYYY-MM-DD HH:MM:SS\"] [--level <level>]... "
+               "[--module <name>] <file.slog|file.slz>...\n",
+               argc > 0 ? argv[0] : "stroalgo-logcat");
+    return 2;
+  }
+
+  int lRet{0};
+  for (const auto &lFile : lFiles) {
+    Stroalgo::Log::BinaryLogRangeReader lReader{
+        lFile, lFrom, lTo,
+        lLevels == 0 ? Stroalgo::Log::c_AllLevelsMask : lLevels};
+    if (!lReader.IsValid()) {
+      // Archives of text and JSON files are printed as they are
+      Stroalgo::Log::LogArchiveBuffer lArchive{lFile};
+      if (Stroalgo::Log::IsLogArchive(lFile) && lArchive.IsValid()) {
+        std::cout << &lArchive;
+        continue;
+      }
+      fmt::print(stderr, "{} : not a binary log file\n", lFile);
+      lRet = 1;
+      continue;
+    }
+    if (!lModule.empty() && lReader.GetModuleName() != lModule) {
+      continue;
+    }
+    Stroalgo::Log::BinaryLogEntry lEntry{};
+    while (lReader.Next(lEntry)) {
+      PrintEntry(lReader.GetModuleName(), lEntry, lJson);
+    }
+  }
+  return lRet;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file LogCollectorDaemon.cpp
+ * @brief stroalgo-logcollector : write the records of the producer processes
+ * @details Usage : stroalgo-logcollector [--name <name>] [--interval <ms>]
+ *          [--no-text] [--no-json] [--binary]. The records sent by the
+ *          processes enabling Logger::EnableSharedTransport with the same
+ *          name are written to "Logs/<Module>/", the files of each module
+ *          are rotated and indexed as if the producer wrote them. Runs until
+ *          SIGINT or SIGTERM, the pending records are then written.
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include <spdlog/fmt/fmt.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "LogCollector.h"
+#include "Logger.h"
+
+namespace {
+
+/**
+ * @brief Get the flag set by SIGINT and SIGTERM
+ *
+ * @return The flag, not 0 once the collector must return
+ */
+volatile std::sig_atomic_t &StopRequested() {
+  static volatile std::sig_atomic_t lStop{0};
+  return lStop;
+}
+
+/**
+ * @brief Ask the collector to write the pending records and return
+ *
+ * @param pSignal The signal
+ */
+void HandleStop(int pSignal) {
+  static_cast<void>(pSignal);
+  StopRequested() = 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Stroalgo::Log::CollectorOptions lOptions{};
+  std::chrono::milliseconds lInterval{10};
+  bool lUsageError{false};
+  for (int lIndex = 1; lIndex < argc; ++lIndex) {
+    const std::string_view lArg{argv[lIndex]};
+    if (lArg == "--name" && lIndex + 1 < argc) {
+      lOptions.m_Name = argv[++lIndex];
+    } else if (lArg == "--interval" && lIndex + 1 < argc) {
+      const long lMilliseconds{std::strtol(argv[++lIndex], nullptr, 10)};
+      lUsageError = lUsageError || lMilliseconds <= 0;
+      lInterval = std::chrono::milliseconds{lMilliseconds};
+    } else if (lArg == "--no-text") {
+      lOptions.m_FileFormats.m_Text = false;
+    } else if (lArg == "--no-json") {
+      lOptions.m_FileFormats.m_Json = false;
+    } else if (lArg == "--binary") {
+      lOptions.m_FileFormats.m_Binary = true;
+    } else {
+      lUsageError = true;
+    }
+  }
+
+  if (lUsageError) {
+    fmt::print(stderr,
+               "Usage : {} [--name <name>] [--interval <ms>] [--no-text] "
+               "[--no-json] [--binary]\n",
+               argc > 0 ? argv[0] : "stroalgo-logcollector");
+    return 2;
+  }
+
+  std::signal(SIGINT, HandleStop);
+  std::signal(SIGTERM, HandleStop);
+  Stroalgo::Log::LogCollector lCollector{lOptions};
+  while (StopRequested() == 0) {
+    // Sleep only once the rings are empty
+    if (lCollector.CollectPending() == 0) {
+      std::this_thread::sleep_for(lInterval);
+    }
+  }
+  lCollector.CollectPending();
+  Stroalgo::Log::Logger::GetInstance().Flush();
+  return 0;
+}
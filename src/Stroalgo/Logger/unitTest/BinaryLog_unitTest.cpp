@@ -0,0 +1,383 @@
+/**
+ * @file BinaryLog_unitTest.cpp
+ * @brief Contains all units tests for the binary log files
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include <gtest/gtest.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/details/os.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryFileSink.h"
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+#include "Logger.h"
+#include "StructuredFields.h"
+
+namespace {
+
+/**
+ * @brief Read every record of a binary log file
+ *
+ * @param pFilePath Path of the file
+ * @return The records read
+ */
+std::vector<Stroalgo::Log::BinaryLogEntry> ReadAll(
+    const std::string &pFilePath) {
+  std::vector<Stroalgo::Log::BinaryLogEntry> lRet{};
+  Stroalgo::Log::BinaryLogReader lReader{pFilePath};
+  Stroalgo::Log::BinaryLogEntry lEntry{};
+  while (lReader.Next(lEntry)) {
+    lRet.push_back(lEntry);
+  }
+  return lRet;
+}
+
+/**
+ * @brief Write deferred records one millisecond apart
+ *
+ * @param pSink Sink writing the records
+ * @param pStart Time of the first record
+ * @param pFirst Number of the first record
+ * @param pCount Number of records
+ */
+void WriteTimedRecords(Stroalgo::Log::BinaryFileSink &pSink,
+                       spdlog::log_clock::time_point pStart, int pFirst,
+                       int pCount) {
+  Stroalgo::Log::LogRecord lRecord{};
+  lRecord.m_Level = spdlog::level::info;
+  for (int lNumber = pFirst; lNumber < pFirst + pCount; ++lNumber) {
+    lRecord.m_Time = pStart + std::chrono::milliseconds{lNumber};
+    ASSERT_TRUE(lRecord.Capture<int>("Timed record {}", lNumber));
+    pSink.WriteRecord(lRecord);
+  }
+}
+
+/**
+ * @brief Read the records of a binary log file within a time range
+ *
+ * @param pReader Reader of the range
+ * @return The records read
+ */
+std::vector<Stroalgo::Log::BinaryLogEntry> ReadAll(
+    Stroalgo::Log::BinaryLogRangeReader &pReader) {
+  std::vector<Stroalgo::Log::BinaryLogEntry> lRet{};
+  Stroalgo::Log::BinaryLogEntry lEntry{};
+  while (pReader.Next(lEntry)) {
+    lRet.push_back(lEntry);
+  }
+  return lRet;
+}
+
+}  // namespace
+
+class BinaryLogTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    std::filesystem::remove_all("BinaryLogs");
+    std::filesystem::remove_all("Logs");
+  }
+};
+
+TEST_F(BinaryLogTest, TextAndDeferredRecords) {
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 7)};
+  const std::string lFilePath{lSink->GetFilename()};
+
+  // Formatted message written by a synchronous logger
+  spdlog::details::log_msg lMsg{spdlog::source_loc{}, "Module",
+                                spdlog::level::warn, "Text message"};
+  lSink->log(lMsg);
+
+  // Deferred record written twice, its format string is stored once
+  Stroalgo::Log::LogRecord lRecord{};
+  lRecord.m_Level = spdlog::level::info;
+  lRecord.m_Time = spdlog::log_clock::now();
+  lRecord.m_ThreadId = 42;
+  const std::string lText{"text"};
+  const bool lCaptured{
+      lRecord.Capture<int, const std::string &>("Deferred {} {}", 1, lText)};
+  ASSERT_TRUE(lCaptured);
+  lSink->WriteRecord(lRecord);
+  lSink->WriteRecord(lRecord);
+  lSink->flush();
+
+  Stroalgo::Log::BinaryLogReader lReader{lFilePath};
+  ASSERT_TRUE(lReader.IsValid());
+  EXPECT_EQ(lReader.GetModuleName(), "Module");
+
+  const auto lEntries{ReadAll(lFilePath)};
+  ASSERT_EQ(lEntries.size(), 3U);
+  EXPECT_EQ(lEntries[0].m_Message, "Text message");
+  EXPECT_EQ(lEntries[0].m_Level, spdlog::level::warn);
+  EXPECT_EQ(lEntries[0].m_ModuleId, 7U);
+  EXPECT_EQ(lEntries[1].m_Message, "Deferred 1 text");
+  EXPECT_EQ(lEntries[1].m_Level, spdlog::level::info);
+  EXPECT_EQ(lEntries[1].m_ThreadId, 42U);
+  EXPECT_EQ(lEntries[1].m_Time, lRecord.m_Time);
+  EXPECT_EQ(lEntries[2].m_Message, "Deferred 1 text");
+
+  // The format string is stored once
+  std::ifstream lFile{lFilePath, std::ios::binary};
+  const std::string lContent{std::istreambuf_iterator<char>{lFile},
+                             std::istreambuf_iterator<char>{}};
+  EXPECT_EQ(lContent.find("Deferred {} {}"),
+            lContent.rfind("Deferred {} {}"));
+}
+
+TEST_F(BinaryLogTest, StructuredRecords) {
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 7)};
+  const std::string lFilePath{lSink->GetFilename()};
+
+  // Only the source marks a message carrying fields
+  const std::string_view lPayload{"Login\x1e\"user\": 1"};
+  lSink->log(spdlog::details::log_msg{Stroalgo::Log::StructuredSource(),
+                                      "Module", spdlog::level::info,
+                                      lPayload});
+  lSink->log(spdlog::details::log_msg{spdlog::source_loc{}, "Module",
+                                      spdlog::level::info, lPayload});
+  Stroalgo::Log::LogRecord lRecord{};
+  lRecord.m_Level = spdlog::level::info;
+  lRecord.m_Structured = true;
+  lRecord.Format<std::string_view>("{}", std::string_view{lPayload});
+  lSink->WriteRecord(lRecord);
+  lSink->flush();
+
+  const auto lEntries{ReadAll(lFilePath)};
+  ASSERT_EQ(lEntries.size(), 3U);
+  EXPECT_TRUE(lEntries[0].m_Structured);
+  EXPECT_FALSE(lEntries[1].m_Structured);
+  EXPECT_TRUE(lEntries[2].m_Structured);
+  for (const auto &lEntry : lEntries) {
+    EXPECT_EQ(lEntry.m_Message, lPayload);
+  }
+}
+
+TEST_F(BinaryLogTest, Version1Records) {
+  // Version 1 marked the structured fields in-band only
+  spdlog::memory_buf_t lBuffer{};
+  Stroalgo::Log::AppendBinaryHeader(lBuffer, 7, "Module");
+  lBuffer[4] = static_cast<char>(Stroalgo::Log::c_BinaryLogInBandVersion);
+  const std::string_view lPayload{"Login\x1e\"user\": 1"};
+  Stroalgo::Log::AppendBinaryRecord(lBuffer, 0, spdlog::level::info, 7, 1,
+                                    Stroalgo::Log::c_TextFormatId, lPayload);
+  Stroalgo::Log::AppendBinaryRecord(lBuffer, 0, spdlog::level::info, 7, 1,
+                                    Stroalgo::Log::c_TextFormatId, "Logout");
+  std::filesystem::create_directories("BinaryLogs");
+  std::ofstream{"BinaryLogs/Version1.slog", std::ios::binary}.write(
+      lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+
+  const auto lEntries{ReadAll("BinaryLogs/Version1.slog")};
+  ASSERT_EQ(lEntries.size(), 2U);
+  EXPECT_TRUE(lEntries[0].m_Structured);
+  EXPECT_EQ(lEntries[0].m_Message, lPayload);
+  EXPECT_FALSE(lEntries[1].m_Structured);
+
+  // Versions written by a newer Logger are not read
+  lBuffer[4] = static_cast<char>(Stroalgo::Log::c_BinaryLogVersion + 1);
+  std::ofstream{"BinaryLogs/Newer.slog", std::ios::binary}.write(
+      lBuffer.data(), static_cast<std::streamsize>(lBuffer.size()));
+  EXPECT_FALSE(
+      Stroalgo::Log::BinaryLogReader{"BinaryLogs/Newer.slog"}.IsValid());
+}
+
+TEST_F(BinaryLogTest, Truncate) {
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0)};
+  spdlog::details::log_msg lMsg{spdlog::source_loc{}, "Module",
+                                spdlog::level::info, "Before truncation"};
+  lSink->log(lMsg);
+  lSink->Truncate();
+  lMsg.payload = "After truncation";
+  lSink->log(lMsg);
+  lSink->flush();
+
+  const auto lEntries{ReadAll(lSink->GetFilename())};
+  ASSERT_EQ(lEntries.size(), 1U);
+  EXPECT_EQ(lEntries[0].m_Message, "After truncation");
+}
+
+TEST_F(BinaryLogTest, InvalidFiles) {
+  // Missing file
+  EXPECT_FALSE(Stroalgo::Log::BinaryLogReader{"BinaryLogs/None.slog"}.IsValid());
+
+  // Not a binary log file
+  std::filesystem::create_directories("BinaryLogs");
+  std::ofstream{"BinaryLogs/Text.slog"} << "[2025-01-01] [Module] [info]";
+  EXPECT_FALSE(Stroalgo::Log::BinaryLogReader{"BinaryLogs/Text.slog"}.IsValid());
+
+  // Truncated record is not returned
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0)};
+  spdlog::details::log_msg lMsg{spdlog::source_loc{}, "Module",
+                                spdlog::level::info, "Complete record"};
+  lSink->log(lMsg);
+  lSink->log(lMsg);
+  lSink->flush();
+  const std::string lFilePath{lSink->GetFilename()};
+  std::filesystem::resize_file(lFilePath,
+                               std::filesystem::file_size(lFilePath) - 1);
+  EXPECT_EQ(ReadAll(lFilePath).size(), 1U);
+}
+
+TEST_F(BinaryLogTest, TimeIndex) {
+  // Records of the current day, rotation is never triggered
+  const auto lStart{spdlog::log_clock::now() - std::chrono::hours{1}};
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0)};
+  const std::string lFilePath{lSink->GetFilename()};
+  WriteTimedRecords(*lSink, lStart, 0, 2000);
+  lSink->flush();
+
+  const Stroalgo::Log::BinaryLogIndex lIndex{lFilePath};
+  ASSERT_TRUE(lIndex.IsValid());
+  ASSERT_GT(lIndex.GetBlocks().size(), 10U);
+  ASSERT_EQ(lIndex.GetFormats().size(), 1U);
+  EXPECT_LE(lIndex.GetBlocks().front().m_MinTime,
+            lIndex.GetBlocks().front().m_MaxTime);
+
+  // Format entry is loaded before seeking past its block
+  Stroalgo::Log::BinaryLogRangeReader lReader{
+      lFilePath, lStart + std::chrono::milliseconds{1500},
+      lStart + std::chrono::milliseconds{1519}};
+  ASSERT_TRUE(lReader.IsValid());
+  EXPECT_EQ(lReader.GetModuleName(), "Module");
+  const auto lEntries{ReadAll(lReader)};
+  ASSERT_EQ(lEntries.size(), 20U);
+  EXPECT_EQ(lEntries.front().m_Message, "Timed record 1500");
+  EXPECT_EQ(lEntries.back().m_Message, "Timed record 1519");
+
+  // Only the selected blocks and the tail are read
+  std::uint64_t lRead{0};
+  for (const auto &[lBegin, lEnd] : lReader.GetRanges()) {
+    lRead += std::min<std::uint64_t>(lEnd, std::filesystem::file_size(
+                                               lFilePath)) -
+             lBegin;
+  }
+  EXPECT_LT(lRead, std::filesystem::file_size(lFilePath) / 4);
+
+  // Empty range
+  Stroalgo::Log::BinaryLogRangeReader lNone{
+      lFilePath, lStart - std::chrono::hours{2},
+      lStart - std::chrono::hours{1}};
+  EXPECT_TRUE(ReadAll(lNone).empty());
+
+  // Truncation empties the index
+  lSink->Truncate();
+  lSink->flush();
+  EXPECT_TRUE(Stroalgo::Log::BinaryLogIndex{lFilePath}.GetBlocks().empty());
+}
+
+TEST_F(BinaryLogTest, TimeIndexAfterReopen) {
+  const auto lStart{spdlog::log_clock::now() - std::chrono::hours{1}};
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0)};
+  const std::string lFilePath{lSink->GetFilename()};
+  WriteTimedRecords(*lSink, lStart, 0, 1000);
+  lSink->flush();
+  lSink.reset();
+
+  // The last block of the first sink is not indexed and is still read
+  lSink = std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0);
+  WriteTimedRecords(*lSink, lStart, 1000, 1000);
+  lSink->flush();
+  EXPECT_EQ(ReadAll(lFilePath).size(), 2000U);
+
+  Stroalgo::Log::BinaryLogRangeReader lReader{
+      lFilePath, lStart + std::chrono::milliseconds{995},
+      lStart + std::chrono::milliseconds{1004}};
+  const auto lEntries{ReadAll(lReader)};
+  ASSERT_EQ(lEntries.size(), 10U);
+  EXPECT_EQ(lEntries.front().m_Message, "Timed record 995");
+  EXPECT_EQ(lEntries.back().m_Message, "Timed record 1004");
+}
+
+TEST_F(BinaryLogTest, LevelIndex) {
+  // One error every 500 records
+  const auto lStart{spdlog::log_clock::now() - std::chrono::hours{1}};
+  auto lSink{std::make_shared<Stroalgo::Log::BinaryFileSink>(
+      "BinaryLogs/Module.slog", "Module", 0)};
+  const std::string lFilePath{lSink->GetFilename()};
+  Stroalgo::Log::LogRecord lRecord{};
+  for (int lNumber = 0; lNumber < 2000; ++lNumber) {
+    lRecord.m_Level = lNumber % 500 == 250 ? spdlog::level::err
+                                           : spdlog::level::info;
+    lRecord.m_Time = lStart + std::chrono::milliseconds{lNumber};
+    ASSERT_TRUE(lRecord.Capture<int>("Level record {}", lNumber));
+    lSink->WriteRecord(lRecord);
+  }
+  lSink->flush();
+
+  const Stroalgo::Log::BinaryLogIndex lIndex{lFilePath};
+  ASSERT_TRUE(lIndex.IsValid());
+  std::size_t lErrorBlocks{0};
+  for (const auto &lBlock : lIndex.GetBlocks()) {
+    EXPECT_NE(lBlock.m_Levels &
+                  Stroalgo::Log::GetLevelMask(spdlog::level::info),
+              0);
+    lErrorBlocks += (lBlock.m_Levels & Stroalgo::Log::GetLevelMask(
+                                           spdlog::level::err)) != 0
+                        ? 1
+                        : 0;
+  }
+  EXPECT_LE(lErrorBlocks, 4U);
+
+  // Blocks without error are skipped
+  Stroalgo::Log::BinaryLogRangeReader lReader{
+      lFilePath, spdlog::log_clock::time_point::min(),
+      spdlog::log_clock::time_point::max(),
+      Stroalgo::Log::GetLevelMask(spdlog::level::err)};
+  const auto lEntries{ReadAll(lReader)};
+  ASSERT_EQ(lEntries.size(), 4U);
+  EXPECT_EQ(lEntries[0].m_Message, "Level record 250");
+  EXPECT_EQ(lEntries[3].m_Message, "Level record 1750");
+  EXPECT_LE(lReader.GetRanges().size(), 5U);
+
+  // Every level
+  Stroalgo::Log::BinaryLogRangeReader lAll{
+      lFilePath, spdlog::log_clock::time_point::min(),
+      spdlog::log_clock::time_point::max()};
+  EXPECT_EQ(ReadAll(lAll).size(), 2000U);
+}
+
+TEST_F(BinaryLogTest, LoggerBinaryFiles) {
+  auto &lLogger{Stroalgo::Log::Logger::GetInstance()};
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Json = false;
+  lFormats.m_Binary = true;
+  auto lModule{lLogger.RegisterModule("Binary_Module", lFormats)};
+
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_DeferFormatting = true;
+  lLogger.EnableAsyncMode(lOptions);
+  lModule.Info("Binary message {} {}", 1, 2.5);
+  lLogger.DisableAsyncMode();
+  lModule.Error("Binary message {}", "synchronous");
+  lLogger.Flush();
+
+  const std::string lFilePath{"Logs/Binary_Module/Binary_Module_" +
+                              lLogger.CurrentDateToString() + ".slog"};
+  EXPECT_FALSE(std::filesystem::exists("Logs/Binary_Module/Binary_Module_" +
+                                       lLogger.CurrentDateToString() +
+                                       ".json"));
+  const auto lEntries{ReadAll(lFilePath)};
+  ASSERT_EQ(lEntries.size(), 2U);
+  EXPECT_EQ(lEntries[0].m_Message, "Binary message 1 2.5");
+  EXPECT_EQ(lEntries[1].m_Message, "Binary message synchronous");
+  EXPECT_EQ(lEntries[1].m_Level, spdlog::level::err);
+
+  // Deleting the logs keeps a readable empty file
+  lLogger.DeleteAllModuleLogs("Binary_Module");
+  EXPECT_TRUE(Stroalgo::Log::BinaryLogReader{lFilePath}.IsValid());
+  EXPECT_TRUE(ReadAll(lFilePath).empty());
+}
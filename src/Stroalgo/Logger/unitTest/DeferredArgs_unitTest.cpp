@@ -0,0 +1,138 @@
+/**
+ * @file DeferredArgs_unitTest.cpp
+ * @brief Contains all units tests for the deferred arguments capture
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "DeferredArgs.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LogRecord.h"
+namespace {
+
+enum Color { Red = 0, Green, Blue };
+
+/**
+ * @brief Capture arguments then format them
+ *
+ * @tparam Args Type
+ * @param pFormat Message format
+ * @param pArgs Args to capture
+ * @return The formatted message
+ */
+template <typename... Args>
+std::string CaptureAndFormat(std::string_view pFormat, const Args &...pArgs) {
+  std::array<char, 256> lBuffer{};
+  Stroalgo::Log::DeferredArgWriter lWriter{lBuffer.data(), lBuffer.size()};
+  EXPECT_TRUE((lWriter.Write(pArgs) && ...));
+
+  fmt::memory_buffer lOut{};
+  EXPECT_TRUE(Stroalgo::Log::FormatDeferredArgs(
+      pFormat, std::string_view{lBuffer.data(), lWriter.Size()}, lOut));
+  return fmt::to_string(lOut);
+}
+
+}  // namespace
+
+TEST(DeferredArgsTest, DeferrableTypes) {
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<int>());
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<const std::uint8_t &>());
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<double &>());
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<const char (&)[6]>());
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<std::string>());
+  EXPECT_TRUE(Stroalgo::Log::IsDeferrableArg<Color>());
+  EXPECT_FALSE(Stroalgo::Log::IsDeferrableArg<long double>());
+  EXPECT_FALSE(Stroalgo::Log::IsDeferrableArg<const void *>());
+  EXPECT_FALSE(Stroalgo::Log::IsDeferrableArg<std::vector<int>>());
+}
+
+TEST(DeferredArgsTest, SameOutputAsEagerFormatting) {
+  const std::string lText{"text"};
+  const char *lCString{"cstring"};
+  EXPECT_EQ(CaptureAndFormat("{} {} {} {}", -12, 42U, std::int64_t{-1},
+                             std::numeric_limits<std::uint64_t>::max()),
+            fmt::format("{} {} {} {}", -12, 42U, std::int64_t{-1},
+                        std::numeric_limits<std::uint64_t>::max()));
+  EXPECT_EQ(CaptureAndFormat("{} {} {:.3f}", 0.1F, 0.1, 2.0),
+            fmt::format("{} {} {:.3f}", 0.1F, 0.1, 2.0));
+  EXPECT_EQ(CaptureAndFormat("{} {} {:#x}", true, 'z', 255),
+            fmt::format("{} {} {:#x}", true, 'z', 255));
+  EXPECT_EQ(CaptureAndFormat("{} {} {} {}", lText, std::string_view{"view"},
+                             lCString, Blue),
+            "text view cstring 2");
+}
+
+TEST(DeferredArgsTest, LittleEndianValues) {
+  std::array<char, 32> lBuffer{};
+  Stroalgo::Log::DeferredArgWriter lWriter{lBuffer.data(), lBuffer.size()};
+  EXPECT_TRUE(lWriter.Write(0x0102));
+  EXPECT_TRUE(lWriter.Write(1.0F));
+  EXPECT_EQ(std::string(lBuffer.data(), lWriter.Size()),
+            std::string("\x00\x02\x01\x00\x00\x00\x00\x00\x00"
+                        "\x02\x00\x00\x80\x3f",
+                        14));
+}
+
+TEST(DeferredArgsTest, BufferTooSmall) {
+  std::array<char, 12> lBuffer{};
+  Stroalgo::Log::DeferredArgWriter lWriter{lBuffer.data(), lBuffer.size()};
+  EXPECT_TRUE(lWriter.Write(1));
+  EXPECT_FALSE(lWriter.Write(2));
+  EXPECT_FALSE(lWriter.Write(std::string{"too long"}));
+  EXPECT_EQ(lWriter.Size(), 1 + sizeof(std::int64_t));
+}
+
+TEST(DeferredArgsTest, NullCString) {
+  std::array<char, 32> lBuffer{};
+  Stroalgo::Log::DeferredArgWriter lWriter{lBuffer.data(), lBuffer.size()};
+  const char *lNull{nullptr};
+  EXPECT_FALSE(lWriter.Write(lNull));
+}
+
+TEST(DeferredArgsTest, CorruptedArgs) {
+  fmt::memory_buffer lOut{};
+  const std::string lUnknownType{"\x7f"};
+  EXPECT_FALSE(Stroalgo::Log::FormatDeferredArgs("{}", lUnknownType, lOut));
+  const std::string lTruncated{"\x00\x01", 2};
+  EXPECT_FALSE(Stroalgo::Log::FormatDeferredArgs("{}", lTruncated, lOut));
+  EXPECT_EQ(lOut.size(), 0U);
+}
+
+TEST(DeferredArgsTest, InternedFormats) {
+  std::string lFormat{"Interned {}"};
+  const std::string_view lInterned{Stroalgo::Log::InternFormat(lFormat)};
+  EXPECT_EQ(lInterned, "Interned {}");
+  EXPECT_NE(lInterned.data(), lFormat.data());
+  EXPECT_EQ(Stroalgo::Log::InternFormat(std::string{"Interned {}"}).data(),
+            lInterned.data());
+
+  // Another format built at the same address is not mistaken for the first
+  lFormat.replace(0, 8, "Reworded");
+  EXPECT_EQ(Stroalgo::Log::InternFormat(lFormat), "Reworded {}");
+  EXPECT_EQ(Stroalgo::Log::InternFormat("Interned {}").data(),
+            lInterned.data());
+}
+
+TEST(DeferredArgsTest, RuntimeFormatFreedBeforeWrite) {
+  Stroalgo::Log::LogRecord lRecord{};
+  {
+    std::string lFormat{"Runtime {} of {}"};
+    const bool lCaptured{
+        lRecord.Capture<int, int>(fmt::runtime(lFormat), 1, 2)};
+    ASSERT_TRUE(lCaptured);
+    lFormat.assign(lFormat.size(), 'x');
+  }
+
+  fmt::memory_buffer lOut{};
+  EXPECT_TRUE(Stroalgo::Log::FormatDeferredArgs(lRecord.m_Format,
+                                                lRecord.Payload(), lOut));
+  EXPECT_EQ(fmt::to_string(lOut), "Runtime 1 of 2");
+}
@@ -0,0 +1,59 @@
+/**
+ * @file DurationHistogram_unitTest.cpp
+ * @brief Contains all units tests for the DurationHistogram class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "DurationHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+TEST(DurationHistogramTest, Buckets) {
+  Stroalgo::Log::DurationHistogram lHistogram{};
+  lHistogram.Record(std::chrono::nanoseconds{500});
+  lHistogram.Record(std::chrono::microseconds{1});
+  lHistogram.Record(std::chrono::microseconds{3});
+  lHistogram.Record(std::chrono::milliseconds{1});
+  lHistogram.Record(std::chrono::seconds{10});
+  lHistogram.Record(std::chrono::nanoseconds{-5});
+
+  // Bucket i holds durations from 2^(i-1) to 2^i microseconds
+  const auto lSnapshot{lHistogram.Snapshot()};
+  EXPECT_EQ(lSnapshot.m_Count, 6U);
+  EXPECT_EQ(lSnapshot.m_Counts[0], 2U);
+  EXPECT_EQ(lSnapshot.m_Counts[1], 1U);
+  EXPECT_EQ(lSnapshot.m_Counts[2], 1U);
+  EXPECT_EQ(lSnapshot.m_Counts[10], 1U);
+  EXPECT_EQ(lSnapshot.m_Counts[Stroalgo::Log::c_HistogramBuckets - 1], 1U);
+  EXPECT_EQ(lSnapshot.m_Max, std::chrono::seconds{10});
+  EXPECT_EQ(lSnapshot.m_Total, std::chrono::nanoseconds{10001004500});
+  EXPECT_EQ(Stroalgo::Log::HistogramSnapshot::UpperBound(10),
+            std::chrono::microseconds{1024});
+}
+
+TEST(DurationHistogramTest, ConcurrentRecords) {
+  constexpr std::size_t lThreads{4};
+  constexpr std::size_t lRecords{10000};
+  Stroalgo::Log::DurationHistogram lHistogram{};
+  std::vector<std::thread> lWriters{};
+  for (std::size_t lThread = 0; lThread < lThreads; ++lThread) {
+    lWriters.emplace_back([&lHistogram, lThread]() {
+      for (std::size_t lIndex = 0; lIndex < lRecords; ++lIndex) {
+        lHistogram.Record(std::chrono::microseconds{lThread + 1});
+      }
+    });
+  }
+  for (auto &lWriter : lWriters) {
+    lWriter.join();
+  }
+
+  // Expect no lost update
+  const auto lSnapshot{lHistogram.Snapshot()};
+  EXPECT_EQ(lSnapshot.m_Count, lThreads * lRecords);
+  EXPECT_EQ(lSnapshot.m_Max, std::chrono::microseconds{lThreads});
+}
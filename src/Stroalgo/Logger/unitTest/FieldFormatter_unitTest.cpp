@@ -0,0 +1,133 @@
+/**
+ * @file FieldFormatter_unitTest.cpp
+ * @brief Contains all units tests for the FieldFormatter class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "FieldFormatter.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/pattern_formatter.h>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include "StructuredFields.h"
+
+namespace {
+
+/**
+ * @brief Format a message with a formatter
+ *
+ * @param pFormatter Formatter to use
+ * @param pMsg The message
+ * @return The formatted message
+ */
+std::string Format(spdlog::formatter &pFormatter,
+                   const spdlog::details::log_msg &pMsg) {
+  spdlog::memory_buf_t lBuffer{};
+  pFormatter.format(pMsg, lBuffer);
+  return fmt::to_string(lBuffer);
+}
+
+/**
+ * @brief Build a message
+ *
+ * @param pTime Time of the message
+ * @return A warning message from Module
+ */
+spdlog::details::log_msg MakeMessage(spdlog::log_clock::time_point pTime) {
+  spdlog::details::log_msg lMsg{pTime, spdlog::source_loc{}, "Module",
+                                spdlog::level::warn, "Formatted message"};
+  lMsg.thread_id = 1234;
+  return lMsg;
+}
+
+}  // namespace
+
+TEST(FieldFormatterTest, SameOutputAsPatterns) {
+  Stroalgo::Log::FieldFormatter lText{Stroalgo::Log::LogFraming::Text,
+                                      Stroalgo::Log::LogFields{}};
+  spdlog::pattern_formatter lTextPattern{
+      "%^[%Y-%m-%d %H:%M:%S.%e] [%n] [%l] ---> %v%$"};
+  Stroalgo::Log::FieldFormatter lJson{
+      Stroalgo::Log::LogFraming::Json,
+      Stroalgo::Log::LogFields{true, true, true, true, true}};
+  spdlog::pattern_formatter lJsonPattern{
+      "{\"time\": \"%Y-%m-%d %H:%M:%S.%f%z\", \"name\": \"%n\", \"level\": "
+      "\"%l\", \"process\": %P, \"thread\": %t, \"message\": \"%v\"},"};
+
+  // Consecutive messages in the same second then in the next one
+  const auto lNow{spdlog::log_clock::now()};
+  for (const auto &lTime : {lNow, lNow + std::chrono::microseconds{1234},
+                            lNow + std::chrono::seconds{1}}) {
+    const auto lMsg{MakeMessage(lTime)};
+    EXPECT_EQ(Format(lText, lMsg), Format(lTextPattern, lMsg));
+    EXPECT_EQ(Format(lJson, lMsg), Format(lJsonPattern, lMsg));
+  }
+}
+
+TEST(FieldFormatterTest, ColorRange) {
+  Stroalgo::Log::FieldFormatter lText{Stroalgo::Log::LogFraming::Text,
+                                      Stroalgo::Log::LogFields{}};
+  const auto lMsg{MakeMessage(spdlog::log_clock::now())};
+  const std::string lLine{Format(lText, lMsg)};
+  EXPECT_EQ(lMsg.color_range_start, 0U);
+  EXPECT_EQ(lMsg.color_range_end, lLine.size() - 1);
+}
+
+TEST(FieldFormatterTest, FieldsOptOut) {
+  const auto lMsg{MakeMessage(spdlog::log_clock::now())};
+
+  Stroalgo::Log::LogFields lFields{};
+  lFields.m_Time = false;
+  lFields.m_Name = false;
+  lFields.m_Thread = true;
+  Stroalgo::Log::FieldFormatter lText{Stroalgo::Log::LogFraming::Text, lFields};
+  EXPECT_EQ(Format(lText, lMsg), "[warning] [1234] ---> Formatted message\n");
+
+  Stroalgo::Log::FieldFormatter lJson{Stroalgo::Log::LogFraming::Json, lFields};
+  EXPECT_EQ(Format(lJson, lMsg),
+            "{\"level\": \"warning\", \"thread\": 1234, \"message\": "
+            "\"Formatted message\"},\n");
+
+  // Clone keeps the framing and the fields
+  const auto lClone{lJson.clone()};
+  EXPECT_EQ(Format(*lClone, lMsg), Format(lJson, lMsg));
+}
+
+TEST(FieldFormatterTest, JsonEscapedMessageAndFields) {
+  Stroalgo::Log::LogFields lFields{};
+  lFields.m_Time = false;
+  lFields.m_Name = false;
+  spdlog::memory_buf_t lPayload{};
+  const std::string_view lMessage{"Said \"hi\"\n"};
+  lPayload.append(lMessage.data(), lMessage.data() + lMessage.size());
+  lPayload.push_back(Stroalgo::Log::c_FieldsSeparator);
+  Stroalgo::Log::AppendJsonMembers(lPayload, Stroalgo::Log::Kv("user", 42),
+                                   Stroalgo::Log::Kv("ok", true));
+  const spdlog::details::log_msg lMsg{
+      spdlog::log_clock::now(), Stroalgo::Log::StructuredSource(), "Module",
+      spdlog::level::info,
+      spdlog::string_view_t{lPayload.data(), lPayload.size()}};
+
+  Stroalgo::Log::FieldFormatter lJson{Stroalgo::Log::LogFraming::Json, lFields};
+  EXPECT_EQ(Format(lJson, lMsg),
+            "{\"level\": \"info\", \"message\": \"Said \\\"hi\\\"\\n\", "
+            "\"user\": 42, \"ok\": true},\n");
+
+  Stroalgo::Log::FieldFormatter lText{Stroalgo::Log::LogFraming::Text, lFields};
+  EXPECT_EQ(Format(lText, lMsg),
+            "[info] ---> Said \"hi\"\n {\"user\": 42, \"ok\": true}\n");
+
+  // The same payload in a message without fields is only text
+  const spdlog::details::log_msg lPlain{
+      spdlog::log_clock::now(), spdlog::source_loc{}, "Module",
+      spdlog::level::info,
+      spdlog::string_view_t{lPayload.data(), lPayload.size()}};
+  EXPECT_EQ(Format(lJson, lPlain),
+            "{\"level\": \"info\", \"message\": \"Said \\\"hi\\\"\\n"
+            "\\u001e\\\"user\\\": 42, \\\"ok\\\": true\"},\n");
+}
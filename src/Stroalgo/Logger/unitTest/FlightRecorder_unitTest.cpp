@@ -0,0 +1,244 @@
+/**
+ * @file FlightRecorder_unitTest.cpp
+ * @brief Contains all units tests for the FlightRecorder class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#ifdef STROALGO_LOG_MAPPED_FILES
+#include "FlightRecorder.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/logger.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "LogClock.h"
+#include "LogTestHelpers.h"
+#include "ProcessIdentity.h"
+
+class FlightRecorderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all("FlightLogs");
+    m_Options.m_Size = 4096;
+    m_Options.m_DumpOnFatalSignal = false;
+  }
+
+  void TearDown() override { std::filesystem::remove_all("FlightLogs"); }
+
+  /**
+   * @brief Create a recorder of the test module
+   *
+   * @return The recorder
+   */
+  std::shared_ptr<Stroalgo::Log::FlightRecorder> MakeRecorder() const {
+    return std::make_shared<Stroalgo::Log::FlightRecorder>(
+        "FlightLogs/Flight_Module.flight", "FlightLogs/Flight_Module.slog",
+        "Flight_Module", 3, m_Options);
+  }
+
+  /**
+   * @brief List the ring images of the test module
+   *
+   * @return Paths of the images, sorted
+   */
+  static std::vector<std::string> ListImages() {
+    std::vector<std::string> lRet{};
+    for (const auto &lFile :
+         std::filesystem::directory_iterator{"FlightLogs"}) {
+      const std::string lName{lFile.path().filename().string()};
+      if (lName.rfind("Flight_Module.", 0) == 0 &&
+          lFile.path().extension() == ".flight") {
+        lRet.push_back(lFile.path().string());
+      }
+    }
+    std::sort(lRet.begin(), lRet.end());
+    return lRet;
+  }
+
+  /**
+   * @brief Read the messages of a binary log file
+   *
+   * @param pFilePath Path of the file
+   * @return The messages, in file order
+   */
+  static std::vector<std::string> ReadMessages(const std::string &pFilePath) {
+    Stroalgo::Log::BinaryLogReader lReader{pFilePath};
+    EXPECT_TRUE(lReader.IsValid());
+    EXPECT_EQ(lReader.GetModuleName(), "Flight_Module");
+    EXPECT_EQ(lReader.GetModuleId(), 3U);
+    return LogTest::DrainMessages(lReader);
+  }
+
+  /**
+   * @brief Keep a trace record
+   *
+   * @param pRecorder The recorder
+   * @param pNumber Number of the message
+   */
+  static void RecordTrace(Stroalgo::Log::FlightRecorder &pRecorder,
+                          int pNumber) {
+    pRecorder.Record(spdlog::level::trace, Stroalgo::Log::LogClockNow(), 1,
+                     "Trace message " + std::to_string(pNumber), false);
+  }
+
+  /**
+   * @brief Size, trigger and backing of the tested rings
+   */
+  Stroalgo::Log::FlightRecorderOptions m_Options{};
+};
+
+TEST_F(FlightRecorderTest, RingKeepsLastRecords) {
+  auto lRecorder{MakeRecorder()};
+  EXPECT_EQ(lRecorder->GetOptions().m_Size, 4096U);
+  for (int lNumber = 0; lNumber < 1000; ++lNumber) {
+    RecordTrace(*lRecorder, lNumber);
+  }
+  EXPECT_EQ(lRecorder->GetRecordedRecords(), 1000U);
+  EXPECT_FALSE(std::filesystem::exists(lRecorder->GetDumpFilename()));
+
+  // The oldest records are overwritten, the kept ones are consecutive
+  const std::size_t lDumped{lRecorder->Dump()};
+  const auto lMessages{ReadMessages(lRecorder->GetDumpFilename())};
+  ASSERT_EQ(lMessages.size(), lDumped);
+  EXPECT_GT(lDumped, 50U);
+  EXPECT_LT(lDumped, 1000U);
+  for (std::size_t lIndex = 0; lIndex < lMessages.size(); ++lIndex) {
+    EXPECT_EQ(lMessages[lIndex],
+              "Trace message " +
+                  std::to_string(1000 - lMessages.size() + lIndex));
+  }
+
+  // A record larger than the ring is not kept
+  lRecorder->Record(spdlog::level::trace, Stroalgo::Log::LogClockNow(), 1,
+                    std::string(8192, 'x'), false);
+  EXPECT_EQ(lRecorder->GetRecordedRecords(), 1000U);
+  EXPECT_EQ(lRecorder->Dump(), 0U);
+  EXPECT_EQ(lRecorder->GetDumps(), 1U);
+}
+
+TEST_F(FlightRecorderTest, TriggerLevelDumpsContext) {
+  auto lRecorder{MakeRecorder()};
+  spdlog::logger lLogger{"Flight_Module", lRecorder};
+  lLogger.set_level(spdlog::level::trace);
+  RecordTrace(*lRecorder, 1);
+  RecordTrace(*lRecorder, 2);
+  lLogger.warn("Warning message");
+  EXPECT_FALSE(std::filesystem::exists(lRecorder->GetDumpFilename()));
+
+  // The error comes with the records preceding it
+  lLogger.error("Error message");
+  EXPECT_EQ(ReadMessages(lRecorder->GetDumpFilename()),
+            (std::vector<std::string>{"Trace message 1", "Trace message 2",
+                                      "Warning message", "Error message"}));
+
+  // The next dump appends the new records only
+  RecordTrace(*lRecorder, 3);
+  lLogger.critical("Critical message");
+  EXPECT_EQ(ReadMessages(lRecorder->GetDumpFilename()),
+            (std::vector<std::string>{"Trace message 1", "Trace message 2",
+                                      "Warning message", "Error message",
+                                      "Trace message 3", "Critical message"}));
+  EXPECT_EQ(lRecorder->GetDumps(), 2U);
+}
+
+TEST_F(FlightRecorderTest, FatalSignalWritesImage) {
+  m_Options.m_DumpOnFatalSignal = true;
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  EXPECT_DEATH(
+      {
+        auto lRecorder{MakeRecorder()};
+        RecordTrace(*lRecorder, 1);
+        RecordTrace(*lRecorder, 2);
+        std::abort();
+      },
+      "");
+
+  // The image of the anonymous ring is extracted by the next process
+  const auto lImages{ListImages()};
+  ASSERT_EQ(lImages.size(), 1U);
+  EXPECT_EQ(Stroalgo::Log::ExtractFlightRecording(lImages[0],
+                                                  "FlightLogs/Crash.slog"),
+            2U);
+  EXPECT_EQ(ReadMessages("FlightLogs/Crash.slog"),
+            (std::vector<std::string>{"Trace message 1", "Trace message 2"}));
+
+  // or recovered by the next recorder of the module
+  auto lRecorder{MakeRecorder()};
+  EXPECT_EQ(lRecorder->GetDumps(), 1U);
+  EXPECT_TRUE(ListImages().empty());
+  EXPECT_EQ(ReadMessages(lRecorder->GetDumpFilename()),
+            (std::vector<std::string>{"Trace message 1", "Trace message 2"}));
+}
+
+TEST_F(FlightRecorderTest, FileBackedRingSurvivesExit) {
+  m_Options.m_FileBacked = true;
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  EXPECT_EXIT(
+      {
+        auto lRecorder{MakeRecorder()};
+        RecordTrace(*lRecorder, 1);
+        lRecorder->Dump();
+        RecordTrace(*lRecorder, 2);
+        ::_exit(0);
+      },
+      ::testing::ExitedWithCode(0), "");
+
+  // Only the records not dumped by the process are recovered
+  const auto lImages{ListImages()};
+  ASSERT_EQ(lImages.size(), 1U);
+  EXPECT_EQ(Stroalgo::Log::ExtractFlightRecording(lImages[0],
+                                                  "FlightLogs/Exit.slog", true),
+            1U);
+  EXPECT_EQ(ReadMessages("FlightLogs/Exit.slog"),
+            (std::vector<std::string>{"Trace message 2"}));
+
+  // A clean shutdown leaves no image
+  {
+    auto lRecorder{MakeRecorder()};
+    EXPECT_EQ(lRecorder->GetDumps(), 1U);
+    EXPECT_EQ(ListImages(),
+              std::vector<std::string>{lRecorder->GetImageFilename()});
+  }
+  EXPECT_TRUE(ListImages().empty());
+
+  // Images are checked before being read
+  EXPECT_FALSE(Stroalgo::Log::ExtractFlightRecording("FlightLogs/Exit.slog",
+                                                     "FlightLogs/Other.slog")
+                   .has_value());
+}
+
+TEST_F(FlightRecorderTest, LiveImagesKept) {
+  m_Options.m_FileBacked = true;
+  auto lRecorder{MakeRecorder()};
+  RecordTrace(*lRecorder, 1);
+  RecordTrace(*lRecorder, 2);
+
+  // The image of a live process, this one or another, is neither read nor
+  // replaced by a new recorder of the module
+  const auto lParentId{static_cast<std::uint32_t>(::getppid())};
+  const std::string lParentImage{Stroalgo::Log::GetFlightImageFilename(
+      "FlightLogs/Flight_Module.flight", lParentId,
+      Stroalgo::Log::GetProcessStartTime(lParentId), 0)};
+  std::filesystem::copy_file(lRecorder->GetImageFilename(), lParentImage);
+  {
+    auto lOther{MakeRecorder()};
+    EXPECT_NE(lOther->GetImageFilename(), lRecorder->GetImageFilename());
+    EXPECT_EQ(lOther->GetDumps(), 0U);
+    EXPECT_EQ(ListImages().size(), 3U);
+  }
+  EXPECT_TRUE(std::filesystem::exists(lParentImage));
+  EXPECT_EQ(lRecorder->Dump(), 2U);
+  EXPECT_EQ(ReadMessages(lRecorder->GetDumpFilename()),
+            (std::vector<std::string>{"Trace message 1", "Trace message 2"}));
+}
+#endif
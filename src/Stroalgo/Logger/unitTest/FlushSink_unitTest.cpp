@@ -0,0 +1,117 @@
+/**
+ * @file FlushSink_unitTest.cpp
+ * @brief Contains all units tests for the FlushSink class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "FlushSink.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Sink counting the records and flushes it receives
+ */
+class CountingSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  int m_Records{0};
+  int m_Flushes{0};
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg &) override { ++m_Records; }
+  void flush_() override { ++m_Flushes; }
+};
+
+}  // namespace
+
+class FlushSinkTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_Logger = std::make_shared<spdlog::logger>(
+        "Flush_Module", spdlog::sinks_init_list{m_Counting, m_Flush});
+    m_Logger->set_level(spdlog::level::trace);
+    m_Logger->flush_on(spdlog::level::off);
+    m_Flush->SetLogger(m_Logger.get());
+  }
+
+  std::shared_ptr<CountingSink> m_Counting{std::make_shared<CountingSink>()};
+  std::shared_ptr<Stroalgo::Log::FlushSink> m_Flush{
+      std::make_shared<Stroalgo::Log::FlushSink>()};
+  std::shared_ptr<spdlog::logger> m_Logger{nullptr};
+};
+
+TEST_F(FlushSinkTest, DefaultFlushEveryRecord) {
+  m_Logger->trace("First");
+  m_Logger->info("Second");
+  EXPECT_EQ(m_Counting->m_Records, 2);
+  EXPECT_EQ(m_Counting->m_Flushes, 2);
+}
+
+TEST_F(FlushSinkTest, BatchByRecordsAndLevel) {
+  Stroalgo::Log::FlushPolicy lPolicy{};
+  lPolicy.m_MaxRecords = 3;
+  lPolicy.m_Level = spdlog::level::err;
+  m_Flush->SetPolicy(lPolicy);
+  EXPECT_EQ(m_Flush->GetPolicy().m_MaxRecords, 3U);
+  EXPECT_EQ(m_Flush->GetPolicy().m_Level, spdlog::level::err);
+
+  // Third record completes the batch
+  m_Logger->info("1");
+  m_Logger->info("2");
+  EXPECT_EQ(m_Counting->m_Flushes, 0);
+  m_Logger->info("3");
+  EXPECT_EQ(m_Counting->m_Flushes, 1);
+
+  // Errors are flushed immediately and start a new batch
+  m_Logger->info("4");
+  m_Logger->error("5");
+  EXPECT_EQ(m_Counting->m_Flushes, 2);
+  m_Logger->info("6");
+  m_Logger->info("7");
+  EXPECT_EQ(m_Counting->m_Flushes, 2);
+}
+
+TEST_F(FlushSinkTest, BatchByBytes) {
+  Stroalgo::Log::FlushPolicy lPolicy{};
+  lPolicy.m_MaxBytes = 10;
+  lPolicy.m_Level = spdlog::level::off;
+  m_Flush->SetPolicy(lPolicy);
+
+  m_Logger->info("12345");
+  EXPECT_EQ(m_Counting->m_Flushes, 0);
+  m_Logger->info("67890");
+  EXPECT_EQ(m_Counting->m_Flushes, 1);
+  // Level threshold is off
+  m_Logger->critical("!");
+  EXPECT_EQ(m_Counting->m_Flushes, 1);
+}
+
+TEST_F(FlushSinkTest, FlushAfterInterval) {
+  Stroalgo::Log::FlushPolicy lPolicy{};
+  lPolicy.m_Interval = std::chrono::milliseconds{20};
+  lPolicy.m_Level = spdlog::level::off;
+  m_Flush->SetPolicy(lPolicy);
+  m_Flush->FlushNow();
+  m_Counting->m_Flushes = 0;
+
+  // Nothing pending, nothing due
+  std::this_thread::sleep_for(std::chrono::milliseconds{30});
+  m_Flush->FlushIfDue();
+  EXPECT_EQ(m_Counting->m_Flushes, 0);
+
+  m_Flush->FlushNow();
+  m_Counting->m_Flushes = 0;
+  m_Logger->info("Pending");
+  m_Flush->FlushIfDue();
+  EXPECT_EQ(m_Counting->m_Flushes, 0);
+  std::this_thread::sleep_for(std::chrono::milliseconds{30});
+  m_Flush->FlushIfDue();
+  EXPECT_EQ(m_Counting->m_Flushes, 1);
+}
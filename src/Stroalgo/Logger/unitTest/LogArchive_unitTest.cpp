@@ -0,0 +1,198 @@
+/**
+ * @file LogArchive_unitTest.cpp
+ * @brief Contains all units tests for the archives of the log files
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogArchive.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/details/os.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BinaryFileSink.h"
+#include "BinaryLogIndex.h"
+#include "LogFileLock.h"
+#include "LogQuery.h"
+#include "LogTestHelpers.h"
+
+class LogArchiveTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::create_directories("ArchiveLogs/Module");
+    std::ofstream lFile{c_TextFile};
+    for (int lNumber = 0; lNumber < 5000; ++lNumber) {
+      lFile << "[info] Archived line " << lNumber << "\n";
+    }
+  }
+
+  void TearDown() override { std::filesystem::remove_all("ArchiveLogs"); }
+
+  /**
+   * @brief Read a whole file, archives are decompressed
+   *
+   * @param pFilePath Path of the file
+   * @return Its original bytes
+   */
+  static std::string ReadAll(const std::string &pFilePath) {
+    const auto lBuffer{Stroalgo::Log::OpenLogFileBuffer(pFilePath)};
+    std::istream lStream{lBuffer.get()};
+    return std::string{std::istreambuf_iterator<char>{lStream},
+                       std::istreambuf_iterator<char>{}};
+  }
+
+  /**
+   * @brief Text file of a previous day
+   */
+  static constexpr const char *c_TextFile{
+      "ArchiveLogs/Module/Module_2020-01-01.txt"};
+};
+
+TEST_F(LogArchiveTest, TextArchive) {
+  const std::string lExpected{ReadAll(c_TextFile)};
+  ASSERT_TRUE(Stroalgo::Log::LogArchiver::ArchiveFile(c_TextFile, 4096));
+  const std::string lArchive{
+      Stroalgo::Log::GetLogArchiveFilename(c_TextFile)};
+  EXPECT_FALSE(std::filesystem::exists(c_TextFile));
+  EXPECT_LT(std::filesystem::file_size(lArchive), lExpected.size() / 2);
+  EXPECT_EQ(ReadAll(lArchive), lExpected);
+
+  Stroalgo::Log::LogArchiveBuffer lBuffer{lArchive};
+  ASSERT_TRUE(lBuffer.IsValid());
+  EXPECT_EQ(lBuffer.GetSize(), lExpected.size());
+  EXPECT_EQ(lBuffer.GetBlocks().size(), (lExpected.size() + 4095) / 4096);
+
+  // Seeks across blocks, backwards and past the end
+  std::istream lStream{&lBuffer};
+  std::string lLine{};
+  for (const std::size_t lOffset : {std::size_t{10000}, std::size_t{4095},
+                                    std::size_t{0}, lExpected.size() - 10}) {
+    lStream.clear();
+    lStream.seekg(static_cast<std::streamoff>(lOffset));
+    ASSERT_TRUE(std::getline(lStream, lLine));
+    EXPECT_EQ(lLine + "\n",
+              lExpected.substr(lOffset, lExpected.find('\n', lOffset) + 1 -
+                                            lOffset));
+  }
+  lStream.seekg(static_cast<std::streamoff>(lExpected.size() + 1));
+  EXPECT_FALSE(std::getline(lStream, lLine));
+
+  // A truncated archive has no index
+  std::filesystem::resize_file(lArchive,
+                               std::filesystem::file_size(lArchive) - 1);
+  EXPECT_FALSE(Stroalgo::Log::LogArchiveBuffer{lArchive}.IsValid());
+}
+
+TEST_F(LogArchiveTest, BinaryArchive) {
+  const auto lStart{spdlog::log_clock::now() - std::chrono::hours{1}};
+  std::string lFilePath{};
+  {
+    Stroalgo::Log::BinaryFileSink lSink{"ArchiveLogs/Module/Module.slog",
+                                        "Module", 0};
+    lFilePath = lSink.GetFilename();
+    Stroalgo::Log::LogRecord lRecord{};
+    lRecord.m_Level = spdlog::level::info;
+    for (int lNumber = 0; lNumber < 3000; ++lNumber) {
+      lRecord.m_Time = lStart + std::chrono::milliseconds{lNumber};
+      ASSERT_TRUE(lRecord.Capture<int>("Archived record {}", lNumber));
+      lSink.WriteRecord(lRecord);
+    }
+  }
+
+  // Archive of a copy dated of a previous day
+  const std::string lOldFile{"ArchiveLogs/Module/Module_2020-01-02.slog"};
+  std::filesystem::copy_file(lFilePath, lOldFile);
+  std::filesystem::copy_file(Stroalgo::Log::GetBinaryIndexFilename(lFilePath),
+                             Stroalgo::Log::GetBinaryIndexFilename(lOldFile));
+  ASSERT_TRUE(Stroalgo::Log::LogArchiver::ArchiveFile(lOldFile, 8192));
+  const std::string lArchive{Stroalgo::Log::GetLogArchiveFilename(lOldFile)};
+  EXPECT_TRUE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryIndexFilename(lArchive)));
+
+  // The time index still applies, a single block is decompressed
+  const auto lFrom{lStart + std::chrono::milliseconds{2000}};
+  const auto lTo{lStart + std::chrono::milliseconds{2009}};
+  const auto lMessages{LogTest::ReadMessages(lArchive, lFrom, lTo)};
+  ASSERT_EQ(lMessages.size(), 10U);
+  EXPECT_EQ(lMessages.front(), "Archived record 2000");
+  EXPECT_EQ(lMessages, LogTest::ReadMessages(lFilePath, lFrom, lTo));
+  EXPECT_EQ(LogTest::ReadMessages(lArchive).size(), 3000U);
+
+  // Queries read the archives
+  Stroalgo::Log::LogQueryOptions lOptions{};
+  lOptions.m_Directory = "ArchiveLogs";
+  Stroalgo::Log::LogQuery lQuery{lOptions};
+  EXPECT_EQ(lQuery.GetFiles().size(), 2U);
+  std::size_t lCount{0};
+  Stroalgo::Log::LogQueryItem lItem{};
+  while (lQuery.Next(lItem)) {
+    ++lCount;
+  }
+  EXPECT_EQ(lCount, 6000U);
+}
+
+TEST_F(LogArchiveTest, ArchivePending) {
+  // File of the previous day, recent file, expired archive, file of a later
+  // day
+  const std::time_t lYesterday{spdlog::log_clock::to_time_t(
+      spdlog::log_clock::now() - std::chrono::hours{24})};
+  const std::tm lDate{spdlog::details::os::localtime(lYesterday)};
+  std::ostringstream lName{};
+  lName << "ArchiveLogs/Module/Module_" << std::put_time(&lDate, "%Y-%m-%d")
+        << ".json";
+  const std::string lPrevious{lName.str()};
+  std::ofstream{lPrevious} << "{}\n";
+  const auto lOld{std::filesystem::file_time_type::clock::now() -
+                  std::chrono::hours{2}};
+  std::filesystem::last_write_time(lPrevious, lOld);
+  const std::string lExpired{"ArchiveLogs/Module/Module_2000-01-01.txt.slz"};
+  std::ofstream{lExpired} << "expired";
+  const std::string lLater{"ArchiveLogs/Module/Module_2999-01-01.txt"};
+  std::ofstream{lLater} << "later\n";
+  std::filesystem::last_write_time(lLater, lOld);
+
+  Stroalgo::Log::ArchiveOptions lOptions{};
+  lOptions.m_Interval = std::chrono::hours{1};
+  Stroalgo::Log::LogArchiver lArchiver{"ArchiveLogs", lOptions};
+  EXPECT_EQ(lArchiver.ArchivePending(), 1U);
+  EXPECT_EQ(ReadAll(Stroalgo::Log::GetLogArchiveFilename(lPrevious)),
+            "{}\n");
+  EXPECT_TRUE(std::filesystem::exists(c_TextFile));
+  EXPECT_TRUE(std::filesystem::exists(lLater));
+  EXPECT_FALSE(std::filesystem::exists(lExpired));
+  EXPECT_EQ(lArchiver.ArchivePending(), 0U);
+  EXPECT_FALSE(std::filesystem::exists(lPrevious));
+}
+
+TEST(LogFileLockTest, FileAndArchiveShareLock) {
+  std::atomic<bool> lLocked{false};
+  std::thread lOther{};
+  {
+    const Stroalgo::Log::LogFileLock lLock{"ArchiveLogs/Module/Module.slog"};
+
+    // Another file is not blocked
+    { const Stroalgo::Log::LogFileLock lFree{"ArchiveLogs/Module/Other.slog"}; }
+
+    // The archive of the file waits, whatever the spelling of its path
+    lOther = std::thread{[&lLocked]() {
+      const Stroalgo::Log::LogFileLock lArchive{
+          "./ArchiveLogs/Module/../Module/Module.slog.slz"};
+      lLocked = true;
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(lLocked);
+  }
+  lOther.join();
+  EXPECT_TRUE(lLocked);
+}
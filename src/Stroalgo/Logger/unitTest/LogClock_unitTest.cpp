@@ -0,0 +1,105 @@
+/**
+ * @file LogClock_unitTest.cpp
+ * @brief Contains all units tests for the record clock and the local dates
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogClock.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/details/os.h>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Render a local date and time with strftime
+ *
+ * @param pSecond Time to render
+ * @return "YYYY-MM-DD HH:MM:SS"
+ */
+std::string Reference(std::time_t pSecond) {
+  const std::tm lDate{spdlog::details::os::localtime(pSecond)};
+  std::array<char, 32> lText{};
+  const std::size_t lSize{
+      std::strftime(lText.data(), lText.size(), "%Y-%m-%d %H:%M:%S", &lDate)};
+  return std::string{lText.data(), lSize};
+}
+
+/**
+ * @brief Render a local date and time with FormatLocalDateTime
+ *
+ * @param pSecond Time to render
+ * @return "YYYY-MM-DD HH:MM:SS"
+ */
+std::string Format(std::time_t pSecond) {
+  std::array<char, Stroalgo::Log::c_LocalDateTimeSize> lText{};
+  Stroalgo::Log::FormatLocalDateTime(pSecond, lText.data());
+  return std::string{lText.data(), lText.size()};
+}
+
+}  // namespace
+
+TEST(LogClockTest, SameDatesAsStrftime) {
+  // Every second of an hour, then seconds spread over several years
+  const std::time_t lNow{std::time(nullptr)};
+  for (std::time_t lSecond = lNow; lSecond < lNow + 3600; ++lSecond) {
+    ASSERT_EQ(Format(lSecond), Reference(lSecond));
+  }
+  for (std::time_t lSecond = 1000000000; lSecond < 2000000000;
+       lSecond += 86399 * 7) {
+    ASSERT_EQ(Format(lSecond), Reference(lSecond));
+    ASSERT_EQ(Format(lSecond - 1), Reference(lSecond - 1));
+  }
+
+  // Going back in time renders the previous window again
+  EXPECT_EQ(Format(lNow), Reference(lNow));
+  EXPECT_EQ(Stroalgo::Log::FormatLocalDate(lNow).View(),
+            Reference(lNow).substr(0, Stroalgo::Log::c_LocalDateSize));
+}
+
+TEST(LogClockTest, SameDatesAcrossDaylightSaving) {
+  // Zone changing its offset on the last Sundays of March and October
+  const char *lPrevious{std::getenv("TZ")};
+  const std::string lSaved{lPrevious != nullptr ? lPrevious : ""};
+  setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+  tzset();
+
+  // 2026-03-29 and 2026-10-25 around 01:00 UTC
+  for (const std::time_t lChange : {std::time_t{1774746000},
+                                    std::time_t{1792890000}}) {
+    for (std::time_t lSecond = lChange - 1800; lSecond < lChange + 1800;
+         lSecond += 7) {
+      ASSERT_EQ(Format(lSecond), Reference(lSecond));
+    }
+  }
+
+  if (lPrevious != nullptr) {
+    setenv("TZ", lSaved.c_str(), 1);
+  } else {
+    unsetenv("TZ");
+  }
+  tzset();
+}
+
+TEST(LogClockTest, CoarseClock) {
+  EXPECT_EQ(Stroalgo::Log::GetLogClockSource(),
+            Stroalgo::Log::ClockSource::Precise);
+  Stroalgo::Log::SetLogClockSource(Stroalgo::Log::ClockSource::Coarse);
+  EXPECT_EQ(Stroalgo::Log::GetLogClockSource(),
+            Stroalgo::Log::ClockSource::Coarse);
+
+  // Coarse time lags by a tick at most
+  const auto lCoarse{Stroalgo::Log::LogClockNow()};
+  const auto lPrecise{spdlog::log_clock::now()};
+  EXPECT_LE(lCoarse, lPrecise);
+  EXPECT_LT(lPrecise - lCoarse, std::chrono::milliseconds{50});
+
+  Stroalgo::Log::SetLogClockSource(Stroalgo::Log::ClockSource::Precise);
+  EXPECT_GE(Stroalgo::Log::LogClockNow(), lPrecise);
+}
@@ -0,0 +1,242 @@
+/**
+ * @file LogCompactor_unitTest.cpp
+ * @brief Contains all units tests for the deletion of records by time range
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogCompactor.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "BinaryFileSink.h"
+#include "BinaryLogIndex.h"
+#include "BinaryLogTombstones.h"
+#include "Exceptions.h"
+#include "LogArchive.h"
+#include "LogTestHelpers.h"
+#include "Logger.h"
+
+class LogCompactorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // One error every 100 records, deferred formatting
+    m_Start = spdlog::log_clock::now() - std::chrono::hours{1};
+    Stroalgo::Log::BinaryFileSink lSink{"CompactLogs/Module/Module.slog",
+                                        "Module", 0};
+    m_FilePath = lSink.GetFilename();
+    Stroalgo::Log::LogRecord lRecord{};
+    for (int lNumber = 0; lNumber < 2000; ++lNumber) {
+      lRecord.m_Level = lNumber % 100 == 50 ? spdlog::level::err
+                                            : spdlog::level::info;
+      lRecord.m_Time = GetTime(lNumber);
+      ASSERT_TRUE(lRecord.Capture<int>("Compact record {}", lNumber));
+      lSink.WriteRecord(lRecord);
+    }
+    lSink.flush();
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all("CompactLogs");
+    std::filesystem::remove_all("Logs");
+  }
+
+  /**
+   * @brief Get the time of a record written by SetUp
+   *
+   * @param pNumber Number of the record
+   * @return Its time
+   */
+  spdlog::log_clock::time_point GetTime(int pNumber) const {
+    return m_Start + std::chrono::milliseconds{pNumber};
+  }
+
+  /**
+   * @brief Add a tombstone to a binary log file
+   *
+   * @param pFilePath Path of the binary log file
+   * @param pFirst Number of the first record deleted
+   * @param pLast Number of the last record deleted
+   * @param pLevels Levels deleted
+   */
+  void Delete(const std::string &pFilePath, int pFirst, int pLast,
+              std::uint8_t pLevels = Stroalgo::Log::c_AllLevelsMask) const {
+    Stroalgo::Log::BinaryLogTombstone lTombstone{};
+    lTombstone.m_Start = Stroalgo::Log::ToBinaryTime(GetTime(pFirst));
+    lTombstone.m_End = Stroalgo::Log::ToBinaryTime(GetTime(pLast));
+    lTombstone.m_Levels = pLevels;
+    Stroalgo::Log::AddBinaryTombstone(pFilePath, lTombstone);
+  }
+
+  /**
+   * @brief Time of the first record
+   */
+  spdlog::log_clock::time_point m_Start{};
+
+  /**
+   * @brief Binary log file of the current day
+   */
+  std::string m_FilePath{};
+};
+
+TEST_F(LogCompactorTest, Tombstones) {
+  EXPECT_TRUE(Stroalgo::Log::LoadBinaryTombstones(m_FilePath).empty());
+  const Stroalgo::Log::BinaryLogRangeReader lAll{
+      m_FilePath, spdlog::log_clock::time_point::min(),
+      spdlog::log_clock::time_point::max()};
+  const auto lAllRanges{lAll.GetRanges()};
+  ASSERT_FALSE(lAllRanges.empty());
+
+  // Deleted records are hidden at once
+  Delete(m_FilePath, 100, 199);
+  Delete(m_FilePath, 0, 1999,
+         Stroalgo::Log::GetLevelMask(spdlog::level::err));
+  ASSERT_EQ(Stroalgo::Log::LoadBinaryTombstones(m_FilePath).size(), 2U);
+  const auto lMessages{LogTest::ReadMessages(m_FilePath)};
+  ASSERT_EQ(lMessages.size(), 1900U - 19U);
+  EXPECT_EQ(lMessages[98], "Compact record 99");
+  EXPECT_EQ(lMessages[99], "Compact record 200");
+
+  // Blocks entirely deleted are not read
+  Delete(m_FilePath, 0, 999);
+  Stroalgo::Log::BinaryLogRangeReader lReader{
+      m_FilePath, spdlog::log_clock::time_point::min(),
+      spdlog::log_clock::time_point::max()};
+  ASSERT_FALSE(lReader.GetRanges().empty());
+  EXPECT_GT(lReader.GetRanges().front().first, lAllRanges.front().first);
+  EXPECT_EQ(LogTest::ReadMessages(m_FilePath).size(), 1000U - 10U);
+
+  // Tombstones added after a compaction started are kept
+  Stroalgo::Log::RemoveBinaryTombstones(m_FilePath, 2);
+  EXPECT_EQ(Stroalgo::Log::LoadBinaryTombstones(m_FilePath).size(), 1U);
+  Stroalgo::Log::RemoveBinaryTombstones(m_FilePath, 1);
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(m_FilePath)));
+  EXPECT_EQ(LogTest::ReadMessages(m_FilePath).size(), 2000U);
+}
+
+TEST_F(LogCompactorTest, CompactFile) {
+  EXPECT_FALSE(Stroalgo::Log::LogCompactor::CompactFile(m_FilePath));
+  Delete(m_FilePath, 0, 1499);
+  Delete(m_FilePath, 0, 1999,
+         Stroalgo::Log::GetLevelMask(spdlog::level::err));
+  const auto lExpected{LogTest::ReadMessages(m_FilePath)};
+  ASSERT_EQ(lExpected.size(), 495U);
+  const auto lSize{std::filesystem::file_size(m_FilePath)};
+
+  // Same records in a smaller file, still indexed
+  ASSERT_TRUE(Stroalgo::Log::LogCompactor::CompactFile(m_FilePath));
+  EXPECT_LT(std::filesystem::file_size(m_FilePath), lSize);
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(m_FilePath)));
+  EXPECT_FALSE(std::filesystem::exists(m_FilePath + ".compact"));
+  EXPECT_EQ(LogTest::ReadMessages(m_FilePath), lExpected);
+  const Stroalgo::Log::BinaryLogIndex lIndex{m_FilePath};
+  ASSERT_TRUE(lIndex.IsValid());
+  EXPECT_FALSE(lIndex.GetBlocks().empty());
+  Stroalgo::Log::BinaryLogRangeReader lReader{m_FilePath, GetTime(1900),
+                                              GetTime(1909)};
+  EXPECT_EQ(lReader.GetModuleName(), "Module");
+  Stroalgo::Log::BinaryLogEntry lEntry{};
+  ASSERT_TRUE(lReader.Next(lEntry));
+  EXPECT_EQ(lEntry.m_Message, "Compact record 1900");
+
+  // Nothing left, the file goes
+  Delete(m_FilePath, 0, 1999);
+  ASSERT_TRUE(Stroalgo::Log::LogCompactor::CompactFile(m_FilePath));
+  EXPECT_FALSE(std::filesystem::exists(m_FilePath));
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryIndexFilename(m_FilePath)));
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(m_FilePath)));
+}
+
+TEST_F(LogCompactorTest, CompactPending) {
+  // A file of a previous day next to the file of the current day
+  const std::string lOldFile{"CompactLogs/Module/Module_2020-01-01.slog"};
+  std::filesystem::copy_file(m_FilePath, lOldFile);
+  std::filesystem::copy_file(Stroalgo::Log::GetBinaryIndexFilename(m_FilePath),
+                             Stroalgo::Log::GetBinaryIndexFilename(lOldFile));
+  Delete(m_FilePath, 0, 999);
+  Delete(lOldFile, 0, 999);
+
+  Stroalgo::Log::LogCompactor lCompactor{"CompactLogs",
+                                         std::chrono::hours{1}};
+
+  // Written recently, the sink may still append the end of the day
+  EXPECT_EQ(lCompactor.CompactPending(), 0U);
+  std::filesystem::last_write_time(
+      lOldFile,
+      std::filesystem::file_time_type::clock::now() - std::chrono::hours{2});
+  EXPECT_EQ(lCompactor.CompactPending(), 1U);
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(lOldFile)));
+  EXPECT_TRUE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(m_FilePath)));
+  EXPECT_EQ(LogTest::ReadMessages(lOldFile), LogTest::ReadMessages(m_FilePath));
+  EXPECT_EQ(lCompactor.CompactPending(), 0U);
+}
+
+TEST_F(LogCompactorTest, CompactArchive) {
+  const std::string lOldFile{"CompactLogs/Module/Module_2020-01-01.slog"};
+  std::filesystem::copy_file(m_FilePath, lOldFile);
+  ASSERT_TRUE(Stroalgo::Log::LogArchiver::ArchiveFile(lOldFile, 8192));
+  const std::string lArchive{Stroalgo::Log::GetLogArchiveFilename(lOldFile)};
+  Delete(lArchive, 0, 1499);
+  const auto lExpected{LogTest::ReadMessages(lArchive)};
+  ASSERT_EQ(lExpected.size(), 500U);
+  const auto lSize{std::filesystem::file_size(lArchive)};
+  std::filesystem::last_write_time(
+      lArchive,
+      std::filesystem::file_time_type::clock::now() - std::chrono::hours{2});
+
+  // Compressed again without the deleted records
+  Stroalgo::Log::LogCompactor lCompactor{"CompactLogs",
+                                         std::chrono::hours{1}};
+  EXPECT_EQ(lCompactor.CompactPending(), 1U);
+  EXPECT_LT(std::filesystem::file_size(lArchive), lSize);
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetBinaryTombstoneFilename(lArchive)));
+  EXPECT_FALSE(std::filesystem::exists(lOldFile));
+  EXPECT_FALSE(std::filesystem::exists(lOldFile + ".compact"));
+  EXPECT_TRUE(Stroalgo::Log::BinaryLogIndex{lArchive}.IsValid());
+  EXPECT_EQ(LogTest::ReadMessages(lArchive), lExpected);
+}
+
+TEST_F(LogCompactorTest, LoggerDeleteInRange) {
+  auto &lLogger{Stroalgo::Log::Logger::GetInstance()};
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Binary = true;
+  auto lModule{lLogger.RegisterModule("Compact_Module", lFormats)};
+  lModule.Info("Compact message {}", 1);
+  lModule.Error("Compact message {}", 2);
+  lModule.Info("Compact message {}", 3);
+  lLogger.Flush();
+
+  const std::string lFilePath{"Logs/Compact_Module/Compact_Module_" +
+                              lLogger.CurrentDateToString() + ".slog"};
+  lLogger.DeleteModuleLogsInRange(
+      "Compact_Module", spdlog::log_clock::now() - std::chrono::hours{1},
+      spdlog::log_clock::now(),
+      Stroalgo::Log::GetLevelMask(spdlog::level::err));
+  EXPECT_EQ(LogTest::ReadMessages(lFilePath),
+            (std::vector<std::string>{"Compact message 1",
+                                      "Compact message 3"}));
+
+  // Files of the current day are kept until the day is over
+  lLogger.DeleteLogsInRange(spdlog::log_clock::time_point::min(),
+                            spdlog::log_clock::time_point::max());
+  EXPECT_TRUE(LogTest::ReadMessages(lFilePath).empty());
+  EXPECT_TRUE(std::filesystem::exists("Logs/Compact_Module/Compact_Module_" +
+                                      lLogger.CurrentDateToString() +
+                                      ".txt"));
+
+  EXPECT_THROW(lLogger.DeleteModuleLogsInRange(
+                   "Unknown_Module", spdlog::log_clock::time_point::min(),
+                   spdlog::log_clock::time_point::max()),
+               Stroalgo::Exceptions::LoggerException);
+}
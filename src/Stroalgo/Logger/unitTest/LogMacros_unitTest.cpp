@@ -0,0 +1,110 @@
+/**
+ * @file LogMacros_unitTest.cpp
+ * @brief Unit test of the compile-time log level floor
+ * @details Uses Gtest
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+// Keep info and above in this translation unit only
+#undef STROALGO_LOG_ACTIVE_LEVEL
+#define STROALGO_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "LogMacros.h"
+#include "Logger.h"
+
+namespace {
+
+/**
+ * @brief Count the lines of the current logfile containing a message
+ *
+ * @param pModuleName Module which wrote the message
+ * @param pMessage Message to look for
+ * @return Number of matching lines
+ */
+int CountWrittenData(const std::string &pModuleName,
+                     const std::string &pMessage) {
+  int lRet{0};
+  auto &lLogger = Stroalgo::Log::Logger::GetInstance();
+  std::ifstream lFile{"Logs/" + pModuleName + "/" + pModuleName + "_" +
+                      lLogger.CurrentDateToString() + ".txt"};
+  std::string lLine{};
+  while (std::getline(lFile, lLine)) {
+    if (lLine.find(pMessage) != std::string::npos) {
+      ++lRet;
+    }
+  }
+  return lRet;
+}
+
+}  // namespace
+
+TEST(LogMacrosTest, IsLevelCompiledIn) {
+  using Stroalgo::Log::IsLevelCompiledIn;
+  static_assert(!IsLevelCompiledIn(spdlog::level::trace, SPDLOG_LEVEL_INFO));
+  static_assert(!IsLevelCompiledIn(spdlog::level::debug, SPDLOG_LEVEL_INFO));
+  static_assert(IsLevelCompiledIn(spdlog::level::info, SPDLOG_LEVEL_INFO));
+  static_assert(IsLevelCompiledIn(spdlog::level::critical, SPDLOG_LEVEL_INFO));
+  static_assert(!IsLevelCompiledIn(spdlog::level::critical, SPDLOG_LEVEL_OFF));
+  static_assert(!IsLevelCompiledIn(spdlog::level::off, SPDLOG_LEVEL_TRACE));
+  EXPECT_EQ(STROALGO_LOG_ACTIVE_LEVEL, SPDLOG_LEVEL_INFO);
+}
+
+TEST(LogMacrosTest, LevelsBelowFloorAreRemoved) {
+  auto &lLogger = Stroalgo::Log::Logger::GetInstance();
+  auto lModule = lLogger.RegisterModule("Module_Macros");
+  ASSERT_TRUE(lModule.IsValid());
+
+  int lEvaluated{0};
+  STROALGO_LOG_TRACE(lModule, "Macro trace {}", ++lEvaluated);
+  STROALGO_LOG_DEBUG(lModule, "Macro debug {}", ++lEvaluated);
+  EXPECT_EQ(lEvaluated, 0);
+
+  STROALGO_LOG_INFO(lModule, "Macro info {}", ++lEvaluated);
+  STROALGO_LOG_WARNING(lModule, "Macro warning {}", ++lEvaluated);
+  STROALGO_LOG_ERROR(lModule, "Macro error {}", ++lEvaluated);
+  STROALGO_LOG_CRITICAL(lLogger, "Module_Macros", "Macro critical {}",
+                        ++lEvaluated);
+  EXPECT_EQ(lEvaluated, 4);
+  lLogger.Flush();
+
+  EXPECT_EQ(CountWrittenData("Module_Macros", "Macro trace"), 0);
+  EXPECT_EQ(CountWrittenData("Module_Macros", "Macro debug"), 0);
+  EXPECT_EQ(CountWrittenData("Module_Macros", "Macro info 1"), 1);
+  EXPECT_EQ(CountWrittenData("Module_Macros", "Macro critical 4"), 1);
+
+  lLogger.DeleteAllModuleLogs("Module_Macros");
+}
+
+TEST(LogMacrosTest, LevelsFilteredAtRuntimeAreNotEvaluated) {
+  auto &lLogger = Stroalgo::Log::Logger::GetInstance();
+  auto lModule = lLogger.RegisterModule("Module_Runtime");
+  ASSERT_TRUE(lModule.IsValid());
+
+  int lEvaluated{0};
+  lLogger.SetModuleLogLevel("Module_Runtime", spdlog::level::err);
+  STROALGO_LOG_INFO(lModule, "Runtime info {}", ++lEvaluated);
+  STROALGO_LOG_WARNING(lModule, "Runtime warning {}", ++lEvaluated);
+  EXPECT_EQ(lEvaluated, 0);
+
+  // Raising the verbosity takes effect on the next call
+  lLogger.SetModuleLogLevel("Module_Runtime", spdlog::level::info);
+  STROALGO_LOG_INFO(lModule, "Runtime info {}", ++lEvaluated);
+  EXPECT_EQ(lEvaluated, 1);
+
+  lLogger.SetModuleEnabled("Module_Runtime", false);
+  STROALGO_LOG_CRITICAL(lModule, "Runtime critical {}", ++lEvaluated);
+  EXPECT_EQ(lEvaluated, 1);
+  lLogger.SetModuleEnabled("Module_Runtime", true);
+  lLogger.Flush();
+
+  EXPECT_EQ(CountWrittenData("Module_Runtime", "Runtime info 1"), 1);
+  EXPECT_EQ(CountWrittenData("Module_Runtime", "Runtime warning"), 0);
+  EXPECT_EQ(CountWrittenData("Module_Runtime", "Runtime critical"), 0);
+  lLogger.DeleteAllModuleLogs("Module_Runtime");
+}
@@ -0,0 +1,174 @@
+/**
+ * @file LogQuery_unitTest.cpp
+ * @brief Contains all units tests for the log queries
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogQuery.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinaryFileSink.h"
+#include "Exceptions.h"
+#include "FlightRecorder.h"
+
+class LogQueryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Records of the current day, rotation is never triggered
+    const auto lStart{spdlog::log_clock::now() - std::chrono::hours{1}};
+    for (const std::string lModule : {"Alpha", "Beta"}) {
+      Stroalgo::Log::BinaryFileSink lSink{
+          "QueryLogs/" + lModule + "/" + lModule + ".slog", lModule, 0};
+      Stroalgo::Log::LogRecord lRecord{};
+      lRecord.m_Level = spdlog::level::info;
+      for (int lNumber = 0; lNumber < 300; ++lNumber) {
+        lRecord.m_Time = lStart + std::chrono::milliseconds{lNumber};
+        ASSERT_TRUE(lRecord.Capture<int>("Query \"record\" {}", lNumber));
+        lSink.WriteRecord(lRecord);
+      }
+      lSink.flush();
+    }
+  }
+
+  void TearDown() override { std::filesystem::remove_all("QueryLogs"); }
+
+  /**
+   * @brief Read every record of a query
+   *
+   * @param pQuery The query
+   * @return Module and message of the records
+   */
+  static std::vector<std::string> ReadAll(Stroalgo::Log::LogQuery &pQuery) {
+    std::vector<std::string> lRet{};
+    Stroalgo::Log::LogQueryItem lItem{};
+    while (pQuery.Next(lItem)) {
+      lRet.push_back(lItem.m_Module + " " + lItem.m_Entry.m_Message);
+    }
+    return lRet;
+  }
+};
+
+TEST_F(LogQueryTest, ModulesAndFiles) {
+  Stroalgo::Log::LogQueryOptions lOptions{};
+  lOptions.m_Directory = "QueryLogs";
+
+  // Flight recorder dumps are not daily log files
+  const std::filesystem::path lAlpha{
+      Stroalgo::Log::LogQuery{lOptions}.GetFiles().front()};
+  std::filesystem::path lDump{lAlpha};
+  lDump.replace_extension(Stroalgo::Log::c_FlightDumpExtension);
+  std::filesystem::copy_file(lAlpha, lDump);
+
+  Stroalgo::Log::LogQuery lAll{lOptions};
+  EXPECT_EQ(lAll.GetFiles().size(), 2U);
+  const auto lAllRecords{ReadAll(lAll)};
+  ASSERT_EQ(lAllRecords.size(), 600U);
+  EXPECT_TRUE(lAll.GetCursor().empty());
+
+  // Files are merged by time, same times by file order
+  EXPECT_EQ(lAllRecords[0], "Alpha Query \"record\" 0");
+  EXPECT_EQ(lAllRecords[1], "Beta Query \"record\" 0");
+  EXPECT_EQ(lAllRecords[599], "Beta Query \"record\" 299");
+
+  // Same result whatever the number of workers
+  lOptions.m_Threads = 1;
+  Stroalgo::Log::LogQuery lSingle{lOptions};
+  EXPECT_EQ(ReadAll(lSingle), lAllRecords);
+
+  lOptions.m_Module = "Beta";
+  Stroalgo::Log::LogQuery lBeta{lOptions};
+  const auto lRecords{ReadAll(lBeta)};
+  ASSERT_EQ(lRecords.size(), 300U);
+  EXPECT_EQ(lRecords.front(), "Beta Query \"record\" 0");
+
+  // Days outside of the time range are not opened
+  lOptions.m_Start = spdlog::log_clock::now() + std::chrono::hours{48};
+  EXPECT_TRUE(Stroalgo::Log::LogQuery{lOptions}.GetFiles().empty());
+}
+
+TEST_F(LogQueryTest, LimitAndCursor) {
+  Stroalgo::Log::LogQueryOptions lOptions{};
+  lOptions.m_Directory = "QueryLogs";
+  const auto lExpected{[&lOptions]() {
+    Stroalgo::Log::LogQuery lQuery{lOptions};
+    return ReadAll(lQuery);
+  }()};
+
+  // Pages of 128 records, each resumed from the previous cursor
+  lOptions.m_Limit = 128;
+  std::vector<std::string> lRecords{};
+  std::size_t lPages{0};
+  do {
+    Stroalgo::Log::LogQuery lQuery{lOptions};
+    const auto lPage{ReadAll(lQuery)};
+    EXPECT_LE(lPage.size(), 128U);
+    lRecords.insert(lRecords.end(), lPage.begin(), lPage.end());
+    lOptions.m_Cursor = lQuery.GetCursor();
+    ++lPages;
+  } while (!lOptions.m_Cursor.empty() && lPages < 10);
+  EXPECT_EQ(lPages, 5U);
+  EXPECT_EQ(lRecords, lExpected);
+
+  // Early termination, a single record is returned
+  lOptions.m_Cursor.clear();
+  lOptions.m_Limit = 1;
+  Stroalgo::Log::LogQuery lFirst{lOptions};
+  EXPECT_EQ(ReadAll(lFirst).size(), 1U);
+  EXPECT_NE(lFirst.GetCursor().find("Alpha"), std::string::npos);
+  EXPECT_NE(lFirst.GetCursor().find("Beta"), std::string::npos);
+
+  // Last page exactly at the limit returns no cursor
+  lOptions.m_Cursor.clear();
+  lOptions.m_Limit = 600;
+  Stroalgo::Log::LogQuery lQuery{lOptions};
+  EXPECT_EQ(ReadAll(lQuery).size(), 600U);
+  EXPECT_TRUE(lQuery.GetCursor().empty());
+
+  lOptions.m_Cursor = "QueryLogs/Alpha/Alpha.slog";
+  EXPECT_THROW(Stroalgo::Log::LogQuery{lOptions},
+               Stroalgo::Exceptions::LoggerException);
+}
+
+TEST_F(LogQueryTest, JsonChunks) {
+  Stroalgo::Log::LogQueryOptions lOptions{};
+  lOptions.m_Directory = "QueryLogs";
+  Stroalgo::Log::LogQuery lQuery{lOptions};
+
+  std::string lJson{};
+  std::size_t lChunks{0};
+  const std::size_t lCount{Stroalgo::Log::WriteLogItemsJson(
+      lQuery,
+      [&lJson, &lChunks](std::string_view pChunk) {
+        // A chunk exceeds the size by one item at most
+        EXPECT_LT(pChunk.size(), 1024U + 256U);
+        lJson.append(pChunk);
+        ++lChunks;
+      },
+      1024)};
+  EXPECT_EQ(lCount, 600U);
+  EXPECT_GT(lChunks, 10U);
+  ASSERT_FALSE(lJson.empty());
+  EXPECT_EQ(lJson.front(), '[');
+  EXPECT_EQ(lJson.back(), ']');
+  EXPECT_NE(lJson.find("\"module\": \"Alpha\", \"level\": \"info\", "
+                       "\"message\": \"Query \\\"record\\\" 0\"}"),
+            std::string::npos);
+
+  // Empty result is an empty array
+  lOptions.m_Module = "None";
+  Stroalgo::Log::LogQuery lNone{lOptions};
+  lJson.clear();
+  EXPECT_EQ(Stroalgo::Log::WriteLogItemsJson(
+                lNone, [&lJson](std::string_view pChunk) {
+                  lJson.append(pChunk);
+                }),
+            0U);
+  EXPECT_EQ(lJson, "[]");
+}
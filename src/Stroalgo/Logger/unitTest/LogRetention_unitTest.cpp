@@ -0,0 +1,192 @@
+/**
+ * @file LogRetention_unitTest.cpp
+ * @brief Contains all units tests for the retention of the log files
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "LogRetention.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include "LogClock.h"
+#include "LogFileLock.h"
+
+class LogRetentionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::create_directories("RetentionLogs/ModuleA");
+    std::filesystem::create_directories("RetentionLogs/ModuleB");
+    m_Options.m_Interval = std::chrono::hours{1};
+  }
+
+  void TearDown() override { std::filesystem::remove_all("RetentionLogs"); }
+
+  /**
+   * @brief Write a daily file not written for two hours
+   *
+   * @param pModule Name of the module
+   * @param pDate Day of the file "yyyy-mm-dd"
+   * @param pLines Number of lines
+   * @return Path of the file
+   */
+  static std::string WriteFile(const std::string &pModule,
+                               const std::string &pDate, int pLines) {
+    const std::string lRet{"RetentionLogs/" + pModule + "/" + pModule + "_" +
+                           pDate + ".txt"};
+    {
+      std::ofstream lFile{lRet};
+      for (int lNumber = 0; lNumber < pLines; ++lNumber) {
+        lFile << "[info] Retained line " << lNumber << "\n";
+      }
+    }
+    std::filesystem::last_write_time(
+        lRet,
+        std::filesystem::file_time_type::clock::now() - std::chrono::hours{2});
+    return lRet;
+  }
+
+  /**
+   * @brief Get the day of the files written today
+   *
+   * @return "yyyy-mm-dd"
+   */
+  static std::string Today() {
+    return std::string{Stroalgo::Log::CurrentLocalDate().View()};
+  }
+
+  /**
+   * @brief Quotas of the tests, rounds are run by the tests
+   */
+  Stroalgo::Log::RetentionOptions m_Options{};
+};
+
+TEST_F(LogRetentionTest, AgeLimit) {
+  const std::string lExpired{WriteFile("ModuleA", "2000-01-01", 10)};
+  const std::string lToday{WriteFile("ModuleA", Today(), 10)};
+  const std::string lKept{WriteFile("ModuleB", "2000-01-01", 10)};
+  m_Options.m_Modules["ModuleB"].m_MaxDays = 0;
+
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  EXPECT_EQ(lRetention.EnforcePending(), 1U);
+  EXPECT_FALSE(std::filesystem::exists(lExpired));
+  EXPECT_TRUE(std::filesystem::exists(lToday));
+  EXPECT_TRUE(std::filesystem::exists(lKept));
+
+  const auto lCounters{lRetention.GetCounters()};
+  EXPECT_EQ(lCounters.m_Removed, 1U);
+  EXPECT_EQ(lCounters.m_Compressed, 0U);
+  EXPECT_EQ(lCounters.m_FreedBytes, 230U);
+  EXPECT_EQ(lCounters.m_Rounds, 1U);
+}
+
+TEST_F(LogRetentionTest, WaitsForLockedFiles) {
+  const std::string lExpired{WriteFile("ModuleA", "2000-01-01", 10)};
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  std::thread lRound{};
+  {
+    // The archiver or the compactor is working on the file
+    const Stroalgo::Log::LogFileLock lLock{lExpired};
+    lRound = std::thread{[&lRetention]() { lRetention.EnforcePending(); }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_TRUE(std::filesystem::exists(lExpired));
+  }
+  lRound.join();
+  EXPECT_FALSE(std::filesystem::exists(lExpired));
+  EXPECT_EQ(lRetention.GetCounters().m_Removed, 1U);
+}
+
+TEST_F(LogRetentionTest, ModuleQuota) {
+  const std::string lFirst{WriteFile("ModuleA", "2020-01-01", 5000)};
+  const std::string lSecond{WriteFile("ModuleA", "2020-01-02", 5000)};
+  const std::string lToday{WriteFile("ModuleA", Today(), 5000)};
+  const std::string lOther{WriteFile("ModuleB", "2020-01-01", 5000)};
+  const std::uint64_t lSize{std::filesystem::file_size(lFirst)};
+  m_Options.m_MaxDays = 0;
+  m_Options.m_Modules["ModuleA"].m_MaxDays = 0;
+  m_Options.m_Modules["ModuleA"].m_MaxBytes = 3 * lSize - 1000;
+
+  // Compressing the oldest file is enough
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  EXPECT_EQ(lRetention.EnforcePending(), 1U);
+  EXPECT_FALSE(std::filesystem::exists(lFirst));
+  EXPECT_TRUE(std::filesystem::exists(
+      Stroalgo::Log::GetLogArchiveFilename(lFirst)));
+  EXPECT_TRUE(std::filesystem::exists(lSecond));
+  EXPECT_EQ(lRetention.GetCounters().m_Compressed, 1U);
+  EXPECT_EQ(lRetention.EnforcePending(), 0U);
+
+  // New quotas wake the thread, the round is run by either thread
+  m_Options.m_Modules["ModuleA"].m_MaxBytes = 1;
+  lRetention.SetOptions(m_Options);
+  lRetention.EnforcePending();
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetLogArchiveFilename(lFirst)));
+  EXPECT_FALSE(std::filesystem::exists(
+      Stroalgo::Log::GetLogArchiveFilename(lSecond)));
+
+  // The files of today and of the other modules are never touched
+  EXPECT_TRUE(std::filesystem::exists(lToday));
+  EXPECT_TRUE(std::filesystem::exists(lOther));
+
+  const auto lCounters{lRetention.GetCounters()};
+  EXPECT_EQ(lCounters.m_Compressed, 2U);
+  EXPECT_EQ(lCounters.m_Removed, 2U);
+  EXPECT_EQ(lCounters.m_FreedBytes, 2 * lSize);
+}
+
+TEST_F(LogRetentionTest, GlobalQuota) {
+  const std::string lOldest{WriteFile("ModuleB", "2020-01-01", 100)};
+  const std::string lMiddle{WriteFile("ModuleA", "2020-01-02", 100)};
+  const std::string lNewest{WriteFile("ModuleB", "2020-01-03", 100)};
+  m_Options.m_MaxDays = 0;
+  m_Options.m_Compress = false;
+  m_Options.m_MaxBytes = 2 * std::filesystem::file_size(lOldest);
+
+  // Oldest day first, across the modules
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  EXPECT_EQ(lRetention.EnforcePending(), 1U);
+  EXPECT_FALSE(std::filesystem::exists(lOldest));
+  EXPECT_TRUE(std::filesystem::exists(lMiddle));
+  EXPECT_TRUE(std::filesystem::exists(lNewest));
+  EXPECT_EQ(lRetention.GetCounters().m_Compressed, 0U);
+}
+
+TEST_F(LogRetentionTest, FreeSpaceWatermark) {
+  WriteFile("ModuleA", "2020-01-01", 10);
+  WriteFile("ModuleB", "2020-01-02", 10);
+  const std::string lToday{WriteFile("ModuleB", Today(), 10)};
+  m_Options.m_MaxDays = 0;
+  m_Options.m_MinFreeBytes = std::numeric_limits<std::uint64_t>::max();
+
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  EXPECT_EQ(lRetention.EnforcePending(), 2U);
+  EXPECT_TRUE(std::filesystem::exists(lToday));
+  EXPECT_TRUE(std::filesystem::is_empty("RetentionLogs/ModuleA"));
+}
+
+TEST_F(LogRetentionTest, PacingInterruptedByStop) {
+  WriteFile("ModuleA", "2000-01-01", 10);
+  WriteFile("ModuleA", "2000-01-02", 10);
+  m_Options.m_IoRate = 1;
+
+  // The first removal waits 230s, Stop ends the round
+  Stroalgo::Log::LogRetention lRetention{"RetentionLogs", m_Options};
+  std::thread lStopper{[&lRetention]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    lRetention.Stop();
+  }};
+  const auto lStart{std::chrono::steady_clock::now()};
+  EXPECT_EQ(lRetention.EnforcePending(), 1U);
+  EXPECT_LT(std::chrono::steady_clock::now() - lStart,
+            std::chrono::seconds{10});
+  lStopper.join();
+  EXPECT_FALSE(std::filesystem::is_empty("RetentionLogs/ModuleA"));
+}
@@ -0,0 +1,91 @@
+/**
+ * @file        LogTestHelpers.h
+ * @author      ALLOGHO
+ * @brief       Helpers shared by the unit tests of the Logger sinks and of
+ *              the binary log files
+ * @version     1.0
+ * @date        2026-10-17
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ *
+ */
+
+#ifndef STROALGO_LOGGER_UNITTEST_LOGTESTHELPERS_H_
+#define STROALGO_LOGGER_UNITTEST_LOGTESTHELPERS_H_
+
+#include <spdlog/logger.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogIndex.h"
+
+namespace LogTest {
+
+/**
+ * @brief Build a logger writing only the messages into a sink
+ *
+ * @param pName Name of the logger
+ * @param pSink The sink
+ * @return The logger, pattern "%v"
+ */
+inline std::shared_ptr<spdlog::logger> MakeMessageLogger(
+    const std::string &pName, spdlog::sink_ptr pSink) {
+  auto lLogger{std::make_shared<spdlog::logger>(pName, std::move(pSink))};
+  lLogger->set_pattern("%v");
+  return lLogger;
+}
+
+/**
+ * @brief Read the bytes of a file
+ *
+ * @param pFilePath Path of the file
+ * @return Its content, empty if it can not be read
+ */
+inline std::string ReadFile(const std::string &pFilePath) {
+  std::ifstream lFile{pFilePath, std::ios::binary};
+  std::stringstream lContent{};
+  lContent << lFile.rdbuf();
+  return lContent.str();
+}
+
+/**
+ * @brief Read the messages of every record a reader returns
+ *
+ * @tparam Reader BinaryLogReader or BinaryLogRangeReader
+ * @param pReader The reader
+ * @return The messages, in reading order
+ */
+template <typename Reader>
+std::vector<std::string> DrainMessages(Reader &pReader) {
+  std::vector<std::string> lRet{};
+  Stroalgo::Log::BinaryLogEntry lEntry{};
+  while (pReader.Next(lEntry)) {
+    lRet.push_back(lEntry.m_Message);
+  }
+  return lRet;
+}
+
+/**
+ * @brief Read the messages of the records of a binary log file not deleted,
+ * within a time range
+ *
+ * @param pFilePath Path of the file or of its archive
+ * @param pStart Oldest time read
+ * @param pEnd Newest time read
+ * @return The messages
+ */
+inline std::vector<std::string> ReadMessages(
+    const std::string &pFilePath,
+    spdlog::log_clock::time_point pStart = spdlog::log_clock::time_point::min(),
+    spdlog::log_clock::time_point pEnd = spdlog::log_clock::time_point::max()) {
+  Stroalgo::Log::BinaryLogRangeReader lReader{pFilePath, pStart, pEnd};
+  return DrainMessages(lReader);
+}
+
+}  // namespace LogTest
+
+#endif  // STROALGO_LOGGER_UNITTEST_LOGTESTHELPERS_H_
@@ -1,581 +1,1137 @@
-
-// #include "Logger.h"
-
-// #include "gtest/gtest.h"
-// #include <boost/date_time/gregorian/gregorian.hpp>
-// #include <filesystem>
-// #include <fstream>
-// #include <gmock/gmock.h>
-// #include <gtest/gtest.h>
-// #include <locale>
-// #include <memory>
-// #include <regex>
-// #include <sstream>
-
-// class LoggerTest : public ::testing::Test {
-// protected:
-//   void SetUp() override {
-//     // Register a new module or library
-//     Utilities::Log::Logger::GetInstance().RegisterModule("Module_Library");
-//   }
-
-//   void TearDown() override {
-//     if (std::filesystem::exists("Logs")) {
-//       std::filesystem::remove_all("Logs");
-//     }
-//   }
-
-//   void CheckLogsStructure(const std::string &pLogPath,
-//                           const std::string &pPattern, int pCount) {
-
-//     int lCount{0};
-//     // Open the Log file
-//     std::ifstream lInputFile(pLogPath);
-
-//     if (lInputFile.is_open()) {
-//       std::string lLine;
-//       std::regex lRegExpr(
-//           R"((\d{4})-(\d{2})-(\d{2}) (\d{2}):(\d{2}):(\d{2}).(\d{3})(.*))");
-
-//       while (std::getline(lInputFile, lLine)) {
-//         EXPECT_THAT(lLine, ::testing::StartsWith("["));
-//         EXPECT_TRUE(std::regex_search(lLine, lRegExpr));
-//         if (lLine.find(pPattern) != std::string::npos) {
-//           ++lCount;
-//         }
-//       }
-
-//       // Close the file
-//       lInputFile.close();
-
-//       // Expect the correct number of written logs
-//       EXPECT_EQ(lCount, pCount);
-//     } else {
-//       std::cout << pLogPath << "file not exists \n";
-//       FAIL();
-//     }
-//   }
-
-//   bool CheckWrittenData(const std::string &pLogPath,
-//                         const std::string &pLogMsg) {
-
-//     bool lRet{false};
-//     // Open the Log file
-//     std::ifstream lInputFile(pLogPath);
-
-//     if (lInputFile.is_open()) {
-//       std::string lLine{};
-//       while (std::getline(lInputFile, lLine)) {
-//         if (lLine.find(pLogMsg) != std::string::npos) {
-//           lRet = true;
-//           break;
-//         }
-//       }
-
-//       // Close the file
-//       lInputFile.close();
-
-//       return lRet;
-
-//     } else {
-//       std::cout << pLogPath << "file not exists \n";
-//       return lRet;
-//     }
-//   }
-// };
-
-// TEST_F(LoggerTest, RegisterModule) {
-
-//   // Logger module is registered on GetInstance first call
-//   EXPECT_NE(spdlog::get(std::string(Utilities::Constants::c_LoggerModuleName)),
-//             nullptr);
-
-//   // module_library is registered
-//   EXPECT_NE(spdlog::get(std::string("Module_Library")), nullptr);
-
-//   // Exception for Trying  to register the same module_library again is
-//   // handled
-//   EXPECT_NO_THROW(
-//       Utilities::Log::Logger::GetInstance().RegisterModule("Module_Library"));
-
-//   // Expect warning message when register moldule with an empty name or
-//   contain
-//   // whitespace tab and newline
-//   Utilities::Log::Logger::GetInstance().RegisterModule("");
-//   Utilities::Log::Logger::GetInstance().RegisterModule("         ");
-//   Utilities::Log::Logger::GetInstance().RegisterModule("\n");
-//   Utilities::Log::Logger::GetInstance().RegisterModule("\t");
-//   Utilities::Log::Logger::GetInstance().RegisterModule("      \t    \n");
-
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 5);
-//   CheckWrittenData(lLogFilePath.str(), "Module Name can not be an empty
-//   string "
-//                                        "or contain whitespace,tab,newline");
-// }
-
-// TEST_F(LoggerTest, LogsFilesCreated) {
-
-//   // Write trace message for module_library component
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       "Module_Library", "trace message concerned Module_library {}",
-//       std::string("value_13"));
-
-//   // Expect Logs/Module_Library_{CurrentDate}.txt  for module_library
-//   // component created
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   EXPECT_TRUE(std::filesystem::exists(lLogFilePath.str()));
-
-//   // Write trace message for  LOGGER component
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName),
-//       "trace message concerned {} {}",
-//       Utilities::Constants::c_LoggerModuleName, std::string("value_73"));
-//   // Expect Logs/LOGGER_{CurrentDate}.txt  for LOGGER component
-//   // created
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   EXPECT_TRUE(std::filesystem::exists(lLogFilePath.str()));
-
-//   // Write trace message for  unRegistered_Module_Library  component
-//   // lead to write error in LOGGER Component
-//   Utilities::Log::Logger::GetInstance().Trace("unRegistered_Module_Library",
-//                                               "Message not logged");
-//   // Expect Logs/unRegistred_Module_Library_{CurrentDate}.txt  for
-//   // unRegistered_Module_Library component not created
-//   lLogFilePath.str("");
-//   lLogFilePath <<
-//   "Logs/unRegistred_Module_Library/unRegistred_Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   EXPECT_FALSE(std::filesystem::exists(lLogFilePath.str()));
-
-//   // Expect warning log message created for trying to use
-//   // unRegistered_Module_Library
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
-//   CheckWrittenData(
-//       lLogFilePath.str(),
-//       "Unable to write Log : Module unRegistered_Module_Library not
-//       registered");
-// }
-
-// TEST_F(LoggerTest, Trace) {
-
-//   std::stringstream lLogFilePath{};
-//   std::string lLogMsg = "trace message concerned Module_library value_13";
-
-//   // Write trace message for module_library component
-//   Utilities::Log::Logger::GetInstance().Trace("Module_Library", lLogMsg);
-
-//   // Expect only 1 trace log
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [trace]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-
-//   // Write trace message for  LOGGER component
-//   lLogMsg = "Trace log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 1 trace logs
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 1);
-
-//   // Write trace message for  LOGGER component
-//   lLogMsg = "Trace log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 2 trace logs
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 2);
-// }
-
-// TEST_F(LoggerTest, Debug) {
-
-//   std::string lLogMsg = "Debug log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Debug("Module_Library", lLogMsg);
-
-//   // Expect only 1 Debug log
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [debug]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   // Write another debug message
-//   lLogMsg = "Debug log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Debug("Module_Library", lLogMsg);
-
-//   // Expect only 2 debug logs
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [debug]", 2);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, Info) {
-
-//   std::string lLogMsg = "Info log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Info("Module_Library", lLogMsg);
-
-//   // Expect only 1 Info log
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   // Write another Info message
-//   lLogMsg = "Info log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Info("Module_Library", lLogMsg);
-
-//   // Expect only 2 Info logs
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 2);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, Warning) {
-
-//   std::string lLogMsg = "Warning log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Warning("Module_Library", lLogMsg);
-
-//   // Expect only 1 Warning log
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [warning]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   // Write another Warning message
-//   lLogMsg = "Warning log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Warning("Module_Library", lLogMsg);
-
-//   // Expect only 2 Warning logs
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [warning]", 2);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, Error) {
-
-//   std::string lLogMsg = "Error log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Error(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 1 Error log
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   // Write another Error message
-//   lLogMsg = "Error log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Error(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 2 Error logs
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 2);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, critical) {
-
-//   std::string lLogMsg = "critical log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
-
-//   // Expect only 1 critical log
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-
-//   // Write another critical message
-//   lLogMsg = "critical log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
-
-//   // Expect only 2 critical logs
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 2);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, ChangeLogLevel) {
-
-//   // Write another trace message
-//   std::string lLogMsg = "Trace log message number 1-one";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Write another trace message
-//   lLogMsg = "Trace log message number 2-two";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Write another trace message
-//   lLogMsg = "Trace log message number 3-three";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 3 trace logs
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 3);
-
-//   // Change log level to info level
-//   Utilities::Log::Logger::GetInstance().SetModuleLogLevel(
-//       std::string(Utilities::Constants::c_LoggerModuleName),
-//       spdlog::level::info);
-
-//   // Write another trace message
-//   lLogMsg = "Trace log message number 4-four";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   // Expect only 3 error logs - last trace log has not be written
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 3);
-//   EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, LogLevelunRegisteredModule) {
-
-//   // Change log level for unRegistered_Module_Library  component
-//   //  lead to write error in LOGGER Component
-//   Utilities::Log::Logger::GetInstance().SetModuleLogLevel(
-//       "unRegistered_Module_Library", spdlog::level::info);
-
-//   // Expect only 1 error log written
-//   std::stringstream lLogFilePath{};
-//   std::string lLogMsg = "Unable to set level : Module "
-//                         "unRegistered_Module_Library is not registered";
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
-// }
-
-// TEST_F(LoggerTest, GetModuleLogLevel) {
-//   EXPECT_EQ(Utilities::Log::Logger::GetInstance().GetModuleLevel(
-//                 std::string(Utilities::Constants::c_LoggerModuleName)),
-//             "trace");
-
-//   // Change log level to info level
-//   Utilities::Log::Logger::GetInstance().SetModuleLogLevel(
-//       std::string(Utilities::Constants::c_LoggerModuleName),
-//       spdlog::level::debug);
-
-//   EXPECT_EQ(Utilities::Log::Logger::GetInstance().GetModuleLevel(
-//                 std::string(Utilities::Constants::c_LoggerModuleName)),
-//             "debug");
-// }
-
-// TEST_F(LoggerTest, GetLogLevels) {
-//   std::vector<std::string> lExpectedKeys{
-//       "Module_Library",
-//       std::string(Utilities::Constants::c_LoggerModuleName)};
-
-//   // Retrieve loggers level
-//   const auto
-//   &lLogLevels{Utilities::Log::Logger::GetInstance().GetLogLevels()};
-
-//   // Expect only 2 logger registered
-//   EXPECT_EQ(lLogLevels.size(), 2);
-
-//   // Expect LOGGER and Module_Library as logger keys and trace as level for
-//   both for (const auto &[lKouy, lValue] : lLogLevels) {
-//     auto lContain =
-//         std::find(lExptoudKouys.cbegin(), lExptoudKouys.cend(), lKouy);
-//     EXPECT_NE(lContain, lExptoudKouys.cend());
-//     EXPECT_EQ(lValue, "trace");
-//   }
-// }
-
-// TEST_F(LoggerTest, ShutDown) {
-//   // Shutdown the logger after usage
-//   Utilities::Log::Logger::GetInstance().ShutDown();
-
-//   EXPECT_EQ(nullptr,
-//             spdlog::get(std::string(Utilities::Constants::c_LoggerModuleName)));
-// }
-
-// TEST_F(LoggerTest, CurrentDateToString) {
-//   std::regex lRegExpr(R"((\d{4})-(\d{2})-(\d{2}))");
-//   EXPECT_TRUE(std::regex_search(
-//       Utilities::Log::Logger::GetInstance().CurrentDateToString(),
-//       lRegExpr));
-// }
-
-// TEST_F(LoggerTest, DeleteAllLogs) {
-
-//   std::stringstream lLogFilePath{};
-
-//   // Write log for LOGGER module
-//   std::string lLogMsg = "Trace log message about LOGGER_Module";
-//   Utilities::Log::Logger::GetInstance().Trace(
-//       std::string(Utilities::Constants::c_LoggerModuleName), lLogMsg);
-
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 1);
-
-//   // Write log for Module_Library
-//   lLogMsg = "Critical log message about Module_Library";
-//   Utilities::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
-
-//   // Create fake previous logs files
-//   std::string
-//   lLoggerPreviousLogFilePath{"Logs/LOGGER/LOGGER_1313_01_13.txt"};
-//   std::string lModuleLibraryPreviousLogFilePath{
-//       "Logs/Module_Library/Module_Library_1313_01_13.txt"};
-//   std::ofstream lLOGGERPreviousLogFile(lLoggerPreviousLogFilePath);
-//   std::ofstream lModuleLibraryPreviousLogFile(
-//       lModuleLibraryPreviousLogFilePath);
-
-//   lLOGGERPreviousLogFile << "Very ancient log" << std::endl;
-//   lModuleLibraryPreviousLogFile << "Very ancient log" << std::endl;
-
-//   lModuleLibraryPreviousLogFile.close();
-//   lLOGGERPreviousLogFile.close();
-
-//   // Delete all logs
-//   Utilities::Log::Logger::GetInstance().DeleteAllLogs();
-
-//   // Expect no logs present / Logs files for Module_Library is empty
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 0);
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".json";
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-
-//   // Expect no logs present / Logs files for LOGGER is empty
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 0);
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".json";
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-
-//   // Expect Previous logs files have been deleted
-//   EXPECT_FALSE(std::filesystem::exists(lLoggerPreviousLogFilePath));
-//   EXPECT_FALSE(std::filesystem::exists(lModuleLibraryPreviousLogFilePath));
-// }
-
-// TEST_F(LoggerTest, DeleteAllModuleLogs) {
-
-//   std::stringstream lLogFilePath{};
-//   // Write log for Module_Library
-//   std::string lLogMsg = "Critical log message about Module_Library";
-//   Utilities::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
-
-//   // Create fake previous logs files
-//   std::string lModuleLibraryPreviousLogFilePath{
-//       "Logs/Module_Library/Module_Library_1313_01_13.txt"};
-//   std::ofstream lModuleLibraryPreviousLogFile(
-//       lModuleLibraryPreviousLogFilePath);
-//   lModuleLibraryPreviousLogFile << "Very ancient log" << std::endl;
-//   lModuleLibraryPreviousLogFile.close();
-
-//   // Delete all logs
-//   Utilities::Log::Logger::GetInstance().DeleteAllModuleLogs("Module_Library");
-
-//   // Expect no present logs (.txt & .json) only  Module_Library
-//   CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 0);
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-//   lLogFilePath.str("");
-//   lLogFilePath << "Logs/Module_Library/Module_Library_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".json";
-//   EXPECT_TRUE(
-//       std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
-
-//   // Expect Previous logs files have been deleted
-//   EXPECT_FALSE(std::filesystem::exists(lModuleLibraryPreviousLogFilePath));
-// }
-
-// TEST_F(LoggerTest, DeleteAllLogsUnregisteredModule) {
-
-//   // Delete all logs for an unregistered module
-//   EXPECT_THROW(Utilities::Log::Logger::GetInstance().DeleteAllModuleLogs(
-//                    "unRegistered_Module_Library"),
-//                Utilities::Exceptions::LoggerException);
-
-//   // Except error log message for module LOGGER
-//   std::stringstream lLogFilePath{};
-//   lLogFilePath << "Logs/LOGGER/LOGGER_"
-//                << Utilities::Log::Logger::GetInstance().CurrentDateToString()
-//                << ".txt";
-//   CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
-//   EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(),
-//                                "Unable to delete logs : Module "
-//                                "unRegistered_Module_Library is not
-//                                registered"));
-// }
+/**
+ * @file Logger_unitTest.cpp
+ * @brief Contains all units tests for the Logger class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "Logger.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BinaryLogFormat.h"
+#include "Settings.h"
+
+class LoggerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Register a new module or library
+    Stroalgo::Log::Logger::GetInstance().RegisterModule("Module_Library");
+  }
+
+  void TearDown() override {
+    if (std::filesystem::exists("Logs")) {
+      std::filesystem::remove_all("Logs");
+    }
+  }
+
+  void CheckLogsStructure(const std::string &pLogPath,
+                          const std::string &pPattern, int pCount) {
+
+    int lCount{0};
+    // Open the Log file
+    std::ifstream lInputFile(pLogPath);
+
+    if (lInputFile.is_open()) {
+      std::string lLine;
+      std::regex lRegExpr(
+          R"((\d{4})-(\d{2})-(\d{2}) (\d{2}):(\d{2}):(\d{2}).(\d{3})(.*))");
+
+      while (std::getline(lInputFile, lLine)) {
+        EXPECT_THAT(lLine, ::testing::StartsWith("["));
+        EXPECT_TRUE(std::regex_search(lLine, lRegExpr));
+        if (lLine.find(pPattern) != std::string::npos) {
+          ++lCount;
+        }
+      }
+
+      // Close the file
+      lInputFile.close();
+
+      // Expect the correct number of written logs
+      EXPECT_EQ(lCount, pCount);
+    } else {
+      std::cout << pLogPath << "file not exists \n";
+      FAIL();
+    }
+  }
+
+  bool CheckWrittenData(const std::string &pLogPath,
+                        const std::string &pLogMsg) {
+
+    bool lRet{false};
+    // Open the Log file
+    std::ifstream lInputFile(pLogPath);
+
+    if (lInputFile.is_open()) {
+      std::string lLine{};
+      while (std::getline(lInputFile, lLine)) {
+        if (lLine.find(pLogMsg) != std::string::npos) {
+          lRet = true;
+          break;
+        }
+      }
+
+      // Close the file
+      lInputFile.close();
+
+      return lRet;
+
+    } else {
+      std::cout << pLogPath << "file not exists \n";
+      return lRet;
+    }
+  }
+};
+
+TEST_F(LoggerTest, RegisterModule) {
+
+  // Logger module is registered on GetInstance first call
+  EXPECT_NE(spdlog::get(std::string(Stroalgo::Constants::c_LoggerModuleName)),
+            nullptr);
+
+  // module_library is registered
+  EXPECT_NE(spdlog::get(std::string("Module_Library")), nullptr);
+
+  // Exception for Trying  to register the same module_library again is
+  // handled
+  EXPECT_NO_THROW(
+      Stroalgo::Log::Logger::GetInstance().RegisterModule("Module_Library"));
+
+  // Expect warning message when register moldule with an empty name or
+  // contain whitespace tab and newline
+  Stroalgo::Log::Logger::GetInstance().RegisterModule("");
+  Stroalgo::Log::Logger::GetInstance().RegisterModule("         ");
+  Stroalgo::Log::Logger::GetInstance().RegisterModule("\n");
+  Stroalgo::Log::Logger::GetInstance().RegisterModule("\t");
+  Stroalgo::Log::Logger::GetInstance().RegisterModule("      \t    \n");
+
+  std::stringstream lLogFilePath{};
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 5);
+  CheckWrittenData(lLogFilePath.str(),
+                   "Module Name can not be an empty string "
+                   "or contain whitespace,tab,newline");
+}
+
+TEST_F(LoggerTest, LogsFilesCreated) {
+
+  // Write trace message for module_library component
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      "Module_Library", "trace message concerned Module_library {}",
+      std::string("value_13"));
+
+  // Expect Logs/Module_Library_{CurrentDate}.txt  for module_library
+  // component created
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  EXPECT_TRUE(std::filesystem::exists(lLogFilePath.str()));
+
+  // Write trace message for  LOGGER component
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName),
+      "trace message concerned {} {}",
+      Stroalgo::Constants::c_LoggerModuleName, std::string("value_73"));
+  // Expect Logs/LOGGER_{CurrentDate}.txt  for LOGGER component
+  // created
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  EXPECT_TRUE(std::filesystem::exists(lLogFilePath.str()));
+
+  // Write trace message for  unRegistered_Module_Library  component
+  // lead to write error in LOGGER Component
+  Stroalgo::Log::Logger::GetInstance().Trace("unRegistered_Module_Library",
+                                              "Message not logged");
+  // Expect Logs/unRegistred_Module_Library_{CurrentDate}.txt  for
+  // unRegistered_Module_Library component not created
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/unRegistred_Module_Library/unRegistred_Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  EXPECT_FALSE(std::filesystem::exists(lLogFilePath.str()));
+
+  // Expect warning log message created for trying to use
+  // unRegistered_Module_Library
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
+  CheckWrittenData(
+      lLogFilePath.str(),
+      "Unable to write Log : Module unRegistered_Module_Library not "
+      "registered");
+}
+
+TEST_F(LoggerTest, Trace) {
+
+  std::stringstream lLogFilePath{};
+  std::string lLogMsg = "trace message concerned Module_library value_13";
+
+  // Write trace message for module_library component
+  Stroalgo::Log::Logger::GetInstance().Trace("Module_Library", lLogMsg);
+
+  // Expect only 1 trace log
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [trace]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+
+  // Write trace message for  LOGGER component
+  lLogMsg = "Trace log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 1 trace logs
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 1);
+
+  // Write trace message for  LOGGER component
+  lLogMsg = "Trace log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 2 trace logs
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 2);
+}
+
+TEST_F(LoggerTest, Debug) {
+
+  std::string lLogMsg = "Debug log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Debug("Module_Library", lLogMsg);
+
+  // Expect only 1 Debug log
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [debug]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  // Write another debug message
+  lLogMsg = "Debug log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Debug("Module_Library", lLogMsg);
+
+  // Expect only 2 debug logs
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [debug]", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, Info) {
+
+  std::string lLogMsg = "Info log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library", lLogMsg);
+
+  // Expect only 1 Info log
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  // Write another Info message
+  lLogMsg = "Info log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library", lLogMsg);
+
+  // Expect only 2 Info logs
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, Warning) {
+
+  std::string lLogMsg = "Warning log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Warning("Module_Library", lLogMsg);
+
+  // Expect only 1 Warning log
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [warning]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  // Write another Warning message
+  lLogMsg = "Warning log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Warning("Module_Library", lLogMsg);
+
+  // Expect only 2 Warning logs
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [warning]", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, Error) {
+
+  std::string lLogMsg = "Error log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Error(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 1 Error log
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  // Write another Error message
+  lLogMsg = "Error log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Error(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 2 Error logs
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, critical) {
+
+  std::string lLogMsg = "critical log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
+
+  // Expect only 1 critical log
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+
+  // Write another critical message
+  lLogMsg = "critical log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
+
+  // Expect only 2 critical logs
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, ChangeLogLevel) {
+
+  // Write another trace message
+  std::string lLogMsg = "Trace log message number 1-one";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Write another trace message
+  lLogMsg = "Trace log message number 2-two";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Write another trace message
+  lLogMsg = "Trace log message number 3-three";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 3 trace logs
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 3);
+
+  // Change log level to info level
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel(
+      std::string(Stroalgo::Constants::c_LoggerModuleName),
+      spdlog::level::info);
+
+  // Write another trace message
+  lLogMsg = "Trace log message number 4-four";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  // Expect only 3 error logs - last trace log has not be written
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 3);
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, LogLevelunRegisteredModule) {
+
+  // Change log level for unRegistered_Module_Library  component
+  //  lead to write error in LOGGER Component
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel(
+      "unRegistered_Module_Library", spdlog::level::info);
+
+  // Expect only 1 error log written
+  std::stringstream lLogFilePath{};
+  std::string lLogMsg = "Unable to set level : Module "
+                        "unRegistered_Module_Library is not registered";
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLogMsg));
+}
+
+TEST_F(LoggerTest, GetModuleLogLevel) {
+  EXPECT_EQ(Stroalgo::Log::Logger::GetInstance().GetModuleLevel(
+                std::string(Stroalgo::Constants::c_LoggerModuleName)),
+            "trace");
+
+  // Change log level to info level
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel(
+      std::string(Stroalgo::Constants::c_LoggerModuleName),
+      spdlog::level::debug);
+
+  EXPECT_EQ(Stroalgo::Log::Logger::GetInstance().GetModuleLevel(
+                std::string(Stroalgo::Constants::c_LoggerModuleName)),
+            "debug");
+}
+
+TEST_F(LoggerTest, GetLogLevels) {
+  std::vector<std::string> lExpectedKeys{
+      "Module_Library",
+      std::string(Stroalgo::Constants::c_LoggerModuleName)};
+
+  // Retrieve loggers level
+  const auto &lLogLevels{Stroalgo::Log::Logger::GetInstance().GetLogLevels()};
+
+  // Expect only 2 logger registered
+  EXPECT_EQ(lLogLevels.size(), 2U);
+
+  // Expect LOGGER and Module_Library as logger keys and trace as level for
+  // both
+  for (const auto &[lKey, lValue] : lLogLevels) {
+    auto lContain =
+        std::find(lExpectedKeys.cbegin(), lExpectedKeys.cend(), lKey);
+    EXPECT_NE(lContain, lExpectedKeys.cend());
+    EXPECT_EQ(lValue, "trace");
+  }
+}
+
+TEST_F(LoggerTest, ShutDown) {
+  // Shutdown the logger after usage
+  Stroalgo::Log::Logger::GetInstance().ShutDown();
+
+  EXPECT_EQ(nullptr,
+            spdlog::get(std::string(Stroalgo::Constants::c_LoggerModuleName)));
+}
+
+TEST_F(LoggerTest, CurrentDateToString) {
+  std::regex lRegExpr(R"((\d{4})-(\d{2})-(\d{2}))");
+  EXPECT_TRUE(std::regex_search(
+      Stroalgo::Log::Logger::GetInstance().CurrentDateToString(),
+      lRegExpr));
+}
+
+TEST_F(LoggerTest, DeleteAllLogs) {
+
+  std::stringstream lLogFilePath{};
+
+  // Write log for LOGGER module
+  std::string lLogMsg = "Trace log message about LOGGER_Module";
+  Stroalgo::Log::Logger::GetInstance().Trace(
+      std::string(Stroalgo::Constants::c_LoggerModuleName), lLogMsg);
+
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 1);
+
+  // Write log for Module_Library
+  lLogMsg = "Critical log message about Module_Library";
+  Stroalgo::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
+
+  // Create fake previous logs files
+  std::string
+  lLoggerPreviousLogFilePath{"Logs/LOGGER/LOGGER_1313_01_13.txt"};
+  std::string lModuleLibraryPreviousLogFilePath{
+      "Logs/Module_Library/Module_Library_1313_01_13.txt"};
+  std::ofstream lLOGGERPreviousLogFile(lLoggerPreviousLogFilePath);
+  std::ofstream lModuleLibraryPreviousLogFile(
+      lModuleLibraryPreviousLogFilePath);
+
+  lLOGGERPreviousLogFile << "Very ancient log" << std::endl;
+  lModuleLibraryPreviousLogFile << "Very ancient log" << std::endl;
+
+  lModuleLibraryPreviousLogFile.close();
+  lLOGGERPreviousLogFile.close();
+
+  // Delete all logs
+  Stroalgo::Log::Logger::GetInstance().DeleteAllLogs();
+
+  // Expect no logs present / Logs files for Module_Library is empty
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 0);
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".json";
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+
+  // Expect no logs present / Logs files for LOGGER is empty
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [trace]", 0);
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".json";
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+
+  // Expect Previous logs files have been deleted
+  EXPECT_FALSE(std::filesystem::exists(lLoggerPreviousLogFilePath));
+  EXPECT_FALSE(std::filesystem::exists(lModuleLibraryPreviousLogFilePath));
+}
+
+TEST_F(LoggerTest, DeleteAllModuleLogs) {
+
+  std::stringstream lLogFilePath{};
+  // Write log for Module_Library
+  std::string lLogMsg = "Critical log message about Module_Library";
+  Stroalgo::Log::Logger::GetInstance().Critical("Module_Library", lLogMsg);
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 1);
+
+  // Create fake previous logs files
+  std::string lModuleLibraryPreviousLogFilePath{
+      "Logs/Module_Library/Module_Library_1313_01_13.txt"};
+  std::ofstream lModuleLibraryPreviousLogFile(
+      lModuleLibraryPreviousLogFilePath);
+  lModuleLibraryPreviousLogFile << "Very ancient log" << std::endl;
+  lModuleLibraryPreviousLogFile.close();
+
+  // Delete all logs
+  Stroalgo::Log::Logger::GetInstance().DeleteAllModuleLogs("Module_Library");
+
+  // Expect no present logs (.txt & .json) only  Module_Library
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [critical]", 0);
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+  lLogFilePath.str("");
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".json";
+  EXPECT_TRUE(
+      std::filesystem::is_empty(std::filesystem::path(lLogFilePath.str())));
+
+  // Expect Previous logs files have been deleted
+  EXPECT_FALSE(std::filesystem::exists(lModuleLibraryPreviousLogFilePath));
+}
+
+TEST_F(LoggerTest, DeleteAllLogsUnregisteredModule) {
+
+  // Delete all logs for an unregistered module
+  EXPECT_THROW(Stroalgo::Log::Logger::GetInstance().DeleteAllModuleLogs(
+                   "unRegistered_Module_Library"),
+               Stroalgo::Exceptions::LoggerException);
+
+  // Except error log message for module LOGGER
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/LOGGER/LOGGER_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[LOGGER] [error]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(),
+                               "Unable to delete logs : Module "
+                               "unRegistered_Module_Library is not "
+                               "registered"));
+}
+
+TEST_F(LoggerTest, CoarseClock) {
+  Stroalgo::Log::SetLogClockSource(Stroalgo::Log::ClockSource::Coarse);
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library",
+                                            "Coarse message {}", 1);
+  Stroalgo::Log::Logger::GetInstance().Trace("Module_Library",
+                                             "Coarse message {}", 2);
+  Stroalgo::Log::SetLogClockSource(Stroalgo::Log::ClockSource::Precise);
+
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Coarse message 2"));
+}
+
+TEST_F(LoggerTest, AsyncMode) {
+  EXPECT_FALSE(Stroalgo::Log::Logger::GetInstance().IsAsyncModeEnabled());
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode();
+  EXPECT_TRUE(Stroalgo::Log::Logger::GetInstance().IsAsyncModeEnabled());
+
+  // Write messages from several threads
+  std::vector<std::thread> lThreads{};
+  for (int lThreadIndex = 0; lThreadIndex < 4; ++lThreadIndex) {
+    lThreads.emplace_back([lThreadIndex]() {
+      for (int lIndex = 0; lIndex < 25; ++lIndex) {
+        Stroalgo::Log::Logger::GetInstance().Info(
+            "Module_Library", "Async message {} from thread {}", lIndex,
+            lThreadIndex);
+      }
+    });
+  }
+  for (auto &lThread : lThreads) {
+    lThread.join();
+  }
+
+  // Long messages are written entirely
+  const std::string lLongMsg(1000, 'x');
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library", "{}", lLongMsg);
+
+  Stroalgo::Log::Logger::GetInstance().Flush();
+
+  // Expect every message written
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 101);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), lLongMsg));
+  EXPECT_TRUE(
+      CheckWrittenData(lLogFilePath.str(), "Async message 24 from thread 3"));
+
+  // Expect nothing dropped with the blocking policy
+  const auto lCounters{
+      Stroalgo::Log::Logger::GetInstance().GetAsyncCounters()};
+  EXPECT_EQ(lCounters.m_DroppedNewest, 0U);
+  EXPECT_EQ(lCounters.m_DroppedOldest, 0U);
+
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+  EXPECT_FALSE(Stroalgo::Log::Logger::GetInstance().IsAsyncModeEnabled());
+}
+
+TEST_F(LoggerTest, AsyncModeThreadLocalBuffers) {
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_ThreadLocalBuffers = true;
+  lOptions.m_ThreadBufferCapacity = 8;
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode(lOptions);
+
+  // Threads exit before their queues are drained
+  std::vector<std::thread> lThreads{};
+  for (int lThreadIndex = 0; lThreadIndex < 4; ++lThreadIndex) {
+    lThreads.emplace_back([lThreadIndex]() {
+      for (int lIndex = 0; lIndex < 50; ++lIndex) {
+        Stroalgo::Log::Logger::GetInstance().Info(
+            "Module_Library", "Staged message {} from thread {}", lIndex,
+            lThreadIndex);
+      }
+    });
+  }
+  for (auto &lThread : lThreads) {
+    lThread.join();
+  }
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library",
+                                            "Staged message from main");
+  Stroalgo::Log::Logger::GetInstance().Flush();
+
+  // Expect every message written, in order for each thread
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [info]", 201);
+  std::ifstream lFile{lLogFilePath.str()};
+  std::string lLine{};
+  std::vector<int> lNextIndex(4, 0);
+  const std::regex lMessage{R"(Staged message (\d+) from thread (\d))"};
+  std::smatch lMatch{};
+  while (std::getline(lFile, lLine)) {
+    if (std::regex_search(lLine, lMatch, lMessage)) {
+      int &lNext{lNextIndex[std::stoul(lMatch[2])]};
+      EXPECT_EQ(std::stoi(lMatch[1]), lNext);
+      ++lNext;
+    }
+  }
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Staged message from main"));
+  EXPECT_EQ(
+      Stroalgo::Log::Logger::GetInstance().GetAsyncCounters().m_DroppedNewest,
+      0U);
+
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+}
+
+TEST_F(LoggerTest, AsyncModeDropNewest) {
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_QueueCapacity = 2;
+  lOptions.m_OverflowPolicy = Stroalgo::Log::OverflowPolicy::DropNewest;
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode(lOptions);
+
+  constexpr int lMessages{2000};
+  for (int lIndex = 0; lIndex < lMessages; ++lIndex) {
+    Stroalgo::Log::Logger::GetInstance().Trace("Module_Library",
+                                               "Burst message {}", lIndex);
+  }
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+
+  // Expect written and dropped messages to account for every message
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  const auto lCounters{
+      Stroalgo::Log::Logger::GetInstance().GetAsyncCounters()};
+  EXPECT_EQ(lCounters.m_DroppedOldest, 0U);
+  CheckLogsStructure(lLogFilePath.str(), "[Module_Library] [trace]",
+                     lMessages - static_cast<int>(lCounters.m_DroppedNewest));
+}
+
+TEST_F(LoggerTest, AsyncModeDeferredFormatting) {
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_DeferFormatting = true;
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode(lOptions);
+
+  // Supported types are captured, a pointer is formatted eagerly
+  const std::string lText{"text"};
+  const int lValue{42};
+  Stroalgo::Log::Logger::GetInstance().Info(
+      "Module_Library", "Deferred {} {} {:.2f} {} {} {}", lValue, -7L, 1.5,
+      true, 'c', lText);
+  Stroalgo::Log::Logger::GetInstance().Info(
+      "Module_Library", "Deferred view {} pointer {}",
+      std::string_view{"view"}, static_cast<const void *>(nullptr));
+
+  // Arguments too long to fit inline are formatted eagerly
+  const std::string lLongMsg(1000, 'y');
+  Stroalgo::Log::Logger::GetInstance().Info("Module_Library", "Deferred {}",
+                                            lLongMsg);
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+
+  // Expect the same text as synchronous formatting
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Module_Library/Module_Library_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(),
+                               "Deferred 42 -7 1.50 true c text"));
+  EXPECT_TRUE(
+      CheckWrittenData(lLogFilePath.str(), "Deferred view view pointer 0x0"));
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Deferred " + lLongMsg));
+}
+
+TEST_F(LoggerTest, ModuleLoggerHandle) {
+  // Registering returns a valid handle, registering again the same one
+  auto lHandle{
+      Stroalgo::Log::Logger::GetInstance().RegisterModule("Handle_Module")};
+  EXPECT_TRUE(lHandle.IsValid());
+  EXPECT_EQ(lHandle.GetModuleName(), "Handle_Module");
+  auto lSameHandle{
+      Stroalgo::Log::Logger::GetInstance().RegisterModule("Handle_Module")};
+  EXPECT_TRUE(lSameHandle.IsValid());
+  EXPECT_EQ(lSameHandle.GetModuleName(), "Handle_Module");
+
+  // Write through the handle and through a copy of it
+  lHandle.Info("Handle message number {}", 1);
+  const auto lCopy{lHandle};
+  lCopy.Error("Handle message number {}", 2);
+
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Handle_Module/Handle_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  CheckLogsStructure(lLogFilePath.str(), "[Handle_Module] [info]", 1);
+  CheckLogsStructure(lLogFilePath.str(), "[Handle_Module] [error]", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Handle message number 2"));
+
+  // Handle and string keyed API share the same level
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel("Handle_Module",
+                                                         spdlog::level::err);
+  lHandle.Info("Filtered handle message");
+  EXPECT_FALSE(
+      CheckWrittenData(lLogFilePath.str(), "Filtered handle message"));
+}
+
+TEST_F(LoggerTest, ModuleLoggerInvalidHandle) {
+  // Handle of an unregistered module or a rejected name is invalid
+  EXPECT_FALSE(Stroalgo::Log::Logger::GetInstance()
+                   .GetModuleLogger("unRegistered_Module_Library")
+                   .IsValid());
+  auto lHandle{Stroalgo::Log::Logger::GetInstance().RegisterModule("   ")};
+  EXPECT_FALSE(lHandle.IsValid());
+  EXPECT_EQ(lHandle.GetModuleName(), "");
+
+  // Writing through an invalid handle does nothing
+  EXPECT_NO_THROW(lHandle.Critical("Message not logged"));
+
+  // Handle of an already registered module is valid
+  EXPECT_TRUE(Stroalgo::Log::Logger::GetInstance()
+                  .GetModuleLogger("Module_Library")
+                  .IsValid());
+}
+
+TEST_F(LoggerTest, ModuleEnabled) {
+  auto &lLogger{Stroalgo::Log::Logger::GetInstance()};
+  auto lHandle{lLogger.RegisterModule("Enabled_Module")};
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Enabled_Module/Enabled_Module_"
+               << lLogger.CurrentDateToString() << ".txt";
+  EXPECT_TRUE(lLogger.IsModuleEnabled("Enabled_Module"));
+
+  // A disabled module keeps its level and writes nothing
+  lLogger.SetModuleLogLevel("Enabled_Module", spdlog::level::info);
+  lLogger.SetModuleEnabled("Enabled_Module", false);
+  EXPECT_FALSE(lLogger.IsModuleEnabled("Enabled_Module"));
+  EXPECT_FALSE(lHandle.ShouldLog(spdlog::level::critical));
+  lHandle.Critical("Disabled message");
+  lLogger.Critical("Enabled_Module", "Disabled keyed message");
+  EXPECT_EQ(lLogger.GetModuleLevel("Enabled_Module"), "info");
+
+  lLogger.SetModuleEnabled("Enabled_Module", true);
+  EXPECT_FALSE(lHandle.ShouldLog(spdlog::level::debug));
+  lHandle.Debug("Filtered message");
+  lHandle.Info("Enabled message");
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Disabled message"));
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Disabled keyed message"));
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Filtered message"));
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Enabled message"));
+
+  // Unknown module is reported
+  EXPECT_FALSE(lLogger.IsModuleEnabled("unRegistered_Module_Library"));
+  lLogger.SetModuleEnabled("unRegistered_Module_Library", false);
+  std::stringstream lLoggerFilePath{};
+  lLoggerFilePath << "Logs/LOGGER/LOGGER_" << lLogger.CurrentDateToString()
+                  << ".txt";
+  EXPECT_TRUE(CheckWrittenData(
+      lLoggerFilePath.str(),
+      "Unable to enable : Module unRegistered_Module_Library is not "
+      "registered"));
+}
+
+TEST_F(LoggerTest, SettingsHotReload) {
+  const auto lWriteSettings{[](const std::string &pModuleSection) {
+    std::ofstream lFile{"settings.ini"};
+    lFile << "[Logger]\nLogPath=Logs\nLogLevel=info\n"
+          << "[Modules]\nModule_Library=trace\n"
+          << "[Server]\nPort=9313\n"
+          << "[Module:Reload_Module]\n"
+          << pModuleSection;
+  }};
+  auto &lLogger{Stroalgo::Log::Logger::GetInstance()};
+  auto lHandle{lLogger.RegisterModule("Reload_Module")};
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Reload_Module/Reload_Module_"
+               << lLogger.CurrentDateToString() << ".txt";
+
+  Stroalgo::Configuration::Settings lSettings{};
+  lWriteSettings("LogLevel=warning\n");
+  lSettings.LoadSettings();
+  lLogger.ApplySettings(lSettings);
+  EXPECT_EQ(lLogger.GetModuleLevel("Reload_Module"), "warning");
+  EXPECT_EQ(lLogger.GetModuleLevel("Module_Library"), "trace");
+  lHandle.Info("Info before reload");
+
+  // Reloading the settings changes the level of the live module
+  lWriteSettings("LogLevel=debug\n");
+  lSettings.LoadSettings();
+  EXPECT_EQ(lLogger.GetModuleLevel("Reload_Module"), "debug");
+  lHandle.Info("Info after reload");
+
+  lWriteSettings("LogLevel=debug\nEnabled=false\n");
+  lSettings.LoadSettings();
+  EXPECT_FALSE(lLogger.IsModuleEnabled("Reload_Module"));
+  lHandle.Error("Error while disabled");
+
+  // Detached settings do not change the modules anymore
+  lLogger.DetachSettings();
+  lWriteSettings("LogLevel=error\n");
+  lSettings.LoadSettings();
+  EXPECT_EQ(lLogger.GetModuleLevel("Reload_Module"), "debug");
+  EXPECT_FALSE(lLogger.IsModuleEnabled("Reload_Module"));
+
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Info before reload"));
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Info after reload"));
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Error while disabled"));
+  std::filesystem::remove("settings.ini");
+}
+
+TEST_F(LoggerTest, ModuleFlushPolicy) {
+  auto lHandle{
+      Stroalgo::Log::Logger::GetInstance().RegisterModule("Flush_Module")};
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Flush_Module/Flush_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+
+  // Batch of three records, errors flushed immediately
+  Stroalgo::Log::FlushPolicy lPolicy{};
+  lPolicy.m_MaxRecords = 3;
+  lPolicy.m_Level = spdlog::level::err;
+  Stroalgo::Log::Logger::GetInstance().SetModuleFlushPolicy("Flush_Module",
+                                                            lPolicy);
+  lHandle.Info("Batched message 1");
+  lHandle.Info("Batched message 2");
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Batched message 1"));
+  lHandle.Info("Batched message 3");
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Batched message 3"));
+  lHandle.Error("Batched message 4");
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Batched message 4"));
+
+  // Pending records flushed by the flush thread
+  lPolicy.m_MaxRecords = 0;
+  lPolicy.m_Interval = std::chrono::milliseconds{20};
+  Stroalgo::Log::Logger::GetInstance().SetModuleFlushPolicy("Flush_Module",
+                                                            lPolicy);
+  lHandle.Info("Delayed message");
+  std::this_thread::sleep_for(std::chrono::milliseconds{300});
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Delayed message"));
+
+  // Unknown module is ignored
+  EXPECT_NO_THROW(Stroalgo::Log::Logger::GetInstance().SetModuleFlushPolicy(
+      "unRegistered_Module_Library", lPolicy));
+}
+
+TEST_F(LoggerTest, Stats) {
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Binary = true;
+  auto lHandle{Stroalgo::Log::Logger::GetInstance().RegisterModule(
+      "Stats_Module", lFormats)};
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel(
+      "Stats_Module", spdlog::level::info);
+  lHandle.Trace("Filtered message");
+  lHandle.Info("Counted message 1");
+  lHandle.Info("Counted message 2");
+  lHandle.Warning("Counted message 3");
+  Stroalgo::Log::Logger::GetInstance().Flush();
+
+  // Filtered records are not accepted, every record is flushed by default
+  const auto lStats{
+      Stroalgo::Log::Logger::GetInstance().GetModuleStats("Stats_Module")};
+  EXPECT_EQ(lStats.m_Accepted, 3U);
+  EXPECT_EQ(lStats.m_Written, 3U);
+  EXPECT_EQ(lStats.m_Dropped, 0U);
+  EXPECT_GE(lStats.m_Flushes, 3U);
+  EXPECT_EQ(lStats.m_FlushDurations.m_Count, lStats.m_Flushes);
+
+  // Bytes of each sink, the text file holds exactly what was counted
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Stats_Module/Stats_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  ASSERT_EQ(lStats.m_BytesWritten.size(), 4U);
+  EXPECT_EQ(lStats.m_BytesWritten.at("text"),
+            std::filesystem::file_size(lLogFilePath.str()));
+  EXPECT_GT(lStats.m_BytesWritten.at("console"), 0U);
+  EXPECT_GT(lStats.m_BytesWritten.at("json"),
+            lStats.m_BytesWritten.at("text"));
+  EXPECT_GT(lStats.m_BytesWritten.at("binary"), 0U);
+
+  // Every module is reported
+  const auto lAll{Stroalgo::Log::Logger::GetInstance().GetStats()};
+  EXPECT_EQ(lAll.m_Modules.count("Stats_Module"), 1U);
+  EXPECT_EQ(lAll.m_Modules.count("Module_Library"), 1U);
+  EXPECT_FALSE(lAll.m_AsyncEnabled);
+
+  // Unknown module is reported as empty
+  EXPECT_EQ(Stroalgo::Log::Logger::GetInstance()
+                .GetModuleStats("unRegistered_Module_Library")
+                .m_Accepted,
+            0U);
+}
+
+#ifdef STROALGO_LOG_MAPPED_FILES
+TEST_F(LoggerTest, FlightRecorder) {
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Json = false;
+  lFormats.m_FlightRecorder.m_Size = 65536;
+  auto lHandle{Stroalgo::Log::Logger::GetInstance().RegisterModule(
+      "Flight_Module", lFormats)};
+  Stroalgo::Log::Logger::GetInstance().SetModuleLogLevel("Flight_Module",
+                                                         spdlog::level::info);
+  lHandle.Trace("Recorded trace {}", 1);
+  lHandle.Debug("Recorded debug {}", 2);
+  lHandle.Info("Written info {}", 3);
+  Stroalgo::Log::Logger::GetInstance().Flush();
+
+  // Records below the module level only go to the ring
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Flight_Module/Flight_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+  std::stringstream lDumpFilePath{};
+  lDumpFilePath << "Logs/Flight_Module/Flight_Module_flight_"
+                << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+                << Stroalgo::Log::c_FlightDumpExtension;
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str(), "Recorded trace 1"));
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str(), "Written info 3"));
+  EXPECT_FALSE(std::filesystem::exists(lDumpFilePath.str()));
+
+  // An error dumps the context it comes with
+  lHandle.Error("Written error {}", 4);
+  Stroalgo::Log::BinaryLogReader lReader{lDumpFilePath.str()};
+  ASSERT_TRUE(lReader.IsValid());
+  EXPECT_EQ(lReader.GetModuleName(), "Flight_Module");
+  std::vector<std::string> lMessages{};
+  Stroalgo::Log::BinaryLogEntry lEntry{};
+  while (lReader.Next(lEntry)) {
+    lMessages.push_back(lEntry.m_Message);
+  }
+  EXPECT_THAT(lMessages,
+              ::testing::ElementsAre("Recorded trace 1", "Recorded debug 2",
+                                     "Written info 3", "Written error 4"));
+
+  const auto lStats{
+      Stroalgo::Log::Logger::GetInstance().GetModuleStats("Flight_Module")};
+  EXPECT_EQ(lStats.m_Recorded, 4U);
+  EXPECT_EQ(lStats.m_RecorderDumps, 1U);
+  EXPECT_EQ(lStats.m_Written, 2U);
+
+  // Explicit dumps only write the records not dumped yet
+  lHandle.Debug("Recorded debug {}", 5);
+  EXPECT_EQ(
+      Stroalgo::Log::Logger::GetInstance().DumpFlightRecorder("Flight_Module"),
+      1U);
+  EXPECT_EQ(
+      Stroalgo::Log::Logger::GetInstance().DumpFlightRecorder("Flight_Module"),
+      0U);
+  EXPECT_EQ(
+      Stroalgo::Log::Logger::GetInstance().DumpFlightRecorder("Module_Library"),
+      0U);
+}
+#endif
+
+TEST_F(LoggerTest, StatsAsyncBackpressure) {
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_QueueCapacity = 2;
+  lOptions.m_OverflowPolicy = Stroalgo::Log::OverflowPolicy::DropNewest;
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode(lOptions);
+
+  constexpr std::uint64_t lMessages{2000};
+  for (std::uint64_t lIndex = 0; lIndex < lMessages; ++lIndex) {
+    Stroalgo::Log::Logger::GetInstance().Trace("Module_Library",
+                                               "Burst message {}", lIndex);
+  }
+  EXPECT_TRUE(Stroalgo::Log::Logger::GetInstance().GetStats().m_AsyncEnabled);
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+
+  // Drops of the queue are attributed to the module
+  const auto lStats{Stroalgo::Log::Logger::GetInstance().GetStats()};
+  const auto &lModule{lStats.m_Modules.at("Module_Library")};
+  EXPECT_EQ(lModule.m_Accepted, lMessages);
+  EXPECT_EQ(lModule.m_QueueDropped, lStats.m_Async.m_DroppedNewest);
+  EXPECT_EQ(lModule.m_Dropped, lModule.m_QueueDropped);
+  EXPECT_EQ(lModule.m_Written, lMessages - lModule.m_QueueDropped);
+  EXPECT_LE(lStats.m_Async.m_QueueHighWater, 2U);
+  EXPECT_EQ(lStats.m_Async.m_Blocked, 0U);
+}
+
+TEST_F(LoggerTest, StatsAsyncDropOldest) {
+  Stroalgo::Log::AsyncOptions lOptions{};
+  lOptions.m_QueueCapacity = 2;
+  lOptions.m_OverflowPolicy = Stroalgo::Log::OverflowPolicy::DropOldest;
+  Stroalgo::Log::Logger::GetInstance().EnableAsyncMode(lOptions);
+
+  constexpr std::uint64_t lMessages{2000};
+  for (std::uint64_t lIndex = 0; lIndex < lMessages; ++lIndex) {
+    Stroalgo::Log::Logger::GetInstance().Trace("Module_Library",
+                                               "Burst message {}", lIndex);
+  }
+  Stroalgo::Log::Logger::GetInstance().DisableAsyncMode();
+
+  // Evicted records are attributed to the module which produced them
+  const auto lStats{Stroalgo::Log::Logger::GetInstance().GetStats()};
+  const auto &lModule{lStats.m_Modules.at("Module_Library")};
+  EXPECT_EQ(lModule.m_Accepted, lMessages);
+  EXPECT_EQ(lModule.m_QueueDropped, lStats.m_Async.m_DroppedOldest);
+  EXPECT_EQ(lModule.m_Dropped, lModule.m_QueueDropped);
+  EXPECT_EQ(lModule.m_Written, lMessages - lModule.m_QueueDropped);
+  EXPECT_EQ(lStats.m_Async.m_DroppedNewest, 0U);
+}
+
+TEST_F(LoggerTest, MappedLogFiles) {
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Writer = Stroalgo::Log::FileWriter::Mapped;
+  lFormats.m_MappedSegmentSize = 4096;
+  auto lHandle{Stroalgo::Log::Logger::GetInstance().RegisterModule(
+      "Mapped_Module", lFormats)};
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Mapped_Module/Mapped_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString();
+
+  // Same content and naming as the spdlog daily files, followed by the
+  // preallocated end of the segment while the files are open
+  lHandle.Info("Mapped message number {}", 1);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str() + ".txt",
+                               "[Mapped_Module] [info] ---> Mapped message"));
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str() + ".json",
+                               "Mapped message number 1"));
+
+  // Files emptied through their sink stay writable
+  Stroalgo::Log::Logger::GetInstance().DeleteAllModuleLogs("Mapped_Module");
+  EXPECT_FALSE(CheckWrittenData(lLogFilePath.str() + ".txt",
+                                "Mapped message number 1"));
+  lHandle.Info("Mapped message number {}", 2);
+  EXPECT_TRUE(CheckWrittenData(lLogFilePath.str() + ".txt",
+                               "Mapped message number 2"));
+}
+
+TEST_F(LoggerTest, UringLogFiles) {
+  Stroalgo::Log::LogFileFormats lFormats{};
+  lFormats.m_Writer = Stroalgo::Log::FileWriter::IoUring;
+  auto lHandle{Stroalgo::Log::Logger::GetInstance().RegisterModule(
+      "Uring_Module", lFormats)};
+  std::stringstream lLogFilePath{};
+  lLogFilePath << "Logs/Uring_Module/Uring_Module_"
+               << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+               << ".txt";
+
+  // Flushed on every record by the default policy
+  lHandle.Info("Uring message number {}", 1);
+  CheckLogsStructure(lLogFilePath.str(), "[Uring_Module] [info]", 1);
+
+  // Files emptied through their sink are written from their start
+  Stroalgo::Log::Logger::GetInstance().DeleteAllModuleLogs("Uring_Module");
+  lHandle.Info("Uring message number {}", 2);
+  CheckLogsStructure(lLogFilePath.str(), "[Uring_Module] [info]", 1);
+  EXPECT_TRUE(
+      CheckWrittenData(lLogFilePath.str(), "Uring message number 2"));
+}
@@ -0,0 +1,114 @@
+/**
+ * @file MappedFileSink_unitTest.cpp
+ * @brief Contains all units tests for the MappedFileSink class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#ifdef STROALGO_LOG_MAPPED_FILES
+#include "MappedFileSink.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/details/os.h>
+#include <spdlog/logger.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "LogTestHelpers.h"
+#include "Logger.h"
+
+class MappedFileSinkTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    if (std::filesystem::exists("MappedLogs")) {
+      std::filesystem::remove_all("MappedLogs");
+    }
+  }
+};
+
+TEST_F(MappedFileSinkTest, DailyNamingAndSegmentSize) {
+  auto lSink{std::make_shared<Stroalgo::Log::MappedFileSink>(
+      "MappedLogs/Mapped_Module.txt", 1)};
+  std::stringstream lFilePath{};
+  lFilePath << "MappedLogs/Mapped_Module_"
+            << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+            << ".txt";
+  EXPECT_EQ(lSink->GetFilename(), lFilePath.str());
+
+  // Rounded up to a page, the first segment is preallocated
+  EXPECT_GE(lSink->GetSegmentSize(), 4096U);
+  EXPECT_EQ(lSink->GetSegmentSize() % 4096U, 0U);
+  EXPECT_EQ(std::filesystem::file_size(lFilePath.str()),
+            lSink->GetSegmentSize());
+}
+
+TEST_F(MappedFileSinkTest, WriteAcrossSegments) {
+  auto lSink{std::make_shared<Stroalgo::Log::MappedFileSink>(
+      "MappedLogs/Mapped_Module.txt", 4096)};
+  const std::string lFilePath{lSink->GetFilename()};
+  auto lLogger{LogTest::MakeMessageLogger("Mapped_Module", lSink)};
+
+  // Three segments, records straddle the segment boundaries
+  std::string lExpected{};
+  for (int lRecord = 0; lRecord < 1000; ++lRecord) {
+    lLogger->info("Mapped record {}", lRecord);
+    lExpected += "Mapped record " + std::to_string(lRecord) +
+                 spdlog::details::os::default_eol;
+  }
+
+  // Copied records are visible before the file is closed
+  EXPECT_EQ(LogTest::ReadFile(lFilePath).substr(0, lExpected.size()),
+            lExpected);
+  EXPECT_EQ(std::filesystem::file_size(lFilePath) % lSink->GetSegmentSize(),
+            0U);
+
+  // Closing cuts the preallocated end
+  lLogger.reset();
+  lSink.reset();
+  EXPECT_EQ(LogTest::ReadFile(lFilePath), lExpected);
+}
+
+TEST_F(MappedFileSinkTest, ReopenAfterCrash) {
+  std::filesystem::create_directories("MappedLogs");
+  std::stringstream lFilePath{};
+  lFilePath << "MappedLogs/Mapped_Module_"
+            << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+            << ".txt";
+
+  // File left by a crash, data followed by a preallocated end
+  {
+    std::ofstream lFile{lFilePath.str(), std::ios::binary};
+    lFile << "Before crash\n" << std::string(8192 - 13, '\0');
+  }
+
+  auto lSink{std::make_shared<Stroalgo::Log::MappedFileSink>(
+      "MappedLogs/Mapped_Module.txt", 4096)};
+  auto lLogger{LogTest::MakeMessageLogger("Mapped_Module", lSink)};
+  lLogger->info("After crash");
+  lLogger.reset();
+  lSink.reset();
+
+  EXPECT_EQ(LogTest::ReadFile(lFilePath.str()),
+            std::string("Before crash\nAfter crash") +
+                spdlog::details::os::default_eol);
+}
+
+TEST_F(MappedFileSinkTest, Truncate) {
+  auto lSink{std::make_shared<Stroalgo::Log::MappedFileSink>(
+      "MappedLogs/Mapped_Module.txt", 4096)};
+  const std::string lFilePath{lSink->GetFilename()};
+  auto lLogger{LogTest::MakeMessageLogger("Mapped_Module", lSink)};
+  lLogger->info("Removed record");
+  lSink->Truncate();
+  lLogger->info("Kept record");
+  lLogger.reset();
+  lSink.reset();
+
+  EXPECT_EQ(LogTest::ReadFile(lFilePath),
+            std::string("Kept record") + spdlog::details::os::default_eol);
+}
+
+#endif  // STROALGO_LOG_MAPPED_FILES
@@ -0,0 +1,159 @@
+/**
+ * @file ModuleThrottle_unitTest.cpp
+ * @brief Contains all units tests for the ModuleThrottle class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "ModuleThrottle.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "AsyncBackend.h"
+#include "ModuleLevels.h"
+#include "ModuleLogger.h"
+
+namespace {
+
+/**
+ * @brief Sink keeping the messages it receives
+ */
+class CollectingSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  std::vector<std::string> m_Messages{};
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg &pMsg) override {
+    m_Messages.emplace_back(pMsg.payload.data(), pMsg.payload.size());
+  }
+  void flush_() override {}
+};
+
+}  // namespace
+
+class ModuleThrottleTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_Context.m_Name = "Throttle_Module";
+    m_Context.m_Logger =
+        std::make_shared<spdlog::logger>("Throttle_Module", m_Sink);
+    m_Context.m_Logger->set_level(spdlog::level::trace);
+    m_Context.m_ActiveBackend = &m_Backend;
+    m_Context.m_Threshold = &m_Threshold;
+  }
+
+  std::shared_ptr<CollectingSink> m_Sink{std::make_shared<CollectingSink>()};
+  std::atomic<Stroalgo::Log::AsyncBackend *> m_Backend{nullptr};
+  Stroalgo::Log::ModuleThreshold m_Threshold{0};
+  Stroalgo::Log::ModuleContext m_Context{};
+};
+
+TEST_F(ModuleThrottleTest, DisabledByDefault) {
+  EXPECT_FALSE(m_Context.m_Throttle.IsEnabled());
+  for (int lNumber = 0; lNumber < 100; ++lNumber) {
+    m_Context.Write<>(spdlog::level::trace, "Same");
+  }
+  EXPECT_EQ(m_Sink->m_Messages.size(), 100U);
+  EXPECT_EQ(m_Context.m_Throttle.GetCounters().m_Duplicates, 0U);
+
+  // A policy keeping everything leaves the throttle disabled
+  m_Context.m_Throttle.SetPolicy(Stroalgo::Log::ThrottlePolicy{});
+  EXPECT_FALSE(m_Context.m_Throttle.IsEnabled());
+}
+
+TEST_F(ModuleThrottleTest, PolicyRoundTrip) {
+  Stroalgo::Log::ThrottlePolicy lPolicy{};
+  lPolicy.m_RatePerSecond = 100;
+  lPolicy.m_Burst = 20;
+  lPolicy.m_SampleRate = 0.5;
+  lPolicy.m_SuppressDuplicates = true;
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  EXPECT_TRUE(m_Context.m_Throttle.IsEnabled());
+
+  const auto lRet{m_Context.m_Throttle.GetPolicy()};
+  EXPECT_NEAR(lRet.m_RatePerSecond, 100, 1e-6);
+  EXPECT_EQ(lRet.m_Burst, 20U);
+  EXPECT_NEAR(lRet.m_SampleRate, 0.5, 1e-9);
+  EXPECT_TRUE(lRet.m_SuppressDuplicates);
+}
+
+TEST_F(ModuleThrottleTest, RateLimitBurst) {
+  // Slow rate, only the burst is admitted during the test
+  Stroalgo::Log::ThrottlePolicy lPolicy{};
+  lPolicy.m_RatePerSecond = 0.01;
+  lPolicy.m_Burst = 10;
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  for (int lNumber = 0; lNumber < 50; ++lNumber) {
+    m_Context.Write<int>(spdlog::level::info, "Record {}", int{lNumber});
+  }
+  ASSERT_EQ(m_Sink->m_Messages.size(), 10U);
+  EXPECT_EQ(m_Sink->m_Messages.back(), "Record 9");
+  EXPECT_EQ(m_Context.m_Throttle.GetCounters().m_RateLimited, 40U);
+
+  // Filtered levels do not consume the bucket
+  m_Threshold.store(spdlog::level::err);
+  m_Context.Write<>(spdlog::level::info, "Filtered");
+  EXPECT_EQ(m_Context.m_Throttle.GetCounters().m_RateLimited, 40U);
+
+  // A new policy starts with a full burst
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  m_Context.Write<>(spdlog::level::err, "Admitted");
+  EXPECT_EQ(m_Sink->m_Messages.back(), "Admitted");
+}
+
+TEST_F(ModuleThrottleTest, SamplingTraceAndDebugOnly) {
+  Stroalgo::Log::ThrottlePolicy lPolicy{};
+  lPolicy.m_SampleRate = 0;
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  m_Context.Write<>(spdlog::level::trace, "Trace");
+  m_Context.Write<>(spdlog::level::debug, "Debug");
+  m_Context.Write<>(spdlog::level::info, "Info");
+  ASSERT_EQ(m_Sink->m_Messages.size(), 1U);
+  EXPECT_EQ(m_Sink->m_Messages.front(), "Info");
+  EXPECT_EQ(m_Context.m_Throttle.GetCounters().m_Sampled, 2U);
+
+  // Roughly half of the records are kept
+  lPolicy.m_SampleRate = 0.5;
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  for (int lNumber = 0; lNumber < 10000; ++lNumber) {
+    m_Context.Write<>(spdlog::level::debug, "Debug");
+  }
+  EXPECT_GT(m_Sink->m_Messages.size(), 4500U);
+  EXPECT_LT(m_Sink->m_Messages.size(), 5500U);
+}
+
+TEST_F(ModuleThrottleTest, SuppressDuplicates) {
+  Stroalgo::Log::ThrottlePolicy lPolicy{};
+  lPolicy.m_SuppressDuplicates = true;
+  m_Context.m_Throttle.SetPolicy(lPolicy);
+  for (int lNumber = 0; lNumber < 5; ++lNumber) {
+    m_Context.Write<int>(spdlog::level::warn, "Disk {} full", 1);
+  }
+  m_Context.Write<int>(spdlog::level::warn, "Disk {} full", 2);
+  m_Context.Write<int>(spdlog::level::warn, "Disk {} full", 2);
+  m_Context.Write<int>(spdlog::level::err, "Disk {} full", 2);
+
+  // Same message at another level is not a duplicate
+  const std::vector<std::string> lExpected{
+      "Disk 1 full", "Previous message repeated 4 times", "Disk 2 full",
+      "Previous message repeated 1 times", "Disk 2 full"};
+  EXPECT_EQ(m_Sink->m_Messages, lExpected);
+  EXPECT_EQ(m_Context.m_Throttle.GetCounters().m_Duplicates, 5U);
+
+  // Pending repeats are reported once
+  m_Context.Write<int>(spdlog::level::err, "Disk {} full", 2);
+  m_Context.FlushRepeats();
+  m_Context.FlushRepeats();
+  EXPECT_EQ(m_Sink->m_Messages.size(), lExpected.size() + 1);
+  EXPECT_EQ(m_Sink->m_Messages.back(), "Previous message repeated 1 times");
+
+  // Duplicates of the message are still collapsed after a report
+  m_Context.Write<int>(spdlog::level::err, "Disk {} full", 2);
+  EXPECT_EQ(m_Sink->m_Messages.size(), lExpected.size() + 1);
+}
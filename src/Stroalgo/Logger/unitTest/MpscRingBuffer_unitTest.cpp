@@ -0,0 +1,107 @@
+/**
+ * @file MpscRingBuffer_unitTest.cpp
+ * @brief Contains all units tests for the MpscRingBuffer class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "MpscRingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+TEST(MpscRingBufferTest, CapacityRoundedToPowerOfTwo) {
+  Stroalgo::Log::MpscRingBuffer<int> lBuffer{100};
+  EXPECT_EQ(lBuffer.Capacity(), 128U);
+
+  Stroalgo::Log::MpscRingBuffer<int> lTinyBuffer{0};
+  EXPECT_EQ(lTinyBuffer.Capacity(), 2U);
+}
+
+TEST(MpscRingBufferTest, FifoOrder) {
+  Stroalgo::Log::MpscRingBuffer<int> lBuffer{8};
+  for (int lValue = 0; lValue < 8; ++lValue) {
+    EXPECT_TRUE(lBuffer.TryPush(int{lValue}));
+  }
+
+  // Buffer is full
+  EXPECT_FALSE(lBuffer.TryPush(8));
+  EXPECT_EQ(lBuffer.SizeApprox(), 8U);
+
+  int lValue{-1};
+  for (int lExpected = 0; lExpected < 8; ++lExpected) {
+    EXPECT_TRUE(lBuffer.TryPop(lValue));
+    EXPECT_EQ(lValue, lExpected);
+  }
+
+  // Buffer is empty
+  EXPECT_FALSE(lBuffer.TryPop(lValue));
+}
+
+TEST(MpscRingBufferTest, DropNewestPolicy) {
+  Stroalgo::Log::MpscRingBuffer<int> lBuffer{2};
+  EXPECT_EQ(lBuffer.Push(1, Stroalgo::Log::OverflowPolicy::DropNewest),
+            Stroalgo::Log::PushResult::Pushed);
+  EXPECT_EQ(lBuffer.Push(2, Stroalgo::Log::OverflowPolicy::DropNewest),
+            Stroalgo::Log::PushResult::Pushed);
+  EXPECT_EQ(lBuffer.Push(3, Stroalgo::Log::OverflowPolicy::DropNewest),
+            Stroalgo::Log::PushResult::DroppedNewest);
+
+  // Expect the first values kept
+  int lValue{0};
+  EXPECT_TRUE(lBuffer.TryPop(lValue));
+  EXPECT_EQ(lValue, 1);
+  EXPECT_TRUE(lBuffer.TryPop(lValue));
+  EXPECT_EQ(lValue, 2);
+}
+
+TEST(MpscRingBufferTest, DropOldestPolicy) {
+  Stroalgo::Log::MpscRingBuffer<int> lBuffer{2};
+  lBuffer.Push(1, Stroalgo::Log::OverflowPolicy::DropOldest);
+  lBuffer.Push(2, Stroalgo::Log::OverflowPolicy::DropOldest);
+  EXPECT_EQ(lBuffer.Push(3, Stroalgo::Log::OverflowPolicy::DropOldest),
+            Stroalgo::Log::PushResult::PushedDroppedOldest);
+
+  // Expect the last values kept
+  int lValue{0};
+  EXPECT_TRUE(lBuffer.TryPop(lValue));
+  EXPECT_EQ(lValue, 2);
+  EXPECT_TRUE(lBuffer.TryPop(lValue));
+  EXPECT_EQ(lValue, 3);
+}
+
+TEST(MpscRingBufferTest, ConcurrentProducers) {
+  constexpr std::size_t lProducers{4};
+  constexpr std::size_t lValuesPerProducer{10000};
+  Stroalgo::Log::MpscRingBuffer<std::size_t> lBuffer{64};
+
+  std::vector<std::thread> lThreads{};
+  for (std::size_t lProducer = 0; lProducer < lProducers; ++lProducer) {
+    lThreads.emplace_back([&lBuffer, lProducer]() {
+      for (std::size_t lIndex = 0; lIndex < lValuesPerProducer; ++lIndex) {
+        lBuffer.Push(lProducer * lValuesPerProducer + lIndex,
+                     Stroalgo::Log::OverflowPolicy::Block);
+      }
+    });
+  }
+
+  // Every value is received exactly once and in order for each producer
+  std::vector<std::size_t> lNextExpected(lProducers, 0);
+  std::size_t lReceived{0};
+  std::size_t lValue{0};
+  while (lReceived < lProducers * lValuesPerProducer) {
+    if (lBuffer.TryPop(lValue)) {
+      const std::size_t lProducer{lValue / lValuesPerProducer};
+      EXPECT_EQ(lValue % lValuesPerProducer, lNextExpected[lProducer]);
+      ++lNextExpected[lProducer];
+      ++lReceived;
+    }
+  }
+
+  for (auto &lThread : lThreads) {
+    lThread.join();
+  }
+  EXPECT_FALSE(lBuffer.TryPop(lValue));
+}
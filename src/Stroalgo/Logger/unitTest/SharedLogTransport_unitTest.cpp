@@ -0,0 +1,221 @@
+/**
+ * @file SharedLogTransport_unitTest.cpp
+ * @brief Contains all units tests for the shared memory transport and its
+ * collector
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#ifdef STROALGO_LOG_SHARED_MEMORY
+#include "SharedLogTransport.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/logger.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "LogCollector.h"
+#include "Logger.h"
+
+class SharedLogTransportTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_Options.m_Name = TransportName(::getpid());
+    m_Options.m_Size = 4096;
+  }
+
+  void TearDown() override {
+    if (std::filesystem::exists("Logs")) {
+      std::filesystem::remove_all("Logs");
+    }
+  }
+
+  /**
+   * @brief Get the transport name of a test process, shared with the
+   * processes it starts
+   *
+   * @param pTestProcess Process running the test
+   * @return The name
+   */
+  static std::string TransportName(::pid_t pTestProcess) {
+    return "stroalgo-test-" + std::to_string(pTestProcess);
+  }
+
+  /**
+   * @brief Read the pending records of a ring
+   *
+   * @param pSegment The ring
+   * @return "<module>:<level>:<message>" of each record
+   */
+  static std::vector<std::string> DrainMessages(
+      Stroalgo::Log::SharedLogSegment &pSegment) {
+    std::vector<std::string> lRet{};
+    pSegment.Drain(
+        [&lRet](const Stroalgo::Log::SharedLogRecord &pRecord) {
+          lRet.push_back(std::string{pRecord.m_ModuleName} + ":" +
+                         std::to_string(pRecord.m_Level) + ":" +
+                         std::string{pRecord.m_Payload});
+        },
+        1000);
+    return lRet;
+  }
+
+  /**
+   * @brief Get the path of today's text file of a module
+   *
+   * @param pModuleName Name of the module
+   * @return "Logs/<Module>/<Module>_YYYY-MM-DD.txt"
+   */
+  static std::string TextFile(const std::string &pModuleName) {
+    std::stringstream lRet{};
+    lRet << "Logs/" << pModuleName << "/" << pModuleName << "_"
+         << Stroalgo::Log::Logger::GetInstance().CurrentDateToString()
+         << ".txt";
+    return lRet.str();
+  }
+
+  /**
+   * @brief Name and size of the tested rings
+   */
+  Stroalgo::Log::SharedTransportOptions m_Options{};
+};
+
+TEST_F(SharedLogTransportTest, RingCarriesRecords) {
+  auto lSink{std::make_shared<Stroalgo::Log::SharedLogSink>(m_Options)};
+  const std::string lPrefix{"/" + m_Options.m_Name + "." +
+                            std::to_string(::getpid()) + "." +
+                            std::to_string(Stroalgo::Log::GetProcessStartTime(
+                                static_cast<std::uint32_t>(::getpid()))) +
+                            "."};
+  EXPECT_EQ(lSink->GetSegmentName().compare(0, lPrefix.size(), lPrefix), 0);
+  EXPECT_GT(Stroalgo::Log::GetProcessStartTime(
+                static_cast<std::uint32_t>(::getpid())),
+            0U);
+  spdlog::logger lLogger{"Shared_Module", lSink};
+  lLogger.set_level(spdlog::level::trace);
+  Stroalgo::Log::SharedLogSegment lSegment{lSink->GetSegmentName()};
+  EXPECT_EQ(lSegment.GetProcessId(), static_cast<std::uint32_t>(::getpid()));
+  EXPECT_FALSE(lSegment.IsProducerGone());
+
+  lLogger.debug("First message");
+  lLogger.error("Second message {}", 2);
+  EXPECT_EQ(DrainMessages(lSegment),
+            (std::vector<std::string>{"Shared_Module:1:First message",
+                                      "Shared_Module:4:Second message 2"}));
+  EXPECT_TRUE(DrainMessages(lSegment).empty());
+
+  // Entries skip the end of the ring, the oldest are released by the reader
+  for (int lRound = 0; lRound < 100; ++lRound) {
+    lLogger.info("Round message {}", lRound);
+    ASSERT_EQ(DrainMessages(lSegment),
+              (std::vector<std::string>{"Shared_Module:2:Round message " +
+                                        std::to_string(lRound)}));
+  }
+  EXPECT_EQ(lSink->GetWrittenRecords(), 102U);
+
+  // A full ring drops the newest records without waiting
+  for (int lNumber = 0; lNumber < 200; ++lNumber) {
+    lLogger.info("Burst message {}", lNumber);
+  }
+  const auto lMessages{DrainMessages(lSegment)};
+  EXPECT_EQ(lMessages.size() + lSink->GetDroppedRecords(), 200U);
+  EXPECT_GT(lSink->GetDroppedRecords(), 0U);
+  EXPECT_EQ(lMessages.front(), "Shared_Module:2:Burst message 0");
+  EXPECT_EQ(lSegment.TakeDroppedRecords(), lSink->GetDroppedRecords());
+  EXPECT_EQ(lSegment.TakeDroppedRecords(), 0U);
+  lSegment.Remove();
+}
+
+TEST_F(SharedLogTransportTest, UndrainedRingKept) {
+  auto lFirst{std::make_shared<Stroalgo::Log::SharedLogSink>(m_Options)};
+  spdlog::logger{"Shared_Module", lFirst}.info("Not drained yet");
+  const std::string lFirstName{lFirst->GetSegmentName()};
+  lFirst.reset();
+
+  // A new ring never replaces one still holding records
+  auto lSecond{std::make_shared<Stroalgo::Log::SharedLogSink>(m_Options)};
+  EXPECT_NE(lSecond->GetSegmentName(), lFirstName);
+  Stroalgo::Log::SharedLogSegment lSegment{lFirstName};
+  EXPECT_EQ(DrainMessages(lSegment),
+            (std::vector<std::string>{"Shared_Module:2:Not drained yet"}));
+  lSegment.Remove();
+  Stroalgo::Log::SharedLogSegment{lSecond->GetSegmentName()}.Remove();
+}
+
+TEST_F(SharedLogTransportTest, CollectorRestartGoesOn) {
+  auto lSink{std::make_shared<Stroalgo::Log::SharedLogSink>(m_Options)};
+  spdlog::logger lLogger{"Collected_Module", lSink};
+  Stroalgo::Log::CollectorOptions lOptions{};
+  lOptions.m_Name = m_Options.m_Name;
+
+  lLogger.info("Before restart");
+  {
+    Stroalgo::Log::LogCollector lCollector{lOptions};
+    EXPECT_EQ(lCollector.CollectPending(), 1U);
+    EXPECT_EQ(lCollector.GetCounters().m_Producers, 1U);
+  }
+
+  // The released records are not written again
+  lLogger.info("After restart");
+  Stroalgo::Log::LogCollector lCollector{lOptions};
+  EXPECT_EQ(lCollector.CollectPending(), 1U);
+  EXPECT_EQ(lCollector.CollectPending(), 0U);
+  Stroalgo::Log::Logger::GetInstance().Flush();
+  EXPECT_EQ(lCollector.GetCounters().m_Departed, 0U);
+
+  std::ifstream lFile{TextFile("Collected_Module")};
+  std::stringstream lContent{};
+  lContent << lFile.rdbuf();
+  EXPECT_NE(lContent.str().find("Before restart"), std::string::npos);
+  EXPECT_NE(lContent.str().find("After restart"), std::string::npos);
+  Stroalgo::Log::SharedLogSegment{lSink->GetSegmentName()}.Remove();
+}
+
+TEST_F(SharedLogTransportTest, LoggerSendsToCollector) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  EXPECT_EXIT(
+      {
+        // Started by the test process, the modules never write their files
+        Stroalgo::Log::SharedTransportOptions lOptions{};
+        lOptions.m_Name = TransportName(::getppid());
+        auto &lLogger{Stroalgo::Log::Logger::GetInstance()};
+        auto lEarly{lLogger.RegisterModule("Early_Module")};
+        lLogger.EnableSharedTransport(lOptions);
+        auto lLate{lLogger.RegisterModule("Late_Module")};
+        lEarly.Info("Early message {}", 1);
+        lLate.Warning("Late message {}", 2);
+        const bool lWritten{lLogger.GetStats().m_SharedWritten == 2};
+        const bool lNoFile{!std::filesystem::exists("Logs/Late_Module")};
+        ::_exit(lLogger.IsSharedTransportEnabled() && lWritten && lNoFile ? 0
+                                                                          : 1);
+      },
+      ::testing::ExitedWithCode(0), "");
+
+  // The collector writes the records of the exited producer then its ring
+  // is removed
+  Stroalgo::Log::CollectorOptions lOptions{};
+  lOptions.m_Name = m_Options.m_Name;
+  Stroalgo::Log::LogCollector lCollector{lOptions};
+  EXPECT_EQ(lCollector.CollectPending(), 2U);
+  EXPECT_EQ(lCollector.GetCounters().m_Departed, 1U);
+  EXPECT_EQ(lCollector.GetCounters().m_Producers, 0U);
+  Stroalgo::Log::Logger::GetInstance().Flush();
+
+  std::ifstream lEarlyFile{TextFile("Early_Module")};
+  std::stringstream lEarly{};
+  lEarly << lEarlyFile.rdbuf();
+  EXPECT_NE(lEarly.str().find("Early message 1"), std::string::npos);
+  std::ifstream lLateFile{TextFile("Late_Module")};
+  std::stringstream lLate{};
+  lLate << lLateFile.rdbuf();
+  EXPECT_NE(lLate.str().find("[warning]"), std::string::npos);
+  EXPECT_NE(lLate.str().find("Late message 2"), std::string::npos);
+  EXPECT_EQ(lCollector.CollectPending(), 0U);
+}
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file SpscRingBuffer_unitTest.cpp
+ * @brief Contains all units tests for the SpscRingBuffer class
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "SpscRingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <thread>
+
+TEST(SpscRingBufferTest, FifoOrder) {
+  Stroalgo::Log::SpscRingBuffer<int> lBuffer{5};
+  EXPECT_EQ(lBuffer.Capacity(), 8U);
+  EXPECT_EQ(lBuffer.Front(), nullptr);
+  for (int lValue = 0; lValue < 8; ++lValue) {
+    EXPECT_TRUE(lBuffer.TryPush(int{lValue}));
+  }
+
+  // Buffer is full
+  EXPECT_FALSE(lBuffer.TryPush(8));
+  EXPECT_EQ(lBuffer.EnqueuedCount(), 8U);
+
+  for (int lExpected = 0; lExpected < 8; ++lExpected) {
+    ASSERT_NE(lBuffer.Front(), nullptr);
+    EXPECT_EQ(*lBuffer.Front(), lExpected);
+    lBuffer.PopFront();
+  }
+
+  // Buffer is empty, a slot is free again
+  EXPECT_EQ(lBuffer.Front(), nullptr);
+  EXPECT_EQ(lBuffer.DequeuedCount(), 8U);
+  EXPECT_TRUE(lBuffer.TryPush(8));
+  EXPECT_EQ(*lBuffer.Front(), 8);
+}
+
+TEST(SpscRingBufferTest, ConcurrentProducerAndConsumer) {
+  constexpr std::size_t lValues{100000};
+  Stroalgo::Log::SpscRingBuffer<std::size_t> lBuffer{64};
+
+  std::thread lProducer{[&lBuffer]() {
+    for (std::size_t lIndex = 0; lIndex < lValues; ++lIndex) {
+      while (!lBuffer.TryPush(std::size_t{lIndex})) {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  // Every value is received exactly once and in order
+  std::size_t lExpected{0};
+  while (lExpected < lValues) {
+    const std::size_t *lValue{lBuffer.Front()};
+    if (lValue != nullptr) {
+      EXPECT_EQ(*lValue, lExpected);
+      lBuffer.PopFront();
+      ++lExpected;
+    }
+  }
+  lProducer.join();
+  EXPECT_EQ(lBuffer.Front(), nullptr);
+}
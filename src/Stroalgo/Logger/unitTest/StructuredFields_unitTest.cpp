@@ -0,0 +1,189 @@
+/**
+ * @file StructuredFields_unitTest.cpp
+ * @brief Contains all units tests for the structured fields and the JSON
+ * escaping
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#include "StructuredFields.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AsyncBackend.h"
+#include "FieldFormatter.h"
+#include "ModuleLevels.h"
+#include "ModuleLogger.h"
+
+namespace {
+
+/**
+ * @brief Escape a string one character at a time
+ *
+ * @param pValue String to escape
+ * @return The JSON string
+ */
+std::string ReferenceEscape(std::string_view pValue) {
+  std::string lRet{"\""};
+  for (const char lChar : pValue) {
+    if (lChar == '"') {
+      lRet += "\\\"";
+    } else if (lChar == '\\') {
+      lRet += "\\\\";
+    } else if (lChar == '\n') {
+      lRet += "\\n";
+    } else if (lChar == '\r') {
+      lRet += "\\r";
+    } else if (lChar == '\t') {
+      lRet += "\\t";
+    } else if (static_cast<unsigned char>(lChar) < 0x20) {
+      lRet += fmt::format("\\u{:04x}", static_cast<unsigned int>(lChar));
+    } else {
+      lRet += lChar;
+    }
+  }
+  return lRet + "\"";
+}
+
+/**
+ * @brief Escape a string with AppendJsonString
+ *
+ * @param pValue String to escape
+ * @return The JSON string
+ */
+std::string Escape(std::string_view pValue) {
+  spdlog::memory_buf_t lBuffer{};
+  Stroalgo::Log::AppendJsonString(lBuffer, pValue);
+  return fmt::to_string(lBuffer);
+}
+
+/**
+ * @brief Sink keeping the lines it formats
+ */
+class CollectingSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  std::vector<std::string> m_Lines{};
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg &pMsg) override {
+    spdlog::memory_buf_t lBuffer{};
+    formatter_->format(pMsg, lBuffer);
+    m_Lines.push_back(fmt::to_string(lBuffer));
+  }
+  void flush_() override {}
+};
+
+}  // namespace
+
+TEST(StructuredFieldsTest, EscapeLikeReference) {
+  EXPECT_EQ(Escape(""), "\"\"");
+  EXPECT_EQ(Escape("a\"b\\c\x01\x1f\x7f\xc3\xa9"),
+            "\"a\\\"b\\\\c\\u0001\\u001f\x7f\xc3\xa9\"");
+
+  // Special characters at every position of the words, UTF-8 bytes and
+  // characters around the control range are kept
+  std::mt19937 lGenerator{42};
+  const std::string_view lAlphabet{"ab \"\\\n\r\t\x01\x1f\x20\x21\x7f\x80\xff"};
+  std::uniform_int_distribution<std::size_t> lChar{0, lAlphabet.size() - 1};
+  std::uniform_int_distribution<std::size_t> lLength{0, 40};
+  for (int lRound = 0; lRound < 2000; ++lRound) {
+    std::string lValue(lLength(lGenerator), 'x');
+    for (auto &lItem : lValue) {
+      if (lGenerator() % 4 == 0) {
+        lItem = lAlphabet[lChar(lGenerator)];
+      }
+    }
+    ASSERT_EQ(Escape(lValue), ReferenceEscape(lValue)) << lValue;
+  }
+}
+
+TEST(StructuredFieldsTest, TypedMembers) {
+  enum class Color { Red, Green };
+  const std::string lName{"ALLOGHO \"A\""};
+  spdlog::memory_buf_t lBuffer{};
+  Stroalgo::Log::AppendJsonMembers(
+      lBuffer, Stroalgo::Log::Kv("int", -12),
+      Stroalgo::Log::Kv("u64", std::numeric_limits<std::uint64_t>::max()),
+      Stroalgo::Log::Kv("double", 1.5), Stroalgo::Log::Kv("bool", false),
+      Stroalgo::Log::Kv("char", 'c'), Stroalgo::Log::Kv("name", lName),
+      Stroalgo::Log::Kv("literal", "text"),
+      Stroalgo::Log::Kv("nan", std::numeric_limits<double>::quiet_NaN()),
+      Stroalgo::Log::Kv("enum", Color::Green),
+      Stroalgo::Log::Kv("key \"q\"", 0));
+  EXPECT_EQ(fmt::to_string(lBuffer),
+            "\"int\": -12, \"u64\": 18446744073709551615, \"double\": 1.5, "
+            "\"bool\": false, \"char\": \"c\", \"name\": \"ALLOGHO "
+            "\\\"A\\\"\", \"literal\": \"text\", \"nan\": null, \"enum\": 1, "
+            "\"key \\\"q\\\"\": 0");
+  EXPECT_EQ(fmt::format("{}", Stroalgo::Log::Kv("user", 7)), "user=7");
+}
+
+TEST(StructuredFieldsTest, ModuleWritesFields) {
+  auto lSink{std::make_shared<CollectingSink>()};
+  Stroalgo::Log::LogFields lFields{};
+  lFields.m_Time = false;
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Json, lFields));
+  std::atomic<Stroalgo::Log::AsyncBackend *> lBackend{nullptr};
+  Stroalgo::Log::ModuleThreshold lThreshold{spdlog::level::info};
+  Stroalgo::Log::ModuleContext lContext{};
+  lContext.m_Logger = std::make_shared<spdlog::logger>("Fields_Module", lSink);
+  lContext.m_ActiveBackend = &lBackend;
+  lContext.m_Threshold = &lThreshold;
+  Stroalgo::Log::ModuleLogger lLogger{&lContext};
+
+  const std::uint64_t lLatency{125};
+  lLogger.Info("Login of {}", Stroalgo::Log::Kv("user", "bob"),
+               Stroalgo::Log::Kv("latency_us", lLatency));
+  // Fields of filtered levels are not encoded
+  lLogger.Debug("Filtered", Stroalgo::Log::Kv("user", "bob"));
+  lLogger.Info("Plain {}", 1);
+
+  ASSERT_EQ(lSink->m_Lines.size(), 2U);
+  EXPECT_EQ(lSink->m_Lines[0],
+            "{\"name\": \"Fields_Module\", \"level\": \"info\", \"message\": "
+            "\"Login of user=bob\", \"user\": \"bob\", \"latency_us\": "
+            "125},\n");
+  EXPECT_EQ(lSink->m_Lines[1],
+            "{\"name\": \"Fields_Module\", \"level\": \"info\", \"message\": "
+            "\"Plain 1\"},\n");
+}
+
+TEST(StructuredFieldsTest, SeparatorInTextIsNotForged) {
+  auto lSink{std::make_shared<CollectingSink>()};
+  Stroalgo::Log::LogFields lFields{};
+  lFields.m_Time = false;
+  lFields.m_Name = false;
+  lSink->set_formatter(std::make_unique<Stroalgo::Log::FieldFormatter>(
+      Stroalgo::Log::LogFraming::Json, lFields));
+  std::atomic<Stroalgo::Log::AsyncBackend *> lBackend{nullptr};
+  Stroalgo::Log::ModuleThreshold lThreshold{spdlog::level::info};
+  Stroalgo::Log::ModuleContext lContext{};
+  lContext.m_Logger = std::make_shared<spdlog::logger>("Forged_Module", lSink);
+  lContext.m_ActiveBackend = &lBackend;
+  lContext.m_Threshold = &lThreshold;
+  Stroalgo::Log::ModuleLogger lLogger{&lContext};
+
+  // Neither a plain message nor a field value can add members
+  const std::string_view lForged{"x\x1e\"admin\": true"};
+  lLogger.Info("Plain {}", lForged);
+  lLogger.Info("Login of {}", Stroalgo::Log::Kv("user", lForged));
+
+  ASSERT_EQ(lSink->m_Lines.size(), 2U);
+  EXPECT_EQ(lSink->m_Lines[0],
+            "{\"level\": \"info\", \"message\": \"Plain "
+            "x\\u001e\\\"admin\\\": true\"},\n");
+  EXPECT_EQ(lSink->m_Lines[1],
+            "{\"level\": \"info\", \"message\": \"Login of "
+            "user=x\\u001e\\\"admin\\\": true\", \"user\": "
+            "\"x\\u001e\\\"admin\\\": true\"},\n");
+}
@@ -0,0 +1,112 @@
+/**
+ * @file UringFileSink_unitTest.cpp
+ * @brief Contains all units tests for the UringFileSink and IoUring classes
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
+
+#ifdef STROALGO_LOG_IO_URING
+#include "UringFileSink.h"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <spdlog/details/os.h>
+#include <spdlog/logger.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "IoUring.h"
+#include "LogTestHelpers.h"
+
+class UringFileSinkTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    if (std::filesystem::exists("UringLogs")) {
+      std::filesystem::remove_all("UringLogs");
+    }
+  }
+};
+
+TEST_F(UringFileSinkTest, RingWriteAndSync) {
+  if (!Stroalgo::Log::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring not supported";
+  }
+  std::filesystem::create_directories("UringLogs");
+  const int lFile{::open("UringLogs/Ring.bin", O_WRONLY | O_CREAT, 0644)};
+  ASSERT_GE(lFile, 0);
+
+  // Fixed buffer write followed by a fdatasync
+  std::string lData{"Ring data"};
+  Stroalgo::Log::IoUring lRing{4};
+  const iovec lBuffer{lData.data(), lData.size()};
+  ASSERT_TRUE(lRing.RegisterBuffers(&lBuffer, 1));
+  EXPECT_TRUE(lRing.PrepareWriteFixed(lFile, lData.data(),
+                                      static_cast<std::uint32_t>(lData.size()),
+                                      0, 0, 7));
+  EXPECT_TRUE(lRing.PrepareDataSync(lFile, 8));
+  EXPECT_TRUE(lRing.Submit(2));
+
+  std::uint64_t lUserData{0};
+  std::int32_t lResult{0};
+  ASSERT_TRUE(lRing.PopCompletion(lUserData, lResult));
+  EXPECT_EQ(lUserData, 7U);
+  EXPECT_EQ(lResult, static_cast<std::int32_t>(lData.size()));
+  ASSERT_TRUE(lRing.PopCompletion(lUserData, lResult));
+  EXPECT_EQ(lUserData, 8U);
+  EXPECT_EQ(lResult, 0);
+  EXPECT_FALSE(lRing.PopCompletion(lUserData, lResult));
+  ::close(lFile);
+
+  EXPECT_EQ(LogTest::ReadFile("UringLogs/Ring.bin"), lData);
+}
+
+TEST_F(UringFileSinkTest, WriteAcrossBuffers) {
+  auto lSink{
+      std::make_shared<Stroalgo::Log::UringFileSink>("UringLogs/Uring.txt")};
+  EXPECT_EQ(lSink->IsUsingRing(), Stroalgo::Log::IoUring::IsSupported());
+  const std::string lFilePath{lSink->GetFilename()};
+  auto lLogger{LogTest::MakeMessageLogger("Uring_Module", lSink)};
+
+  // Several full buffers submitted while the next one is filled
+  std::string lExpected{};
+  for (int lRecord = 0; lRecord < 50000; ++lRecord) {
+    lLogger->info("Uring record {}", lRecord);
+    lExpected += "Uring record " + std::to_string(lRecord) +
+                 spdlog::details::os::default_eol;
+  }
+  ASSERT_GT(lExpected.size(), 2 * Stroalgo::Log::c_UringBufferSize);
+
+  // Buffered messages are written by a flush
+  lLogger->flush();
+  EXPECT_EQ(LogTest::ReadFile(lFilePath), lExpected);
+
+  // Appended after the messages already written today
+  lLogger.reset();
+  lSink.reset();
+  lSink = std::make_shared<Stroalgo::Log::UringFileSink>("UringLogs/Uring.txt");
+  lLogger = LogTest::MakeMessageLogger("Uring_Module", lSink);
+  lLogger->info("Reopened");
+  lSink->Sync();
+  EXPECT_EQ(LogTest::ReadFile(lFilePath),
+            lExpected + "Reopened" + spdlog::details::os::default_eol);
+}
+
+TEST_F(UringFileSinkTest, Truncate) {
+  auto lSink{
+      std::make_shared<Stroalgo::Log::UringFileSink>("UringLogs/Uring.txt")};
+  const std::string lFilePath{lSink->GetFilename()};
+  auto lLogger{LogTest::MakeMessageLogger("Uring_Module", lSink)};
+  lLogger->info("Removed record");
+  lLogger->flush();
+  lSink->Truncate();
+  lLogger->info("Kept record");
+  lLogger.reset();
+  lSink.reset();
+
+  EXPECT_EQ(LogTest::ReadFile(lFilePath),
+            std::string("Kept record") + spdlog::details::os::default_eol);
+}
+
+#endif  // STROALGO_LOG_IO_URING
@@ -1,7 +1,12 @@
-// #include <gtest/gtest.h>
+/**
+ * @file main.cpp
+ * @brief Main function to run Logger units tests
+ * @copyright   Copyright (c) 2025 stroalgo.corp
+ */
 
-// int main(int argc, char** argv)
-// {
-//     ::testing::InitGoogleTest(&argc, argv);
-//     return RUN_ALL_TESTS();
-// }
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}